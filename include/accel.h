@@ -0,0 +1,419 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   accel.h                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef ACCEL_H
+# define ACCEL_H
+
+# include "minirt.h"
+# include <limits.h>
+
+/*
+ * 가속 구조 (src/accel)
+ *
+ * prepare_scene이 끝나면 build_accel이 물체 연결 리스트를 종류별
+ * 배열로 나누고, 크기가 있는 물체(구, 원기둥)로 BVH를 만듭니다.
+ * BVH의 잎(leaf)은 물체를 종류별로 묶어 두므로, 탐색 중에는 종류마다
+ * 분기 없는 반복문 하나로 교점을 계산합니다 (prim_kernels.c).
+ * 크기가 없는(무한한) 평면은 BVH에 넣지 않고, 성분별 배열(SoA)에
+ * 모아 BVH 탐색 전에 한 번에 검사합니다 (plane_pass.c).
+ *
+ * 그룹 배치(instance)는 두 단계 구조입니다. 그룹마다 로컬 좌표계의
+ * 가속 구조(BLAS)를 한 번 만들고, 장면의 BVH(TLAS)에는 배치의 세계
+ * 경계 상자만 넣습니다. 배치를 만난 광선은 로컬 좌표로 옮겨 그룹의
+ * 가속 구조를 탐색합니다 (instance_hit.c). 메모리는 그룹 안의 물체
+ * 수와 배치 수의 합에 비례합니다.
+ *
+ * 새로운 종류를 추가하려면 PRIM_* 번호, 배열, 경계 상자 함수,
+ * 커널 표의 항목을 하나씩 추가합니다. 기존 종류의 반복문은 그대로입니다.
+ */
+/* PRIM_BOUNDED: BVH에 들어가는 종류의 수 (평면은 그 다음 번호) */
+# define PRIM_SPHERE 0
+# define PRIM_CYLINDER 1
+# define PRIM_INSTANCE 2
+# define PRIM_BOUNDED 3
+# define PRIM_PLANE 3
+
+# define BVH_BINS 12
+# define BVH_LEAF_MAX 8
+/*
+ * 탐색 스택: 깊이 d의 트리를 가까운 자식부터 순회하면 이진 BVH는
+ * 최대 d + 1칸, 4갈래 BVH는 최대 3d + 1칸이 필요합니다.
+ */
+# define BVH_MAX_DEPTH 63
+# define TRAV_STACK 192
+# define PLANE_BLOCK 8
+
+/*
+ * BVH 노드 형식
+ *
+ * 기본은 이진 BVH (t_bvh_node, double 빌드에서 노드당 80바이트)입니다.
+ * make BVH=wide로 빌드하면 이진 BVH를 4갈래로 합친 뒤 자식의 경계를
+ * 부모 상자 기준 8비트로 양자화한 64바이트 노드(t_qbvh_node, 캐시
+ * 라인 하나)로 바꿉니다. 노드 수가 약 1/3, 노드 크기가 약 0.8배가
+ * 되어 탐색 중 읽는 메모리가 줄어듭니다.
+ */
+# define QBVH_WIDTH 4
+# define QBVH_EMPTY INT_MIN
+# ifdef RT_BVH_WIDE
+#  define BVH_WIDE 1
+# else
+#  define BVH_WIDE 0
+# endif
+
+/*
+ * 균일 격자 (grid_build.c, grid_traverse.c)
+ *
+ * 물체가 고르게 퍼져 있고 크기가 비슷한 장면(입자 장면)에서는 장면
+ * 상자를 같은 크기의 칸으로 나눈 격자가 BVH보다 빠를 수 있습니다.
+ * 물체 하나당 약 GRID_DENSITY개의 칸을 만들고, 광선은 3D-DDA로 지나는
+ * 칸만 차례로 검사합니다. 만드는 시간은 물체 수에 비례합니다.
+ *
+ * ACCEL_AUTO이면 accel_select가 물체 수, 크기의 변동계수(표준편차 /
+ * 평균), 성긴 격자에서 칸별 물체 수의 변동계수로 격자와 BVH 중 하나를
+ * 고릅니다. 기준값은 tools/scenegen 장면에서 잰 결과입니다. 100개
+ * 이상인 uniform, clustered 장면은 격자가 1.2~2.6배 빨랐고,
+ * stadium 장면(크기 변동계수 약 2.6)은 BVH가 1.2~1.6배 빨랐습니다.
+ * 물체가 몇 개뿐인 장면은 격자가 5~10% 느립니다.
+ */
+# define GRID_DENSITY 2.0
+# define GRID_MAX_RES 256
+# define GRID_STAT_DENSITY 0.125
+# define GRID_MIN_OBJECTS 64
+# define GRID_MAX_SIZE_CV 1.0
+# define GRID_MAX_OCC_CV 3.0
+
+/*
+ * 화면 타일 후보 목록 (tile_project.c, tile_bins.c, tile_query.c)
+ *
+ * 카메라 광선은 모두 카메라 위치에서 출발하므로, 프레임마다 물체의
+ * 경계 상자를 화면에 한 번 투영해 TILE_SIZE × TILE_SIZE 픽셀 타일마다
+ * 광선이 만날 수 있는 물체의 목록을 만듭니다. 그 타일의 카메라 광선은
+ * 평면 배열과 이 목록만 검사합니다. 화면 밖이나 아주 작은 물체가 많은
+ * 장면에서 가속 구조 탐색을 건너뜁니다. 후보가 TILE_MAX_CANDIDATES
+ * 보다 많은 타일은 목록 대신 평소처럼 가속 구조를 탐색합니다.
+ * TILE_COLS, TILE_ROWS: 화면의 가로, 세로 타일 수
+ * TILE_COUNT: 화면의 타일 수 (타일 번호는 y * TILE_COLS + x)
+ */
+# define TILE_SIZE 16
+# define TILE_COLS ((WIDTH + TILE_SIZE - 1) / TILE_SIZE)
+# define TILE_ROWS ((HEIGHT + TILE_SIZE - 1) / TILE_SIZE)
+# define TILE_COUNT (TILE_COLS * TILE_ROWS)
+# define TILE_MAX_CANDIDATES 16
+
+typedef struct s_aabb
+{
+	t_vec3	min;
+	t_vec3	max;
+}	t_aabb;
+
+/*
+ * 균일 격자
+ * 칸 (x, y, z)의 번호는 (z * res[1] + y) * res[0] + x이고, 그 칸의
+ * 물체는 items[start[c]] ~ items[start[c + 1] - 1]입니다.
+ * 물체 항목은 (종류별 배열 내 번호) * PRIM_BOUNDED + 종류입니다.
+ */
+typedef struct s_grid
+{
+	t_aabb	box;
+	t_real	origin[3];
+	t_real	cell[3];
+	t_real	inv_cell[3];
+	int		res[3];
+	int		n_cells;
+	int		*start;
+	int		*items;
+	int		n_items;
+}	t_grid;
+
+/*
+ * 화면 타일 후보 목록 (타일마다 한 칸, TILE_COUNT칸)
+ * queries: NULL이 아니면 타일마다 tile_closest 호출 수를 더함 (테스트와
+ *          벤치마크가 채움, 한 타일은 한 스레드만 렌더링하므로 경쟁 없음)
+ * count: 타일의 후보 수, TILE_MAX_CANDIDATES보다 많으면 -1
+ * start: 타일 t의 후보는 items[start[t]] ~ items[start[t] + count[t] - 1]
+ * 항목 형식은 균일 격자와 같습니다.
+ */
+typedef struct s_tile_bins
+{
+	int	*count;
+	int	*start;
+	int	*items;
+	int	*queries;
+}	t_tile_bins;
+
+/* 3D-DDA 상태: 현재 칸, 축별 진행 방향, 다음 칸 경계까지의 t, 칸 폭의 t */
+typedef struct s_dda
+{
+	int		idx[3];
+	int		step[3];
+	t_real	next[3];
+	t_real	delta[3];
+}	t_dda;
+
+/*
+ * BVH 노드
+ * child: 내부 노드이면 왼쪽 자식의 번호 (오른쪽은 child + 1),
+ *        잎이면 -1
+ * first, count: 잎이 가진 종류별 물체의 배열 내 범위
+ */
+typedef struct s_bvh_node
+{
+	t_aabb	box;
+	int		child;
+	int		first[PRIM_BOUNDED];
+	int		count[PRIM_BOUNDED];
+}	t_bvh_node;
+
+/*
+ * 4갈래 양자화 노드 (64바이트)
+ * 자식 i의 a축 경계 = origin[a] + lo[a][i] (또는 hi[a][i]) * scale[a]
+ * origin, scale은 부모 상자로 정하며, 되돌린 상자는 항상 원래 자식
+ * 상자를 감쌉니다 (qbvh_quant.c).
+ * child[i]: 0 이상이면 노드 번호, QBVH_EMPTY이면 빈 칸,
+ *           그 밖의 음수이면 잎 번호 -(child + 1) (acc->leaves)
+ */
+typedef struct s_qbvh_node
+{
+	float			origin[3];
+	float			scale[3];
+	unsigned char	lo[3][QBVH_WIDTH];
+	unsigned char	hi[3][QBVH_WIDTH];
+	int				child[QBVH_WIDTH];
+}	t_qbvh_node;
+
+typedef struct s_bvh_leaf
+{
+	int	first[PRIM_BOUNDED];
+	int	count[PRIM_BOUNDED];
+}	t_bvh_leaf;
+
+/*
+ * 평면 배열 (Structure of Arrays)
+ * 점(px, py, pz)과 단위 법선(nx, ny, nz)을 성분별로 저장합니다.
+ * size는 PLANE_BLOCK의 배수이고, 남는 칸은 법선이 0입니다.
+ */
+typedef struct s_plane_soa
+{
+	t_real	*px;
+	t_real	*py;
+	t_real	*pz;
+	t_real	*nx;
+	t_real	*ny;
+	t_real	*nz;
+	int		size;
+}	t_plane_soa;
+
+/*
+ * 물체를 옮긴 뒤 BVH를 고치는 데 필요한 연결 정보 (bvh_refit.c)
+ * 처음 accel_refit을 부를 때 bvh_link가 만듭니다.
+ * parent: 노드의 부모 번호 (루트는 -1)
+ * leaf: 물체가 든 잎 노드 (prim_index 순서)
+ * area0: 노드를 마지막으로 만들었을 때의 표면적
+ * cost: 모든 노드의 표면적 × 가중치(내부 노드 1, 잎은 물체 수)의 합
+ * built: 만들었을 때의 cost / 루트 표면적 (SAH 비용)
+ */
+typedef struct s_bvh_refit
+{
+	int		*parent;
+	int		*leaf;
+	t_real	*area0;
+	t_real	cost;
+	t_real	built;
+}	t_bvh_refit;
+
+/*
+ * 종류별 물체 배열
+ * 기하 정보는 BVH 잎 순서대로 복사해 두고(연속 메모리),
+ * *_objs는 같은 번호의 원래 t_object (색상, 법선 계산용)를 가리킵니다.
+ * bounds: BVH에 들어간 모든 물체를 감싸는 상자 (배치의 경계 계산용)
+ * kind: 실제로 만든 구조 (ACCEL_LIST, ACCEL_BVH, ACCEL_GRID)
+ */
+typedef struct s_accel
+{
+	t_sphere	*spheres;
+	t_object	**sphere_objs;
+	int			n_spheres;
+	t_cylinder	*cylinders;
+	t_object	**cylinder_objs;
+	int			n_cylinders;
+	t_instance	*instances;
+	t_object	**instance_objs;
+	int			n_instances;
+	t_plane_soa	planes;
+	t_object	**plane_objs;
+	int			n_planes;
+	t_bvh_node	*nodes;
+	int			n_nodes;
+	t_qbvh_node	*wide;
+	int			n_wide;
+	t_bvh_leaf	*leaves;
+	int			n_leaves;
+	t_aabb		bounds;
+	t_grid		grid;
+	int			kind;
+	t_bvh_refit	refit;
+}	t_accel;
+
+/* BVH를 만드는 동안 물체 하나를 가리키는 항목 */
+typedef struct s_prim_ref
+{
+	t_object	*obj;
+	int			type;
+	t_aabb		box;
+	t_vec3		centroid;
+}	t_prim_ref;
+
+typedef struct s_bvh_bin
+{
+	t_aabb	box;
+	int		count;
+}	t_bvh_bin;
+
+/* 분할 후보: axis 축의 centroid를 BVH_BINS개 구간으로 나눈 경계 */
+typedef struct s_bvh_split
+{
+	int		axis;
+	t_real	min;
+	t_real	scale;
+	int		bin;
+	t_real	cost;
+}	t_bvh_split;
+
+/*
+ * tmp: refs와 같은 크기의 작업 공간
+ * max_depth: 0이면 모든 물체를 잎 하나에 넣음 (ACCEL_LIST)
+ */
+typedef struct s_bvh_build
+{
+	t_accel		*acc;
+	t_prim_ref	*refs;
+	t_prim_ref	*tmp;
+	int			fill[PRIM_BOUNDED];
+	int			max_depth;
+}	t_bvh_build;
+
+/*
+ * 다시 만들 하위 트리 (bvh_rebuild.c)
+ * lo, hi: 하위 트리의 종류별 물체가 차지하는 배열 범위 [lo, hi)
+ * last: 하위 트리에서 가장 큰 노드 번호 (루트만 있으면 0)
+ * count: 물체 수
+ * cost: 하위 트리 노드들이 refit.cost에 더한 값
+ */
+typedef struct s_subtree
+{
+	int		lo[PRIM_BOUNDED];
+	int		hi[PRIM_BOUNDED];
+	int		last;
+	int		count;
+	t_real	cost;
+}	t_subtree;
+
+/*
+ * 탐색 중 가장 가까운 교점 (종류와 배열 내 번호)
+ * obj: PRIM_INSTANCE일 때 배치 안에서 만난 그룹의 물체
+ */
+typedef struct s_hit_rec
+{
+	t_real		t;
+	int			type;
+	int			index;
+	t_object	*obj;
+}	t_hit_rec;
+
+typedef struct s_bvh_stack
+{
+	int		node[TRAV_STACK];
+	t_real	t[TRAV_STACK];
+	int		size;
+}	t_bvh_stack;
+
+typedef struct s_trav
+{
+	t_ray		ray;
+	t_vec3		inv_dir;
+	t_hit_rec	best;
+	int			any;
+}	t_trav;
+
+typedef int	(*t_prim_kernel)(t_accel *acc, int first, int count,
+	t_trav *tr);
+
+/* accel_build.c, accel_memory.c */
+t_accel	*build_accel(t_object *objects, int mode);
+void	free_accel(t_accel *acc);
+size_t	accel_bytes(t_accel *acc);
+
+/* bvh_bounds.c */
+t_aabb	aabb_empty(void);
+t_aabb	aabb_union(t_aabb a, t_aabb b);
+t_real	aabb_area(t_aabb box);
+int		prim_bounds(t_object *obj, t_aabb *box);
+
+/* bvh_sah.c, bvh_build.c, bvh_layout.c */
+t_real	vec_axis(t_vec3 v, int axis);
+int		bvh_find_split(t_bvh_build *b, int start, int end,
+			t_bvh_split *split);
+int		bvh_build(t_bvh_build *b, int count);
+void	bvh_leaf(t_bvh_build *b, t_bvh_node *node, int start, int end);
+
+/* plane_pass.c */
+int		plane_soa_init(t_plane_soa *soa, int n);
+void	plane_soa_set(t_plane_soa *soa, int i, t_plane *pl);
+int		plane_pass(t_accel *acc, t_trav *tr);
+
+/* accel_query.c, bvh_traverse.c, prim_kernels.c, instance_hit.c */
+int		accel_trace(t_accel *acc, t_trav *tr);
+void	accel_resolve(t_accel *acc, t_hit_rec *rec, t_hit *hit);
+int		accel_closest(t_accel *acc, t_ray ray, t_hit *hit);
+int		accel_occluded(t_accel *acc, t_ray ray, t_real tmax);
+int		kernel_spheres(t_accel *acc, int first, int count, t_trav *tr);
+int		kernel_cylinders(t_accel *acc, int first, int count, t_trav *tr);
+int		kernel_instances(t_accel *acc, int first, int count, t_trav *tr);
+int		instance_bounds(t_instance *inst, t_aabb *box);
+int		instance_hit(t_instance *inst, int index, t_trav *tr);
+int		bvh_traverse(t_accel *acc, t_trav *tr);
+int		bvh_visit_leaf(t_accel *acc, int *first, int *count, t_trav *tr);
+
+/* accel_select.c, grid_build.c, grid_traverse.c */
+int		accel_mode_from_name(char *name);
+char	*accel_kind_name(int kind);
+int		accel_select(t_bvh_build *b, int count, int mode);
+void	grid_setup(t_grid *g, t_aabb box, t_real density, int count);
+void	grid_cell_coord(t_grid *g, t_vec3 p, int *idx);
+int		grid_build(t_bvh_build *b, int count);
+int		grid_traverse(t_accel *acc, t_trav *tr);
+int		prim_item(t_accel *acc, int item, t_trav *tr);
+
+/* bvh_link.c, bvh_refit.c, bvh_rebuild.c */
+int		prim_index(t_accel *acc, int type, int slot);
+t_object	*prim_object(t_accel *acc, int type, int slot);
+t_real	node_weight(t_bvh_node *node);
+int		bvh_link(t_accel *acc);
+void	bvh_link_subtree(t_accel *acc, int node, int parent);
+int		bvh_rebuild_subtree(t_accel *acc, int node);
+int		accel_refit(t_accel *acc, t_object **moved, int n, t_real limit);
+
+/* tile_project.c, tile_bins.c, tile_query.c */
+int		project_point(t_camera *cam, t_vec3 p, t_real *xy);
+int		tile_px_rect(t_real *px, int *rect);
+int		tile_rect(t_camera *cam, t_aabb *box, int *rect);
+int		tile_bins_build(t_tile_bins *bins, t_scene *scene);
+void	tile_bins_free(t_tile_bins *bins);
+t_hit	tile_closest(t_scene *scene, t_tile_bins *bins, int tile, t_ray ray);
+
+/* qbvh_quant.c, qbvh_build.c, qbvh_traverse.c */
+void	qbvh_set_frame(t_qbvh_node *q, t_aabb *box);
+void	qbvh_quantize(t_qbvh_node *q, int slot, t_aabb *box);
+int		qbvh_build(t_accel *acc);
+int		qbvh_traverse(t_accel *acc, t_trav *tr);
+
+#endif
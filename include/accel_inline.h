@@ -0,0 +1,113 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   accel_inline.h                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef ACCEL_INLINE_H
+# define ACCEL_INLINE_H
+
+# include "accel.h"
+# include "vec3_inline.h"
+# include <math.h>
+
+/*
+ * BVH 탐색의 헤더 인라인 함수
+ *
+ * 이진 BVH(bvh_traverse.c)와 4갈래 양자화 BVH(qbvh_traverse.c)가
+ * 같은 상자 검사를 쓰므로, 노드마다 호출되는 함수를 여기에 둡니다.
+ */
+
+/*
+ * slab_axis - 한 축의 두 평면 사이 구간으로 range를 좁히기
+ * @lo: min 평면까지의 t
+ * @hi: max 평면까지의 t
+ * @range: 현재 구간 [near, far] (갱신)
+ *
+ * 방향 성분이 0이면 0 * inf = NaN이 생길 수 있는데, NaN과의 비교는
+ * 항상 거짓이므로 그 값은 구간을 좁히지 않습니다.
+ * fmin/fmax는 라이브러리 호출이 되므로 비교문으로 씁니다.
+ */
+static inline void	slab_axis(t_real lo, t_real hi, t_real *range)
+{
+	t_real	tmp;
+
+	if (lo > hi)
+	{
+		tmp = lo;
+		lo = hi;
+		hi = tmp;
+	}
+	if (lo > range[0])
+		range[0] = lo;
+	if (hi < range[1])
+		range[1] = hi;
+}
+
+/*
+ * slab_test - 광선과 상자의 교차 구간 (slab 방법)
+ * @box: 상자
+ * @tr: 탐색 상태 (광선, 방향의 역수, 현재까지의 최단 거리)
+ *
+ * 각 축마다 두 평면 사이를 지나는 t 구간을 구해 교집합을 취합니다.
+ * 이미 찾은 교점보다 먼 상자는 만나지 않는 것으로 봅니다.
+ *
+ * Return: 상자에 들어가는 t (0 이상), 만나지 않으면 INFINITY
+ */
+static inline t_real	slab_test(t_aabb *box, t_trav *tr)
+{
+	t_vec3	lo;
+	t_vec3	hi;
+	t_real	range[2];
+
+	lo = v3_sub(box->min, tr->ray.origin);
+	hi = v3_sub(box->max, tr->ray.origin);
+	range[0] = 0;
+	range[1] = tr->best.t;
+	slab_axis(lo.x * tr->inv_dir.x, hi.x * tr->inv_dir.x, range);
+	slab_axis(lo.y * tr->inv_dir.y, hi.y * tr->inv_dir.y, range);
+	slab_axis(lo.z * tr->inv_dir.z, hi.z * tr->inv_dir.z, range);
+	if (range[0] > range[1])
+		return (INFINITY);
+	return (range[0]);
+}
+
+/*
+ * qbvh_dequant - 양자화된 경계 하나를 실수 좌표로 되돌리기
+ * @q: 4갈래 노드
+ * @axis: 0 (x), 1 (y), 2 (z)
+ * @code: 0 ~ 255의 양자화 값
+ *
+ * 빌드(qbvh_quant.c)와 탐색이 같은 식을 쓰므로, 빌드 때 확인한
+ * "되돌린 상자가 원래 상자를 감싼다"는 조건이 탐색에서도 성립합니다.
+ *
+ * Return: origin + code * scale
+ */
+static inline t_real	qbvh_dequant(const t_qbvh_node *q, int axis, int code)
+{
+	return ((t_real)q->origin[axis] + code * (t_real)q->scale[axis]);
+}
+
+/*
+ * qbvh_child_box - slot번째 자식의 (보수적인) 경계 상자
+ * @q: 4갈래 노드
+ * @slot: 0 ~ QBVH_WIDTH - 1
+ * @box: 상자 (출력)
+ */
+static inline void	qbvh_child_box(const t_qbvh_node *q, int slot, t_aabb *box)
+{
+	box->min.x = qbvh_dequant(q, 0, q->lo[0][slot]);
+	box->min.y = qbvh_dequant(q, 1, q->lo[1][slot]);
+	box->min.z = qbvh_dequant(q, 2, q->lo[2][slot]);
+	box->max.x = qbvh_dequant(q, 0, q->hi[0][slot]);
+	box->max.y = qbvh_dequant(q, 1, q->hi[1][slot]);
+	box->max.z = qbvh_dequant(q, 2, q->hi[2][slot]);
+}
+
+#endif
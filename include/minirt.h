@@ -15,12 +15,48 @@
 
 # include <stdio.h>
 # include <stdlib.h>
+# include <sys/types.h>
 
 # define WIDTH 800
 # define HEIGHT 600
 # define OBJ_SPHERE 1
 # define OBJ_PLANE 2
 # define OBJ_CYLINDER 3
+# define OBJ_INSTANCE 4
+
+/* 가속 구조 선택 (--accel): 자동, 없음(전체 검사), BVH, 균일 격자 */
+# define ACCEL_AUTO 0
+# define ACCEL_LIST 1
+# define ACCEL_BVH 2
+# define ACCEL_GRID 3
+/*
+ * 물체를 옮긴 뒤 scene_update가 BVH를 다시 만드는 기준:
+ * SAH 비용이 만들 때의 REFIT_DEFAULT_LIMIT배를 넘으면 전체를,
+ * 표면적이 만들 때의 그만큼 커진 노드는 그 아래만 다시 만듭니다.
+ */
+# define REFIT_DEFAULT_LIMIT 1.5
+/*
+ * 픽셀 순서 (--order): 타일 안 행 순서, 화면 전체 행 순서, 타일 안
+ * Z-곡선(Morton), 타일 안 Hilbert 곡선 (pixel_order.c)
+ */
+# define ORDER_TILE 0
+# define ORDER_SCANLINE 1
+# define ORDER_MORTON 2
+# define ORDER_HILBERT 3
+/*
+ * WASD 키 한 번에 카메라가 움직이는 거리: 유한한 물체를 모두 감싸는
+ * 상자 대각선의 CAMERA_STEP_RATIO배 (camera_move.c)
+ */
+# define CAMERA_STEP_RATIO 0.02
+/*
+ * 다시 읽은 장면과 지금 장면의 차이 (scene_diff, 비트 합):
+ * 카메라, 광원이나 환경광, 물체의 값, 물체나 그룹의 구성(개수, 종류,
+ * 순서)
+ */
+# define DIFF_CAMERA 1
+# define DIFF_LIGHTS 2
+# define DIFF_OBJECTS 4
+# define DIFF_SHAPE 8
 
 /* Platform-specific key codes */
 # ifdef __APPLE__
@@ -29,31 +65,69 @@
 #  define KEY_A 0
 #  define KEY_S 1
 #  define KEY_D 2
+#  define KEY_R 15
 #  define EVENT_CLOSE 17
 #  define EVENT_EXPOSE 12
+#  define EVENT_KEY_PRESS 2
 # elif __linux__
 #  define KEY_ESC 65307
 #  define KEY_W 119
 #  define KEY_A 97
 #  define KEY_S 115
 #  define KEY_D 100
+#  define KEY_R 114
 #  define EVENT_CLOSE 17
 #  define EVENT_EXPOSE 12
+#  define EVENT_KEY_PRESS 2
 # else
 #  define KEY_ESC 53
 #  define KEY_W 13
 #  define KEY_A 0
 #  define KEY_S 1
 #  define KEY_D 2
+#  define KEY_R 15
 #  define EVENT_CLOSE 17
 #  define EVENT_EXPOSE 12
+#  define EVENT_KEY_PRESS 2
+# endif
+
+/*
+ * 렌더링 코어의 실수 타입
+ *
+ * 기본은 double입니다. make PRECISION=float로 빌드하면 RT_FLOAT가
+ * 정의되어 벡터, 광선, 교점 계산이 모두 float로 바뀝니다.
+ * float는 유효 자릿수가 약 7자리뿐이므로 허용 오차를 함께 키웁니다.
+ *
+ * RT_EPSILON: 평행 판정과 최소 교점 거리
+ * RT_ORIGIN_BIAS: 표면에서 출발하는 광선(그림자 광선)의 원점을 법선
+ *                 방향으로 밀어내는 거리, 좌표의 크기에 비례해 적용
+ * RT_REL_EPS: 타입의 기계 엡실론 (차등 테스트 허용치 계산용)
+ */
+# ifdef RT_FLOAT
+
+typedef float	t_real;
+#  define RT_EPSILON 1e-4f
+#  define RT_ORIGIN_BIAS 2e-5f
+#  define RT_REL_EPS 1.2e-7
+#  define RT_SQRT sqrtf
+#  define RT_FABS fabsf
+#  define RT_TAN tanf
+# else
+
+typedef double	t_real;
+#  define RT_EPSILON 1e-6
+#  define RT_ORIGIN_BIAS 0.0
+#  define RT_REL_EPS 2.2e-16
+#  define RT_SQRT sqrt
+#  define RT_FABS fabs
+#  define RT_TAN tan
 # endif
 
 typedef struct s_vec3
 {
-	double	x;
-	double	y;
-	double	z;
+	t_real	x;
+	t_real	y;
+	t_real	z;
 }	t_vec3;
 
 typedef struct s_ray
@@ -62,39 +136,53 @@ typedef struct s_ray
 	t_vec3	direction;
 }	t_ray;
 
+/*
+ * 아래 구조체에서 "prepare_scene" 주석이 붙은 필드는 파서가 채우지
+ * 않고, 파싱 후 prepare_scene이 한 번 계산해 두는 값입니다.
+ * 렌더링 경로는 원본 필드 대신 이 값을 읽습니다.
+ */
 typedef struct s_camera
 {
 	t_vec3	position;
 	t_vec3	orientation;
 	int		fov;
+	t_vec3	right;
+	t_vec3	up;
+	t_vec3	forward;
+	t_real	tan_half_fov;
 }	t_camera;
 
 typedef struct s_ambient
 {
-	double	ratio;
+	t_real	ratio;
 	t_vec3	color;
+	t_vec3	term;
 }	t_ambient;
 
 typedef struct s_light
 {
 	t_vec3			position;
-	double			ratio;
+	t_real			ratio;
 	t_vec3			color;
+	t_vec3			radiance;
 	struct s_light	*next;
 }	t_light;
 
+/* accel_slot: 가속 구조의 종류별 배열에서의 번호 (build_accel이 채움) */
 typedef struct s_object
 {
 	void			*object;
 	int				type;
 	t_vec3			color;
+	int				accel_slot;
 	struct s_object	*next;
 }	t_object;
 
 typedef struct s_sphere
 {
 	t_vec3	center;
-	double	radius;
+	t_real	radius;
+	t_real	radius2;
 }	t_sphere;
 
 typedef struct s_plane
@@ -107,39 +195,142 @@ typedef struct s_cylinder
 {
 	t_vec3	center;
 	t_vec3	axis;
-	double	diameter;
-	double	height;
+	t_real	diameter;
+	t_real	height;
+	t_real	radius;
+	t_real	radius2;
+	t_real	half_height;
+	t_real	bound2;
+	t_vec3	u;
+	t_vec3	v;
 }	t_cylinder;
 
+/*
+ * 그룹: .rt 파일의 group NAME ... end 사이에 정의한 물체 목록
+ * 로컬 좌표계의 물체를 한 번만 저장하고, prepare_scene이 그룹마다
+ * 가속 구조(accel) 하나를 만들어 모든 배치(instance)가 공유합니다.
+ */
+typedef struct s_group
+{
+	char			*name;
+	t_object		*objects;
+	struct s_accel	*accel;
+	struct s_group	*next;
+}	t_group;
+
+/*
+ * 배치: inst NAME position axis scale
+ * 그룹의 로컬 +y축을 axis로 돌리고 scale배 한 뒤 position으로 옮깁니다.
+ * u, axis, w는 prepare_instance가 만드는 직교 좌표계이며
+ * 세계 → 로컬 변환은 각 축과의 내적을 inv_scale배 한 값입니다.
+ */
+typedef struct s_instance
+{
+	t_group	*group;
+	t_vec3	position;
+	t_vec3	axis;
+	t_real	scale;
+	t_real	inv_scale;
+	t_vec3	u;
+	t_vec3	w;
+}	t_instance;
+
+/*
+ * accel: prepare_scene이 만드는 가속 구조 (include/accel.h)
+ * accel_mode: 만들 가속 구조 (ACCEL_*, 기본은 ACCEL_AUTO)
+ * refit_limit: scene_update의 재구성 기준 (기본은 REFIT_DEFAULT_LIMIT)
+ * pixel_order: render_scene이 픽셀을 도는 순서 (ORDER_*, 기본은 ORDER_TILE)
+ * antialias: 1이면 가장자리 픽셀만 더 샘플링 (--aa, render_aa.c)
+ * open_group: 파싱 중 아직 end로 닫히지 않은 그룹
+ * invalid: 파싱 중 만난 잘못된 줄 수 (하나라도 있으면 장면을 버림)
+ */
 typedef struct s_scene
 {
-	t_camera	camera;
-	t_light		*lights;
-	t_object	*objects;
-	t_ambient	*ambient_light;
+	t_camera		camera;
+	t_light			*lights;
+	t_object		*objects;
+	t_ambient		*ambient_light;
+	struct s_accel	*accel;
+	int				accel_mode;
+	t_real			refit_limit;
+	int				pixel_order;
+	int				antialias;
+	t_group			*groups;
+	t_group			*open_group;
+	int				invalid;
 }	t_scene;
 
+/* instance: 배치 안의 물체와 만났으면 그 배치, 아니면 NULL */
 typedef struct s_hit
 {
-	double		t;
+	t_real		t;
 	t_vec3		point;
 	t_vec3		normal;
 	t_object	*object;
+	t_instance	*instance;
 }	t_hit;
 
+/*
+ * 장면 파일 감시 (--watch, scene_watch.c)
+ * fd: inotify 기술자 (inotify가 없는 시스템은 -1), name: 디렉터리를
+ * 뺀 파일 이름, mtime: 마지막으로 본 수정 시각 (inotify가 없을 때),
+ * camera: 마지막으로 읽은 파일의 카메라
+ */
+typedef struct s_watch
+{
+	int			fd;
+	char		*path;
+	char		*name;
+	time_t		mtime;
+	t_camera	camera;
+}	t_watch;
+
+/*
+ * 커맨드 라인 옵션 (check_args)
+ * accel_mode: --accel로 고른 가속 구조 (ACCEL_*, 기본은 ACCEL_AUTO)
+ * pixel_order: --order로 고른 픽셀 순서 (ORDER_*, 기본은 ORDER_TILE)
+ * progressive, gbuffer, watch, antialias: 그 옵션이 있으면 1
+ * budget_ms: --time-budget의 밀리초 (없으면 0)
+ * start: check_args를 부른 시각 (view_now 기준 ms, 예산은 여기서 잼)
+ * 잘못된 값이면 accel_mode, pixel_order, budget_ms가 음수가 됩니다.
+ */
+typedef struct s_options
+{
+	int		accel_mode;
+	int		pixel_order;
+	int		progressive;
+	int		gbuffer;
+	int		watch;
+	int		antialias;
+	int		budget_ms;
+	double	start;
+}	t_options;
+
+/*
+ * progress: --progressive로 렌더링 중이면 그 상태 (include/render.h)
+ * pool: 백그라운드 렌더링 작업 스레드 (include/render.h)
+ * scene_path: 장면 파일 경로 (R 키로 광원을 다시 읽을 때)
+ * watch: --watch이면 장면 파일 감시, 아니면 NULL
+ */
 typedef struct s_mlx_data
 {
-	void	*mlx;
-	void	*win;
-	void	*img;
-	int		*img_data;
-	int		bpp;
-	int		size_line;
-	int		endian;
-	int		img_displayed;
+	void				*mlx;
+	void				*win;
+	void				*img;
+	int					*img_data;
+	int					bpp;
+	int					size_line;
+	int					endian;
+	int					img_displayed;
+	struct s_progress	*progress;
+	struct s_pool		*pool;
+	char				*scene_path;
+	t_watch				*watch;
 }	t_mlx_data;
 
 t_scene		*parse_scene(char *filename);
+t_scene		*parse_scene_buffer(char *buffer, ssize_t bytes);
+char		*read_file(int fd, ssize_t *len);
 t_vec3		parse_vec3(char *str);
 t_vec3		parse_color(char *str);
 void		parse_ambient(char **parts, t_scene *scene);
@@ -148,14 +339,52 @@ void		parse_light(char **parts, t_scene *scene);
 void		parse_sphere(char **parts, t_scene *scene);
 void		parse_plane(char **parts, t_scene *scene);
 void		parse_cylinder(char **parts, t_scene *scene);
+int			parse_fields(char **parts);
+void		parse_element(char **parts, t_scene *scene);
+void		parse_group_line(char **parts, t_scene *scene);
+void		parse_group_end(t_scene *scene);
+
+void		prepare_scene(t_scene *scene);
+void		prepare_shapes(t_scene *scene);
+void		prepare_accel(t_scene *scene);
+void		prepare_camera(t_camera *camera);
+void		prepare_lights(t_scene *scene);
+int			scene_reload_lights(t_scene *scene, char *path);
+int			scene_diff(t_scene *scene, t_scene *fresh);
+int			object_diff(t_object *a, t_object *b);
+int			scene_adopt_objects(t_scene *scene, t_scene *fresh,
+				t_object **moved, t_object **old);
+void		scene_adopt(t_scene *scene, t_scene *fresh, int diff);
+t_watch		*watch_start(char *path, t_camera *camera);
+int			watch_poll(t_watch *w);
+void		watch_stop(t_watch *w);
+int			scene_update(t_scene *scene, t_object **moved, int n);
+int			scene_refit(t_scene *scene, t_object **moved, int n);
+void		prepare_object(t_object *obj);
+void		prepare_sphere(t_sphere *sp);
+void		prepare_plane(t_plane *pl);
+void		prepare_cylinder(t_cylinder *cy);
+void		prepare_instance(t_instance *inst);
+int			camera_move(t_scene *scene, int keycode);
+int			camera_equal(t_camera *a, t_camera *b);
+t_vec3		instance_point_to_local(t_instance *inst, t_vec3 p);
+t_vec3		instance_dir_to_local(t_instance *inst, t_vec3 d);
+t_vec3		instance_dir_to_world(t_instance *inst, t_vec3 d);
 
-t_ray		get_ray(t_camera camera, int i, int j, int w);
-double		intersect_sphere(t_ray ray, t_sphere *sphere);
-double		intersect_plane(t_ray ray, t_plane *plane);
-double		intersect_cylinder(t_ray ray, t_cylinder *cylinder);
+t_ray		get_ray(t_camera *camera, int i, int j, int w);
+t_ray		get_ray_at(t_camera *camera, double px, double py);
+t_vec3		offset_ray_origin(t_vec3 point, t_vec3 normal, t_vec3 dir);
+t_real		intersect_sphere(t_ray ray, t_sphere *sphere);
+t_real		intersect_plane(t_ray ray, t_plane *plane);
+t_real		intersect_cylinder(t_ray ray, t_cylinder *cylinder);
 t_hit		find_closest_intersection(t_scene *scene, t_ray ray);
+int			scene_occluded(t_scene *scene, t_ray ray, t_real tmax);
 t_vec3		calculate_lighting(t_scene *scene, t_hit hit);
+int			shade_hit(t_scene *scene, t_ray ray, t_hit *hit, t_vec3 *color);
+int			trace_ray(t_scene *scene, t_ray ray, t_vec3 *color);
 void		render_scene(t_scene *scene, t_mlx_data *data);
+int			pixel_order_from_name(char *name);
+int			check_args(int argc, char **argv, t_options *opt);
 
 t_mlx_data	*init_mlx(void);
 void		display_image(t_mlx_data *data);
@@ -166,5 +395,6 @@ int			close_window(t_mlx_data *data);
 int			vec3_to_color(t_vec3 color);
 void		free_scene(t_scene *scene);
 void		save_to_bmp(t_mlx_data *data, char *filename);
+int			bmp_write(int *pixels, int width, int height, char *filename);
 
 #endif
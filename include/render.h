@@ -0,0 +1,343 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   render.h                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef RENDER_H
+# define RENDER_H
+
+# include "minirt.h"
+# include "accel.h"
+# include <pthread.h>
+
+/*
+ * 점진적 렌더링 (--progressive, render_progressive.c)
+ *
+ * PROGRESSIVE_START 픽셀 블록마다 한 샘플로 화면 전체를 먼저 채우고,
+ * 블록 크기를 반씩 줄여 전체 해상도까지 다듬습니다. 앞 단계에서 계산한
+ * 샘플은 다시 계산하지 않으므로 모든 단계를 합한 샘플 수는 전체
+ * 해상도 한 번과 같습니다. loop_hook이 한 번에 PROGRESSIVE_BATCH
+ * 샘플씩 렌더링하고 창에 표시합니다. PROGRESSIVE_BATCH는 첫 단계
+ * (1/8 해상도)의 블록 수이므로 첫 단계는 한 번의 호출로 끝나고, 창은
+ * 계속 입력에 반응합니다.
+ */
+# define PROGRESSIVE_START 8
+# define PROGRESSIVE_BATCH ((WIDTH + 7) / 8 * ((HEIGHT + 7) / 8))
+
+/*
+ * 백그라운드 렌더링 (render_pool.c, render_swap.c)
+ *
+ * 작업 스레드들이 타일을 하나씩 가져가 back 버퍼에 렌더링하고,
+ * loop_hook이 다 끝난 타일만 창의 이미지로 옮깁니다 (pool_swap).
+ * 그동안 mlx_loop는 계속 돌아 키 입력에 바로 반응합니다. 새 입력이
+ * 들어오면 pool_render가 지금 프레임을 취소하고 새 프레임을
+ * 시작합니다. 작업 스레드는 타일 사이에서만 취소를 확인하므로
+ * 기다리는 시간은 타일 하나를 렌더링하는 시간 이하입니다.
+ * POOL_MAX_THREADS: 작업 스레드 수의 상한 (기본은 CPU 코어 수)
+ * 타일 번호의 범위는 TILE_COUNT입니다 (accel.h).
+ */
+# define POOL_MAX_THREADS 64
+
+/*
+ * 카메라 이동 중의 해상도 (render_view.c)
+ *
+ * WASD로 카메라를 옮기는 동안에는 scale × scale 블록마다 한 샘플만
+ * 렌더링하고 블록을 그 색으로 채웁니다 (내부 해상도 1/scale). scale은
+ * 최근 프레임에서 잰 샘플당 시간으로, 한 프레임이 VIEW_TARGET_MS
+ * 안에 끝나는 가장 작은 2의 거듭제곱 (VIEW_MAX_SCALE 이하)입니다.
+ * 입력이 멈추면 프레임이 끝날 때마다 scale을 반으로 줄여 전체
+ * 해상도로 돌아갑니다. VIEW_MAX_SCALE은 TILE_SIZE의 약수여야 합니다.
+ */
+# define VIEW_TARGET_MS 33
+# define VIEW_MAX_SCALE 8
+
+/*
+ * 시간 재투영 (render_history.c, render_reproject.c)
+ *
+ * 픽셀마다 마지막으로 계산한 샘플의 교점, 물체, 색을 기억합니다. 새
+ * 프레임을 시작할 때 기억한 교점을 새 카메라로 투영해, 교점이 들어가는
+ * 샘플 픽셀로 옮겨 둡니다 (여러 개면 카메라에 가장 가까운 것).
+ * 카메라가 움직이는 동안은 옮겨 온 교점이 있는 픽셀에서 카메라와
+ * 교점 사이를 가리는 물체가 있는지만 확인하고 (history_visible) 색을
+ * 다시 씁니다. 조명에 보는 방향이 들어가지 않으므로 색은 그대로
+ * 맞고, 위치만 픽셀 안에서 조금 어긋납니다. 옮겨 온 교점이 없거나
+ * (새로 드러난 곳) 가려졌으면 광선을 다시 추적합니다.
+ * 카메라가 멈춘 뒤에는 같은 카메라로 같은 픽셀을 추적한 기록만 다시
+ * 쓰므로, 완성된 이미지는 처음부터 렌더링한 것과 같습니다.
+ * HISTORY_EPSILON: 가림 검사 광선을 교점 앞에서 멈추는 비율 (자기
+ * 자신과 만나지 않도록)
+ */
+# define HISTORY_EPSILON 1e-4
+
+/*
+ * G-버퍼 (--gbuffer, render_frame.c)
+ *
+ * 작업 스레드가 추적한 샘플의 교점(t_hit: 교점, 법선, 물체, 배치)을
+ * 픽셀마다 기억합니다. 카메라가 그대로이고 광원이나 환경광만 바뀌면
+ * (R 키로 장면 파일의 A, L 줄을 다시 읽음) 광선 추적과 법선 계산을
+ * 건너뛰고 기억한 교점으로 calculate_lighting만 다시 부릅니다
+ * (pool_relight). 결과는 처음부터 렌더링한 것과 같습니다.
+ * 픽셀당 sizeof(t_hit) 바이트를 더 쓰므로 켤 때만 할당합니다.
+ */
+
+/*
+ * 바뀐 물체 주변만 다시 렌더링 (render_damage.c, render_dirty.c)
+ *
+ * 물체 하나를 바꾸면 그 물체의 옛 경계 상자와 새 경계 상자에 닿을
+ * 수 있는 광선의 픽셀만 달라집니다. 카메라 광선은 상자의 투영 안을
+ * 지나고, 그림자 광선은 광원마다 상자 뒤로 드리운 그림자 영역 안의
+ * 교점에서 나갑니다. 이 영역들을 화면에 투영한 타일을 표시하고
+ * (damage_object), 앞 프레임에서 이미 창에 옮긴 나머지 타일은 그대로
+ * 둔 채 표시한 타일만 다시 렌더링합니다 (pool_damage).
+ */
+
+/*
+ * 장면 파일 다시 읽기 (--watch, render_reload.c)
+ *
+ * 장면 파일이 저장될 때마다 (watch_poll) 파일을 다시 읽어 지금 장면과
+ * 비교하고 (scene_diff), 바뀐 부분만 옮겨 가장 싼 방법으로 다시
+ * 렌더링합니다 (pool_reload). 물체 값만 바뀌면 그 물체만 옮기고
+ * BVH를 고친 뒤 (scene_update) 주변 타일만, 광원만 바뀌면 조명만,
+ * 카메라만 바뀌면 카메라를 옮길 때처럼 재투영으로 렌더링합니다.
+ * 물체의 개수나 순서가 바뀌면 가속 구조를 새로 만듭니다.
+ */
+
+/*
+ * 가장자리 안티앨리어싱 (--aa, render_aa.c)
+ *
+ * 전체 해상도 프레임을 픽셀당 한 샘플로 끝낸 뒤, 오른쪽이나 아래
+ * 이웃과 G-버퍼의 물체(배치)가 다르거나, 법선의 내적이 AA_NORMAL_COS
+ * 보다 작거나, 색 채널의 차이가 AA_COLOR_DIFF보다 큰 픽셀 쌍을
+ * 가장자리로 표시합니다 (aa_edges). 표시한 픽셀만 픽셀 안의 회전 격자
+ * 위치 AA_SAMPLES곳에서 다시 샘플링해 평균하고, 가장자리가 없는 타일은
+ * 그대로 둡니다. 평평한 면은 샘플이 늘지 않으므로 모든 픽셀을
+ * AA_SAMPLES번 샘플링할 때보다 추가 샘플이 훨씬 적습니다.
+ */
+# define AA_NORMAL_COS 0.9
+# define AA_COLOR_DIFF 24
+# define AA_SAMPLES 4
+
+/*
+ * 시간 예산 (--time-budget, render_budget.c)
+ *
+ * 정해진 품질 대신 마감 시각까지 렌더링합니다. 마감은 프로그램을
+ * 시작한 시각부터 재므로 파싱과 가속 구조를 만드는 시간도 들어갑니다.
+ * 첫 프레임은 타일마다 샘플 하나인 BUDGET_FIRST_SCALE 해상도로 화면
+ * 전체를 채웁니다 (TILE_COUNT 샘플). 그 프레임으로 잰 샘플당 시간으로
+ * 남은 시간 안에 끝나는 가장 높은 해상도를 골라 (view_refine) 다음
+ * 프레임을 렌더링하고, 남는 시간에 해상도를 올리고 가장자리
+ * 안티앨리어싱까지 이어갑니다.
+ * 각 프레임은 앞 프레임에서 색의 분산이 큰 타일부터 렌더링하므로
+ * (budget_order) 마감에 끊기면 남은 시간은 분산이 큰 타일에 쓰인
+ * 것입니다. 마감이 되면 작업 스레드를 멈추고 창 이미지를 저장합니다.
+ * 창 이미지는 끝난 타일만 옮기므로 항상 완성된 이미지입니다. 마감
+ * 전의 여유는 BUDGET_SLACK_MS에 지금 타일 하나를 끝내는 예상 시간을
+ * 더한 것입니다. BUDGET_FIRST_SCALE은 TILE_SIZE의 약수여야 합니다.
+ */
+# define BUDGET_SLACK_MS 20
+# define BUDGET_FIRST_SCALE TILE_SIZE
+
+/*
+ * 샘플 하나의 기록
+ * point: 교점 (세계 좌표), object: 만난 물체 (NULL이면 기록 없음)
+ * color: 샘플 색 (0xRRGGBB)
+ * epoch: 추적할 때의 t_history.epoch, 다른 카메라에서 옮겨 왔으면 -1
+ */
+typedef struct s_reuse
+{
+	t_vec3		point;
+	t_object	*object;
+	int			color;
+	int			epoch;
+}	t_reuse;
+
+/*
+ * 재투영 기록
+ * last: 픽셀마다 마지막으로 계산한 샘플
+ * map: 이번 프레임의 샘플 픽셀로 옮겨 온 기록 (history_reproject)
+ * epoch: 카메라를 옮길 때마다 1씩 늘리는 번호
+ * moving: 1이면 다른 카메라의 기록도 가림 검사 후 다시 씀
+ */
+typedef struct s_history
+{
+	t_reuse	*last;
+	t_reuse	*map;
+	int		epoch;
+	int		moving;
+}	t_history;
+
+/*
+ * 한 프레임의 렌더링 상태 (render.c, render_frame.c)
+ *
+ * frame_begin이 프레임마다 한 번 채우고 모든 픽셀이 함께 씁니다.
+ * pixels: 결과를 저장할 이미지 (WIDTH × HEIGHT)
+ * scale: 1이면 모든 픽셀, 2 이상이면 scale × scale 블록마다 한 샘플
+ * history: 재투영 기록 (NULL이면 모든 샘플을 추적)
+ * gbuf: 추적한 샘플의 교점을 기록할 G-버퍼 (NULL이면 기록하지 않음)
+ * relight: 1이면 추적하지 않고 gbuf의 교점으로 조명만 계산
+ * edges: 안티앨리어싱 단계이면 픽셀별 가장자리 표시 (aa_edges), 아니면
+ *        NULL
+ * bins: 현재 카메라의 타일 후보 목록 (만들 수 없으면 count가 NULL)
+ * order: 타일 안 k번째로 렌더링할 픽셀 (y × TILE_SIZE + x,
+ *        pixel_order_table)
+ */
+typedef struct s_frame
+{
+	t_scene		*scene;
+	int			*pixels;
+	int			scale;
+	t_history	*history;
+	t_hit		*gbuf;
+	int			relight;
+	char		*edges;
+	t_tile_bins	bins;
+	int			order[TILE_SIZE * TILE_SIZE];
+}	t_frame;
+
+/*
+ * 점진적 렌더링 상태
+ * step: 지금 단계의 블록 크기 (PROGRESSIVE_START, ..., 2, 1), 끝나면 0
+ * next: 지금 단계에서 다음에 계산할 블록 번호 (블록 행 순서)
+ */
+typedef struct s_progress
+{
+	t_frame	frame;
+	int		step;
+	int		next;
+}	t_progress;
+
+/*
+ * 렌더링 작업 스레드 묶음
+ * frame: 지금 프레임 (frame.pixels는 back)
+ * back: 작업 스레드가 렌더링하는 이미지 (WIDTH × HEIGHT)
+ * done: 타일별 상태 (0 렌더링 전, 1 끝남, 2 창 이미지로 옮김)
+ * queue: 이번 프레임에 렌더링할 타일들, n_queue: 그 수 (damage_apply)
+ * next: 다음에 가져갈 queue의 번호, shown: 창 이미지로 옮긴 타일 수
+ * active: 타일을 렌더링 중인 스레드 수
+ * cancel: 1이면 타일을 더 가져가지 않음, quit: 1이면 스레드 종료
+ * lock: 위 상태를 보호 (shown은 메인 스레드만 씀)
+ * wake: 새 프레임이나 종료를 알림, idle: active가 0이 됨을 알림
+ * scale: 다음 pool_render의 frame.scale
+ * started: 지금 프레임을 시작한 시각 (ms, 시간을 재고 나면 0)
+ * sample_ms: 최근 프레임들의 샘플당 렌더링 시간 (아직 모르면 0)
+ * history: 프레임 사이의 재투영 기록
+ * gbuf: G-버퍼 (pool_gbuffer, 없으면 NULL)
+ * gbuf_valid: 1이면 gbuf가 지금 카메라의 전체 해상도 프레임으로 채워짐
+ * relight: 다음 pool_render의 frame.relight
+ * dirty: 타일별로 다시 렌더링할지 (damage_object가 1로 표시)
+ * damaged: 1이면 다음 pool_render가 dirty 밖의 끝난 타일을 그대로 둠
+ * edges: 마지막 안티앨리어싱 단계의 가장자리 표시 (처음 쓸 때 할당)
+ * antialias: 1이면 다음 pool_render가 안티앨리어싱 단계 (pool_antialias)
+ * deadline: 시간 예산의 마감 시각 (view_now 기준 ms, 없으면 0)
+ * complete: 1이면 창 이미지가 한 프레임 이상 완성됨
+ */
+typedef struct s_pool
+{
+	t_frame			frame;
+	t_mlx_data		*data;
+	int				*back;
+	char			*done;
+	int				queue[TILE_COUNT];
+	int				n_queue;
+	int				next;
+	int				shown;
+	int				active;
+	int				cancel;
+	int				quit;
+	int				n_threads;
+	int				scale;
+	double			started;
+	double			sample_ms;
+	t_history		history;
+	t_hit			*gbuf;
+	int				gbuf_valid;
+	int				relight;
+	char			dirty[TILE_COUNT];
+	int				damaged;
+	char			*edges;
+	int				antialias;
+	double			deadline;
+	int				complete;
+	pthread_mutex_t	lock;
+	pthread_cond_t	wake;
+	pthread_cond_t	idle;
+	pthread_t		threads[POOL_MAX_THREADS];
+}	t_pool;
+
+/* render.c, render_frame.c */
+int			render_sample(t_frame *f, int x, int y);
+void		render_tile(t_frame *f, int tile);
+void		frame_begin(t_frame *f, t_scene *scene, int *pixels);
+void		frame_end(t_frame *f);
+void		fill_block(int *pixels, int *xy, int size, int color);
+void		render_coarse(t_frame *f, int tile);
+t_vec3		sample_hit(t_frame *f, int x, int y, t_hit *hit);
+
+/* render_progressive.c */
+t_progress	*progress_start(t_scene *scene, t_mlx_data *data);
+int			progress_step(t_progress *p, int budget);
+
+/* render_pool.c, render_swap.c */
+t_pool		*pool_start(t_scene *scene, t_mlx_data *data, int n_threads);
+void		pool_stop(t_pool *p);
+int			pool_gbuffer(t_pool *p);
+void		pool_cancel(t_pool *p);
+void		pool_render(t_pool *p);
+int			pool_swap(t_pool *p);
+void		pool_relight(t_pool *p);
+
+/* render_view.c */
+double		view_now(void);
+void		view_measure(t_pool *p);
+int			view_scale(t_pool *p, double ms);
+void		view_key(t_pool *p, int keycode);
+int			view_refine(t_pool *p);
+
+/* render_damage.c, render_dirty.c */
+void		damage_box(char *dirty, t_scene *scene, t_aabb *box);
+void		damage_object(char *dirty, t_scene *scene, t_object *obj);
+void		damage_begin(t_pool *p);
+void		pool_damage(t_pool *p);
+int			damage_apply(t_pool *p);
+int			pool_antialias(t_pool *p);
+
+/* render_aa.c */
+int			aa_edges(t_frame *f, char *edges, char *tiles);
+void		aa_tile(t_frame *f, int tile);
+int			render_antialias(t_frame *f);
+
+/* render_thumb.c */
+void		render_thumbnail(t_scene *scene, int *pixels, int width,
+				int height);
+void		image_downscale(int *src, int *dst, int width, int height);
+
+/* render_reload.c */
+int			pool_reload(t_pool *p, t_scene *fresh);
+int			pool_watch(t_pool *p, t_watch *w);
+
+/* render_budget.c */
+int			budget_from_name(char *arg);
+void		pool_budget(t_pool *p, double start, double ms);
+void		budget_order(t_pool *p);
+int			budget_expired(t_pool *p);
+
+/* render_history.c, render_reproject.c */
+int			history_init(t_history *h);
+void		history_clear(t_history *h);
+void		history_free(t_history *h);
+int			history_reused(t_history *h, int scale);
+void		history_reproject(t_history *h, t_camera *cam, int scale);
+int			history_sample(t_frame *f, int x, int y, int *rgb);
+void		history_store(t_history *h, int pixel, t_hit *hit, int rgb);
+
+/* pixel_order.c */
+void		pixel_order_table(int order, int *lut);
+
+#endif
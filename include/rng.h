@@ -0,0 +1,23 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   rng.h                                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef RNG_H
+# define RNG_H
+
+# include "minirt.h"
+
+unsigned long long	rng_next(unsigned long long *state);
+double				rng_range(unsigned long long *state, double lo, double hi);
+t_vec3				rng_point(unsigned long long *state, double extent);
+t_vec3				rng_unit(unsigned long long *state);
+
+#endif
@@ -0,0 +1,151 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   server.h                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef SERVER_H
+# define SERVER_H
+
+# include "minirt.h"
+# include <sys/types.h>
+
+/*
+ * 렌더 서버 (--serve, src/server/)
+ *
+ * 한 프로세스가 UNIX 도메인 소켓으로 작업을 받아 차례로 렌더링합니다.
+ * 파싱한 장면과 가속 구조를 SERVER_CACHE개까지 남겨 두므로, 같은
+ * 장면을 다시 요청하면 파싱과 BVH 빌드 없이 바로 렌더링합니다.
+ * 연결 하나가 작업 하나이고, 요청은 빈 줄로 끝나는 텍스트입니다:
+ *
+ *   scene <경로>              장면 파일 (또는 아래 > 줄)
+ *   > <장면 줄>               요청에 담은 장면 (.rt 형식의 한 줄)
+ *   camera <위치> <방향> <fov> 카메라 바꾸기 (C 줄과 같은 형식)
+ *   size <너비> <높이>         WIDTH × HEIGHT 이하로 줄여 저장
+ *   output <경로>              저장할 BMP (없으면 SERVER_SHM_DIR)
+ *   priority <정수>            클수록 먼저 (같으면 먼저 온 순서)
+ *   aa                         가장자리 안티앨리어싱 (--aa)
+ *   shutdown                   대기 중인 작업을 끝내고 서버 종료
+ *
+ * 답은 "ok <경로>\n" 또는 "error <이유>\n" 한 줄입니다.
+ * SERVER_SHM_DIR은 메모리에 있는 파일 시스템이므로 클라이언트가 그
+ * 경로를 mmap하면 공유 메모리처럼 씁니다. 지우는 것은 클라이언트의
+ * 몫입니다.
+ */
+# define SERVER_MAX_CLIENTS 32
+# define SERVER_MAX_JOBS 64
+# define SERVER_CACHE 8
+# define SERVER_MAX_REQUEST 4194304
+# ifdef __linux__
+#  define SERVER_SHM_DIR "/dev/shm"
+# else
+#  define SERVER_SHM_DIR "/tmp"
+# endif
+
+/*
+ * fd: 답을 보낼 연결, seq: 받은 순서 (우선순위가 같을 때)
+ * scene: 장면 파일 경로, text: 요청에 담은 장면 (둘 중 하나만)
+ * camera: 요청의 camera 줄 (바꾸지 않으면 NULL)
+ * output: 저장할 경로 (없으면 job_push가 SERVER_SHM_DIR에 만듦)
+ * quit: 1이면 shutdown 요청
+ */
+typedef struct s_job
+{
+	int		fd;
+	int		priority;
+	long	seq;
+	char	*scene;
+	char	*text;
+	size_t	text_len;
+	size_t	text_cap;
+	char	*camera;
+	char	*output;
+	int		width;
+	int		height;
+	int		aa;
+	int		quit;
+}	t_job;
+
+/*
+ * 요청을 다 받기 전의 연결
+ */
+typedef struct s_client
+{
+	int		fd;
+	char	*buf;
+	size_t	len;
+	size_t	cap;
+}	t_client;
+
+/*
+ * 남겨 둔 장면
+ * key: 장면 파일 경로 또는 요청에 담은 장면 내용
+ * is_path: 1이면 key가 경로 (mtime, size가 다르면 다시 읽음)
+ * used: 마지막으로 쓴 시점 (가장 오래된 것부터 버림)
+ */
+typedef struct s_cached
+{
+	char	*key;
+	int		is_path;
+	time_t	mtime;
+	off_t	size;
+	t_scene	*scene;
+	long	used;
+}	t_cached;
+
+/*
+ * path: 소켓 파일 (listen이 성공하면 채움, server_close가 지움)
+ * pixels: 렌더링 결과 (WIDTH × HEIGHT), thumb: 줄인 이미지
+ * tick: 캐시의 used에 쓰는 번호, hits: 캐시에서 찾은 작업 수
+ * quit: shutdown을 받으면 1
+ */
+typedef struct s_server
+{
+	int			listen_fd;
+	char		*path;
+	t_client	clients[SERVER_MAX_CLIENTS];
+	int			n_clients;
+	t_job		jobs[SERVER_MAX_JOBS];
+	int			n_jobs;
+	long		seq;
+	t_cached	cache[SERVER_CACHE];
+	long		tick;
+	long		hits;
+	int			*pixels;
+	int			*thumb;
+	int			quit;
+}	t_server;
+
+/* server.c */
+t_server	*server_open(char *path);
+void		server_close(t_server *s);
+int			server_step(t_server *s, int wait_ms);
+int			server_run(char *path);
+
+/* server_client.c */
+void		client_accept(t_server *s);
+void		client_read(t_server *s, int i);
+
+/* server_job.c */
+char		*job_parse(char *request, t_job *job);
+
+/* server_queue.c */
+int			job_push(t_server *s, t_job *job);
+int			job_pop(t_server *s, t_job *job);
+void		job_reply(t_job *job, char *status, char *text);
+void		job_free(t_job *job);
+
+/* server_cache.c */
+t_scene		*cache_get(t_server *s, t_job *job);
+void		cache_clear(t_server *s);
+
+/* server_render.c */
+void		job_run(t_server *s, t_job *job);
+
+#endif
@@ -0,0 +1,77 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   vec3_backend_avx.h                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef VEC3_BACKEND_AVX_H
+# define VEC3_BACKEND_AVX_H
+
+# include <immintrin.h>
+
+/*
+ * AVX 백엔드 (make SIMD=avx, double 빌드 전용)
+ * x, y, z를 4칸 double 레지스터에 넣고 마지막 칸은 0입니다.
+ * float 빌드는 세 성분이 SSE 레지스터 하나에 들어가므로
+ * vec3_inline.h가 SSE 백엔드를 대신 사용합니다.
+ *
+ * 내적의 가로 합은 (x + y) + z 순서로 더해 스칼라 백엔드와
+ * 비트 단위로 같은 결과를 냅니다.
+ */
+typedef __m256d	t_v3reg;
+
+static inline t_v3reg	v3r_load(t_vec3 v)
+{
+	return (_mm256_set_pd(0.0, v.z, v.y, v.x));
+}
+
+static inline t_vec3	v3r_store(t_v3reg r)
+{
+	double	d[4];
+	t_vec3	v;
+
+	_mm256_storeu_pd(d, r);
+	v.x = d[0];
+	v.y = d[1];
+	v.z = d[2];
+	return (v);
+}
+
+static inline t_v3reg	v3r_add(t_v3reg a, t_v3reg b)
+{
+	return (_mm256_add_pd(a, b));
+}
+
+static inline t_v3reg	v3r_sub(t_v3reg a, t_v3reg b)
+{
+	return (_mm256_sub_pd(a, b));
+}
+
+static inline t_v3reg	v3r_mul(t_v3reg a, t_real t)
+{
+	return (_mm256_mul_pd(a, _mm256_set1_pd(t)));
+}
+
+static inline t_v3reg	v3r_div(t_v3reg a, t_real t)
+{
+	return (_mm256_div_pd(a, _mm256_set1_pd(t)));
+}
+
+static inline t_real	v3r_dot(t_v3reg a, t_v3reg b)
+{
+	__m256d	m;
+	__m128d	xy;
+
+	m = _mm256_mul_pd(a, b);
+	xy = _mm256_castpd256_pd128(m);
+	xy = _mm_hadd_pd(xy, xy);
+	return (_mm_cvtsd_f64(_mm_add_sd(xy, _mm256_extractf128_pd(m, 1))));
+}
+
+#endif
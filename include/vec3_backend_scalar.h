@@ -0,0 +1,70 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   vec3_backend_scalar.h                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef VEC3_BACKEND_SCALAR_H
+# define VEC3_BACKEND_SCALAR_H
+
+/*
+ * 기본 백엔드: 성분별 스칼라 연산
+ * t_v3reg가 t_vec3 자체이므로 load/store는 아무 일도 하지 않고,
+ * 나머지는 src/lib/vec3의 함수와 같은 순서로 계산합니다.
+ */
+typedef t_vec3	t_v3reg;
+
+static inline t_v3reg	v3r_load(t_vec3 v)
+{
+	return (v);
+}
+
+static inline t_vec3	v3r_store(t_v3reg r)
+{
+	return (r);
+}
+
+static inline t_v3reg	v3r_add(t_v3reg a, t_v3reg b)
+{
+	a.x += b.x;
+	a.y += b.y;
+	a.z += b.z;
+	return (a);
+}
+
+static inline t_v3reg	v3r_sub(t_v3reg a, t_v3reg b)
+{
+	a.x -= b.x;
+	a.y -= b.y;
+	a.z -= b.z;
+	return (a);
+}
+
+static inline t_v3reg	v3r_mul(t_v3reg a, t_real t)
+{
+	a.x *= t;
+	a.y *= t;
+	a.z *= t;
+	return (a);
+}
+
+static inline t_v3reg	v3r_div(t_v3reg a, t_real t)
+{
+	a.x /= t;
+	a.y /= t;
+	a.z /= t;
+	return (a);
+}
+
+static inline t_real	v3r_dot(t_v3reg a, t_v3reg b)
+{
+	return (a.x * b.x + a.y * b.y + a.z * b.z);
+}
+
+#endif
@@ -0,0 +1,141 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   vec3_backend_sse.h                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef VEC3_BACKEND_SSE_H
+# define VEC3_BACKEND_SSE_H
+
+# include <pmmintrin.h>
+
+/*
+ * SSE3 백엔드 (make SIMD=sse)
+ * float: x, y, z를 4칸 레지스터에 넣고 마지막 칸은 0
+ * double: x, y는 2칸 레지스터, z는 스칼라
+ *
+ * 내적의 가로 합은 (x + y) + z 순서로 더해 스칼라 백엔드와
+ * 비트 단위로 같은 결과를 냅니다.
+ */
+# ifdef RT_FLOAT
+
+typedef __m128	t_v3reg;
+
+static inline t_v3reg	v3r_load(t_vec3 v)
+{
+	return (_mm_set_ps(0.0f, v.z, v.y, v.x));
+}
+
+static inline t_vec3	v3r_store(t_v3reg r)
+{
+	float	f[4];
+	t_vec3	v;
+
+	_mm_storeu_ps(f, r);
+	v.x = f[0];
+	v.y = f[1];
+	v.z = f[2];
+	return (v);
+}
+
+static inline t_v3reg	v3r_add(t_v3reg a, t_v3reg b)
+{
+	return (_mm_add_ps(a, b));
+}
+
+static inline t_v3reg	v3r_sub(t_v3reg a, t_v3reg b)
+{
+	return (_mm_sub_ps(a, b));
+}
+
+static inline t_v3reg	v3r_mul(t_v3reg a, t_real t)
+{
+	return (_mm_mul_ps(a, _mm_set1_ps(t)));
+}
+
+static inline t_v3reg	v3r_div(t_v3reg a, t_real t)
+{
+	return (_mm_div_ps(a, _mm_set1_ps(t)));
+}
+
+static inline t_real	v3r_dot(t_v3reg a, t_v3reg b)
+{
+	__m128	m;
+
+	m = _mm_mul_ps(a, b);
+	m = _mm_hadd_ps(m, m);
+	m = _mm_hadd_ps(m, m);
+	return (_mm_cvtss_f32(m));
+}
+
+# else
+
+typedef struct s_v3reg
+{
+	__m128d	xy;
+	double	z;
+}	t_v3reg;
+
+static inline t_v3reg	v3r_load(t_vec3 v)
+{
+	t_v3reg	r;
+
+	r.xy = _mm_loadu_pd(&v.x);
+	r.z = v.z;
+	return (r);
+}
+
+static inline t_vec3	v3r_store(t_v3reg r)
+{
+	t_vec3	v;
+
+	_mm_storeu_pd(&v.x, r.xy);
+	v.z = r.z;
+	return (v);
+}
+
+static inline t_v3reg	v3r_add(t_v3reg a, t_v3reg b)
+{
+	a.xy = _mm_add_pd(a.xy, b.xy);
+	a.z += b.z;
+	return (a);
+}
+
+static inline t_v3reg	v3r_sub(t_v3reg a, t_v3reg b)
+{
+	a.xy = _mm_sub_pd(a.xy, b.xy);
+	a.z -= b.z;
+	return (a);
+}
+
+static inline t_v3reg	v3r_mul(t_v3reg a, t_real t)
+{
+	a.xy = _mm_mul_pd(a.xy, _mm_set1_pd(t));
+	a.z *= t;
+	return (a);
+}
+
+static inline t_v3reg	v3r_div(t_v3reg a, t_real t)
+{
+	a.xy = _mm_div_pd(a.xy, _mm_set1_pd(t));
+	a.z /= t;
+	return (a);
+}
+
+static inline t_real	v3r_dot(t_v3reg a, t_v3reg b)
+{
+	__m128d	m;
+
+	m = _mm_mul_pd(a.xy, b.xy);
+	m = _mm_hadd_pd(m, m);
+	return (_mm_cvtsd_f64(m) + a.z * b.z);
+}
+
+# endif
+#endif
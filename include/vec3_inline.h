@@ -0,0 +1,96 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   vec3_inline.h                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef VEC3_INLINE_H
+# define VEC3_INLINE_H
+
+# include "minirt.h"
+# include <math.h>
+
+/*
+ * 헤더 인라인 벡터 연산 (v3_*)
+ *
+ * src/lib/vec3의 vec3_* 함수는 파일마다 따로 컴파일되어 LTO 없이는
+ * 인라인되지 않으므로, 교점 계산과 조명처럼 광선마다 수없이 불리는
+ * 경로에서는 같은 연산을 하는 이 헤더의 v3_* 함수를 사용합니다.
+ * 파서 등 그 밖의 코드는 vec3.h를 그대로 사용합니다.
+ *
+ * 실제 연산은 빌드 옵션으로 고르는 백엔드가 담당합니다.
+ * - 기본: 스칼라 (vec3_backend_scalar.h)
+ * - make SIMD=sse: SSE3 (vec3_backend_sse.h)
+ * - make SIMD=avx: AVX (vec3_backend_avx.h, double 빌드만)
+ * 세 백엔드는 같은 순서로 계산하므로 렌더링 결과가 같습니다.
+ */
+# if defined(RT_SIMD_AVX) && !defined(RT_FLOAT)
+#  include "vec3_backend_avx.h"
+# elif defined(RT_SIMD_SSE) || defined(RT_SIMD_AVX)
+#  include "vec3_backend_sse.h"
+# else
+#  include "vec3_backend_scalar.h"
+# endif
+
+static inline t_vec3	v3_new(t_real x, t_real y, t_real z)
+{
+	t_vec3	v;
+
+	v.x = x;
+	v.y = y;
+	v.z = z;
+	return (v);
+}
+
+static inline t_vec3	v3_add(t_vec3 a, t_vec3 b)
+{
+	return (v3r_store(v3r_add(v3r_load(a), v3r_load(b))));
+}
+
+static inline t_vec3	v3_sub(t_vec3 a, t_vec3 b)
+{
+	return (v3r_store(v3r_sub(v3r_load(a), v3r_load(b))));
+}
+
+static inline t_vec3	v3_mul(t_vec3 v, t_real t)
+{
+	return (v3r_store(v3r_mul(v3r_load(v), t)));
+}
+
+static inline t_vec3	v3_div(t_vec3 v, t_real t)
+{
+	return (v3r_store(v3r_div(v3r_load(v), t)));
+}
+
+static inline t_real	v3_dot(t_vec3 a, t_vec3 b)
+{
+	return (v3r_dot(v3r_load(a), v3r_load(b)));
+}
+
+static inline t_vec3	v3_cross(t_vec3 a, t_vec3 b)
+{
+	t_vec3	r;
+
+	r.x = a.y * b.z - a.z * b.y;
+	r.y = a.z * b.x - a.x * b.z;
+	r.z = a.x * b.y - a.y * b.x;
+	return (r);
+}
+
+static inline t_real	v3_length(t_vec3 v)
+{
+	return (RT_SQRT(v3_dot(v, v)));
+}
+
+static inline t_vec3	v3_normalize(t_vec3 v)
+{
+	return (v3_div(v, v3_length(v)));
+}
+
+#endif
@@ -0,0 +1,183 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   accel_build.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "accel.h"
+#include "vec3_inline.h"
+
+/*
+ * count_objects - 종류별 물체 수 세기
+ * @acc: 가속 구조
+ * @obj: 물체 목록의 첫 물체
+ */
+static void	count_objects(t_accel *acc, t_object *obj)
+{
+	acc->n_spheres = 0;
+	acc->n_cylinders = 0;
+	acc->n_instances = 0;
+	acc->n_planes = 0;
+	while (obj)
+	{
+		acc->n_spheres += (obj->type == OBJ_SPHERE);
+		acc->n_cylinders += (obj->type == OBJ_CYLINDER);
+		acc->n_instances += (obj->type == OBJ_INSTANCE);
+		acc->n_planes += (obj->type == OBJ_PLANE);
+		obj = obj->next;
+	}
+}
+
+/*
+ * new_accel - 빈 가속 구조를 만들고 종류별 물체 수 세기
+ * @objects: prepare_object까지 끝난 물체 목록
+ *
+ * Return: 배열이 아직 할당되지 않은 가속 구조, 실패 시 NULL
+ */
+static t_accel	*new_accel(t_object *objects)
+{
+	t_accel	*acc;
+
+	acc = malloc(sizeof(t_accel));
+	if (!acc)
+		return (NULL);
+	acc->nodes = NULL;
+	acc->n_nodes = 0;
+	acc->wide = NULL;
+	acc->n_wide = 0;
+	acc->leaves = NULL;
+	acc->n_leaves = 0;
+	acc->grid.start = NULL;
+	acc->grid.items = NULL;
+	acc->grid.n_cells = 0;
+	acc->grid.n_items = 0;
+	acc->bounds = aabb_empty();
+	acc->refit.parent = NULL;
+	acc->refit.leaf = NULL;
+	acc->refit.area0 = NULL;
+	count_objects(acc, objects);
+	return (acc);
+}
+
+/*
+ * alloc_arrays - 종류별 배열과 BVH 항목 배열 할당
+ * @b: 빌드 상태 (b->acc는 물체 수를 센 가속 구조)
+ *
+ * 물체가 없는 종류도 유효한 포인터를 갖도록 한 칸씩 더 할당합니다.
+ * tmp는 잎을 종류별로 정렬할 때 쓰는 작업 공간입니다.
+ *
+ * Return: 1 (성공), 0 (메모리 부족, 할당된 배열은 build_accel이 해제)
+ */
+static int	alloc_arrays(t_bvh_build *b)
+{
+	t_accel	*acc;
+	int		n_refs;
+
+	acc = b->acc;
+	b->fill[PRIM_SPHERE] = 0;
+	b->fill[PRIM_CYLINDER] = 0;
+	b->fill[PRIM_INSTANCE] = 0;
+	n_refs = acc->n_spheres + acc->n_cylinders + acc->n_instances + 1;
+	b->refs = malloc(sizeof(t_prim_ref) * n_refs);
+	b->tmp = malloc(sizeof(t_prim_ref) * n_refs);
+	acc->spheres = malloc(sizeof(t_sphere) * (acc->n_spheres + 1));
+	acc->sphere_objs = malloc(sizeof(t_object *) * (acc->n_spheres + 1));
+	acc->cylinders = malloc(sizeof(t_cylinder) * (acc->n_cylinders + 1));
+	acc->cylinder_objs = malloc(sizeof(t_object *)
+			* (acc->n_cylinders + 1));
+	acc->instances = malloc(sizeof(t_instance) * (acc->n_instances + 1));
+	acc->instance_objs = malloc(sizeof(t_object *)
+			* (acc->n_instances + 1));
+	plane_soa_init(&acc->planes, acc->n_planes);
+	acc->plane_objs = malloc(sizeof(t_object *) * (acc->n_planes + 1));
+	return (b->refs && b->tmp && acc->spheres && acc->sphere_objs
+		&& acc->cylinders && acc->cylinder_objs && acc->instances
+		&& acc->instance_objs && acc->planes.px && acc->plane_objs);
+}
+
+/*
+ * collect_refs - 크기가 있는 물체는 BVH 항목으로, 평면은 배열로
+ * @obj: 물체 목록의 첫 물체
+ * @b: 빌드 상태 (refs를 채움)
+ *
+ * n[0]은 BVH 항목 수, n[1]은 평면 수입니다.
+ *
+ * Return: 채운 BVH 항목 수
+ */
+static int	collect_refs(t_object *obj, t_bvh_build *b)
+{
+	t_prim_ref	*ref;
+	int			n[2];
+
+	n[0] = 0;
+	n[1] = 0;
+	while (obj)
+	{
+		ref = &b->refs[n[0]];
+		ref->type = prim_bounds(obj, &ref->box);
+		if (ref->type >= 0)
+		{
+			ref->obj = obj;
+			ref->centroid = v3_mul(v3_add(ref->box.min, ref->box.max), 0.5);
+			b->acc->bounds = aabb_union(b->acc->bounds, ref->box);
+			n[0]++;
+		}
+		else if (obj->type == OBJ_PLANE)
+		{
+			obj->accel_slot = n[1];
+			plane_soa_set(&b->acc->planes, n[1], (t_plane *)obj->object);
+			b->acc->plane_objs[n[1]++] = obj;
+		}
+		obj = obj->next;
+	}
+	return (n[0]);
+}
+
+/*
+ * build_accel - 물체 목록의 가속 구조 만들기
+ * @objects: prepare_object까지 끝난 물체 목록 (장면 또는 그룹)
+ * @mode: ACCEL_* (ACCEL_AUTO이면 accel_select가 격자와 BVH 중 선택)
+ *
+ * 물체를 종류별 배열로 나누고 구, 원기둥, 배치로 BVH나 균일 격자를
+ * 만듭니다. ACCEL_LIST는 모든 물체를 잎 하나에 넣은 BVH입니다.
+ * 배치의 경계는 그룹의 가속 구조로 구하므로, 그룹을 먼저 만들어야
+ * 합니다 (prepare_scene).
+ * BVH_WIDE 빌드에서는 이진 BVH를 4갈래 양자화 BVH로 바꿉니다.
+ * 배열에는 기하 정보의 복사본이 들어가므로, 물체를 바꾼 뒤에는
+ * 다시 만들어야 합니다 (prepare_scene이 매번 새로 만듦).
+ *
+ * Return: 가속 구조, 메모리가 부족하면 NULL (리스트 순회로 대체)
+ */
+t_accel	*build_accel(t_object *objects, int mode)
+{
+	t_bvh_build	b;
+	int			count;
+	int			ok;
+
+	b.acc = new_accel(objects);
+	if (!b.acc)
+		return (NULL);
+	ok = alloc_arrays(&b);
+	if (ok)
+	{
+		count = collect_refs(objects, &b);
+		b.acc->kind = accel_select(&b, count, mode);
+		b.max_depth = BVH_MAX_DEPTH * (b.acc->kind != ACCEL_LIST);
+		if (b.acc->kind == ACCEL_GRID)
+			ok = grid_build(&b, count);
+		else
+			ok = bvh_build(&b, count) && (!BVH_WIDE || qbvh_build(b.acc));
+	}
+	free(b.refs);
+	free(b.tmp);
+	if (ok)
+		return (b.acc);
+	free_accel(b.acc);
+	return (NULL);
+}
@@ -0,0 +1,72 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   accel_memory.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "accel.h"
+
+/*
+ * free_accel - 가속 구조 해제
+ * @acc: build_accel의 결과 (NULL 허용)
+ *
+ * 원래 물체(t_object)는 장면이 소유하므로 해제하지 않습니다.
+ */
+void	free_accel(t_accel *acc)
+{
+	if (!acc)
+		return ;
+	free(acc->spheres);
+	free(acc->sphere_objs);
+	free(acc->cylinders);
+	free(acc->cylinder_objs);
+	free(acc->instances);
+	free(acc->instance_objs);
+	free(acc->planes.px);
+	free(acc->plane_objs);
+	free(acc->nodes);
+	free(acc->wide);
+	free(acc->leaves);
+	free(acc->grid.start);
+	free(acc->grid.items);
+	free(acc->refit.parent);
+	free(acc->refit.leaf);
+	free(acc->refit.area0);
+	free(acc);
+}
+
+/*
+ * accel_bytes - 가속 구조가 차지하는 메모리 (벤치마크 보고용)
+ * @acc: 가속 구조 (NULL 허용)
+ *
+ * 배치가 가리키는 그룹의 가속 구조는 장면의 그룹 목록이 소유하므로
+ * 여기에 더하지 않습니다 (bench가 따로 더함).
+ *
+ * Return: 노드, 잎, 격자 칸, 종류별 배열, 갱신 정보의 바이트 수
+ */
+size_t	accel_bytes(t_accel *acc)
+{
+	size_t	bytes;
+
+	if (!acc)
+		return (0);
+	bytes = sizeof(t_bvh_node) * acc->n_nodes
+		+ sizeof(t_qbvh_node) * acc->n_wide
+		+ sizeof(t_bvh_leaf) * acc->n_leaves;
+	bytes += (sizeof(t_sphere) + sizeof(t_object *)) * acc->n_spheres;
+	bytes += (sizeof(t_cylinder) + sizeof(t_object *)) * acc->n_cylinders;
+	bytes += (sizeof(t_instance) + sizeof(t_object *)) * acc->n_instances;
+	bytes += sizeof(int) * (acc->grid.n_cells + acc->grid.n_items);
+	if (acc->refit.parent)
+		bytes += (sizeof(int) + sizeof(t_real)) * acc->n_nodes + sizeof(int)
+			* (acc->n_spheres + acc->n_cylinders + acc->n_instances);
+	bytes += (6 * sizeof(t_real)) * acc->planes.size
+		+ sizeof(t_object *) * acc->n_planes;
+	return (bytes);
+}
@@ -0,0 +1,122 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   accel_query.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "accel.h"
+#include "vec3_inline.h"
+#include <math.h>
+
+/*
+ * traverse - 빌드한 구조 순회 (균일 격자, 또는 BVH_WIDE이면 4갈래 양자화
+ *            노드, 아니면 이진 BVH)
+ * @acc: 가속 구조
+ * @tr: 탐색 상태
+ *
+ * Return: 1 (any 모드에서 교점을 찾음), 0 (순회 완료)
+ */
+static int	traverse(t_accel *acc, t_trav *tr)
+{
+	if (acc->kind == ACCEL_GRID)
+		return (grid_traverse(acc, tr));
+	if (BVH_WIDE && acc->n_wide > 0)
+		return (qbvh_traverse(acc, tr));
+	if (acc->n_nodes > 0)
+		return (bvh_traverse(acc, tr));
+	return (0);
+}
+
+/*
+ * accel_trace - 평면 배열을 검사한 뒤 BVH 순회
+ * @acc: 가속 구조
+ * @tr: 탐색 상태 (ray, inv_dir, best.t, any를 채운 상태)
+ *
+ * 평면을 먼저 검사해 가장 가까운 평면까지의 거리로 best.t를 정한 뒤,
+ * 그보다 가까운 구, 원기둥, 배치만 BVH로 찾습니다.
+ * 배치 안의 그룹도 같은 함수로 탐색합니다 (instance_hit).
+ *
+ * Return: 1 (any 모드에서 교점을 찾음), 0 (탐색 완료)
+ */
+int	accel_trace(t_accel *acc, t_trav *tr)
+{
+	if (plane_pass(acc, tr))
+		return (1);
+	return (traverse(acc, tr));
+}
+
+/*
+ * accel_resolve - 탐색 결과를 원래 물체로 바꾸기
+ * @acc: 가속 구조
+ * @rec: 탐색이 찾은 교점 (종류와 배열 내 번호)
+ * @hit: object와 instance를 채움 (출력)
+ */
+void	accel_resolve(t_accel *acc, t_hit_rec *rec, t_hit *hit)
+{
+	hit->instance = NULL;
+	if (rec->type == PRIM_SPHERE)
+		hit->object = acc->sphere_objs[rec->index];
+	else if (rec->type == PRIM_CYLINDER)
+		hit->object = acc->cylinder_objs[rec->index];
+	else if (rec->type == PRIM_INSTANCE)
+	{
+		hit->object = rec->obj;
+		hit->instance = &acc->instances[rec->index];
+	}
+	else
+		hit->object = acc->plane_objs[rec->index];
+}
+
+/*
+ * accel_closest - 가속 구조로 광선과 가장 가까운 교점 찾기
+ * @acc: 가속 구조
+ * @ray: 광선 (방향은 단위 벡터)
+ * @hit: t, object, instance를 채움 (출력, 교점이 있을 때만)
+ *
+ * Return: 1 (교점 있음), 0 (없음)
+ */
+int	accel_closest(t_accel *acc, t_ray ray, t_hit *hit)
+{
+	t_trav	tr;
+
+	tr.ray = ray;
+	tr.inv_dir = v3_new(1.0 / ray.direction.x, 1.0 / ray.direction.y,
+			1.0 / ray.direction.z);
+	tr.best.t = INFINITY;
+	tr.any = 0;
+	accel_trace(acc, &tr);
+	if (tr.best.t == INFINITY)
+		return (0);
+	hit->t = tr.best.t;
+	accel_resolve(acc, &tr.best, hit);
+	return (1);
+}
+
+/*
+ * accel_occluded - 광선의 (0, tmax) 구간에 물체가 있는지 검사
+ * @acc: 가속 구조
+ * @ray: 광선 (방향은 단위 벡터)
+ * @tmax: 검사할 최대 거리 (보통 광원까지의 거리)
+ *
+ * 그림자 광선은 가장 가까운 교점이 필요 없으므로 처음 찾은
+ * 교점에서 바로 멈춥니다 (any-hit).
+ *
+ * Return: 1 (가려짐), 0 (가려지지 않음)
+ */
+int	accel_occluded(t_accel *acc, t_ray ray, t_real tmax)
+{
+	t_trav	tr;
+
+	tr.ray = ray;
+	tr.inv_dir = v3_new(1.0 / ray.direction.x, 1.0 / ray.direction.y,
+			1.0 / ray.direction.z);
+	tr.best.t = tmax;
+	tr.any = 1;
+	return (accel_trace(acc, &tr));
+}
@@ -0,0 +1,144 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   accel_select.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "accel.h"
+#include "libft.h"
+#include "vec3_inline.h"
+#include <math.h>
+
+/*
+ * size_cv - 물체 크기(경계 상자 대각선 길이)의 변동계수
+ * @b: 빌드 상태
+ * @count: 물체 수 (1 이상)
+ *
+ * 크기가 비슷하면 0에 가깝습니다. 큰 물체는 격자의 여러 칸에
+ * 들어가고, 작은 물체는 칸 하나를 혼자 차지하지 못하므로 크기가
+ * 제각각이면 격자가 불리합니다.
+ *
+ * Return: 표준편차 / 평균
+ */
+static t_real	size_cv(t_bvh_build *b, int count)
+{
+	t_real	sum;
+	t_real	sum2;
+	t_real	size;
+	int		i;
+
+	sum = 0;
+	sum2 = 0;
+	i = 0;
+	while (i < count)
+	{
+		size = v3_length(v3_sub(b->refs[i].box.max, b->refs[i].box.min));
+		sum += size;
+		sum2 += size * size;
+		i++;
+	}
+	sum /= count;
+	return (RT_SQRT(fmax(0, sum2 / count - sum * sum)) / sum);
+}
+
+/*
+ * occupancy_cv - 성긴 격자에서 칸별 물체 수의 변동계수
+ * @b: 빌드 상태 (acc->bounds가 계산되어 있음)
+ * @count: 물체 수 (1 이상)
+ *
+ * 칸 하나에 평균 1 / GRID_STAT_DENSITY개가 들어가는 격자에 물체의
+ * 중심을 세어 넣습니다. 고르게 퍼진 장면은 칸별 개수가 비슷하고
+ * (포아송 분포에서 약 0.35), 군집이나 빈 공간이 많으면 커집니다.
+ *
+ * Return: 표준편차 / 평균, 메모리가 부족하면 INFINITY (BVH 선택)
+ */
+static t_real	occupancy_cv(t_bvh_build *b, int count)
+{
+	t_grid	g;
+	int		*cells;
+	int		c[3];
+	int		i;
+	t_real	var;
+
+	grid_setup(&g, b->acc->bounds, GRID_STAT_DENSITY, count);
+	cells = malloc(sizeof(int) * g.n_cells);
+	if (!cells)
+		return (INFINITY);
+	i = 0;
+	while (i < g.n_cells)
+		cells[i++] = 0;
+	i = 0;
+	while (i < count)
+	{
+		grid_cell_coord(&g, b->refs[i++].centroid, c);
+		cells[(c[2] * g.res[1] + c[1]) * g.res[0] + c[0]]++;
+	}
+	var = 0;
+	i = 0;
+	while (i < g.n_cells)
+		var += pow(cells[i++] - (t_real)count / g.n_cells, 2);
+	free(cells);
+	return (RT_SQRT(var / g.n_cells) * g.n_cells / count);
+}
+
+/*
+ * accel_select - 만들 가속 구조 고르기
+ * @b: 빌드 상태 (collect_refs가 끝난 상태)
+ * @count: BVH나 격자에 들어갈 물체 수
+ * @mode: 요청한 ACCEL_* (ACCEL_AUTO가 아니면 그대로 사용)
+ *
+ * 물체가 충분히 많고, 크기가 비슷하고, 심하게 몰려 있지 않을 때만
+ * 균일 격자를 고릅니다. 빈 공간이 많은 장면("teapot in a stadium")이나
+ * 크기가 제각각인 장면은 BVH가 유리합니다.
+ *
+ * Return: ACCEL_LIST, ACCEL_BVH, ACCEL_GRID 중 하나
+ */
+int	accel_select(t_bvh_build *b, int count, int mode)
+{
+	if (mode != ACCEL_AUTO)
+		return (mode);
+	if (count < GRID_MIN_OBJECTS || size_cv(b, count) > GRID_MAX_SIZE_CV
+		|| occupancy_cv(b, count) > GRID_MAX_OCC_CV)
+		return (ACCEL_BVH);
+	return (ACCEL_GRID);
+}
+
+/*
+ * accel_mode_from_name - --accel 인자를 ACCEL_*로 바꾸기
+ * @name: auto, none, bvh, grid 중 하나
+ *
+ * Return: ACCEL_* 값, 알 수 없는 이름이면 -1
+ */
+int	accel_mode_from_name(char *name)
+{
+	if (!ft_strcmp(name, "auto"))
+		return (ACCEL_AUTO);
+	if (!ft_strcmp(name, "none"))
+		return (ACCEL_LIST);
+	if (!ft_strcmp(name, "bvh"))
+		return (ACCEL_BVH);
+	if (!ft_strcmp(name, "grid"))
+		return (ACCEL_GRID);
+	return (-1);
+}
+
+/*
+ * accel_kind_name - 만든 가속 구조의 이름 (벤치마크 보고용)
+ * @kind: acc->kind
+ *
+ * Return: "none", "bvh", "grid"
+ */
+char	*accel_kind_name(int kind)
+{
+	if (kind == ACCEL_LIST)
+		return ("none");
+	if (kind == ACCEL_GRID)
+		return ("grid");
+	return ("bvh");
+}
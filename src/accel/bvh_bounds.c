@@ -0,0 +1,129 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bvh_bounds.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "accel.h"
+#include "vec3_inline.h"
+#include <math.h>
+
+/*
+ * aabb_empty - 아무것도 담지 않은 상자
+ *
+ * min은 +무한대, max는 -무한대이므로 어떤 상자와 합쳐도
+ * 그 상자가 그대로 남습니다.
+ *
+ * Return: 빈 상자
+ */
+t_aabb	aabb_empty(void)
+{
+	t_aabb	box;
+
+	box.min = v3_new(INFINITY, INFINITY, INFINITY);
+	box.max = v3_new(-INFINITY, -INFINITY, -INFINITY);
+	return (box);
+}
+
+/*
+ * aabb_union - 두 상자를 모두 감싸는 가장 작은 상자
+ * @a: 첫 번째 상자
+ * @b: 두 번째 상자
+ *
+ * Return: 합친 상자
+ */
+t_aabb	aabb_union(t_aabb a, t_aabb b)
+{
+	a.min.x = fmin(a.min.x, b.min.x);
+	a.min.y = fmin(a.min.y, b.min.y);
+	a.min.z = fmin(a.min.z, b.min.z);
+	a.max.x = fmax(a.max.x, b.max.x);
+	a.max.y = fmax(a.max.y, b.max.y);
+	a.max.z = fmax(a.max.z, b.max.z);
+	return (a);
+}
+
+/*
+ * aabb_area - 상자의 겉넓이 (SAH 비용 계산용)
+ * @box: 상자
+ *
+ * 광선이 상자와 만날 확률은 겉넓이에 비례합니다.
+ *
+ * Return: 겉넓이, 빈 상자이면 0
+ */
+t_real	aabb_area(t_aabb box)
+{
+	t_vec3	d;
+
+	d = v3_sub(box.max, box.min);
+	if (d.x < 0 || d.y < 0 || d.z < 0)
+		return (0);
+	return (2 * (d.x * d.y + d.y * d.z + d.z * d.x));
+}
+
+/*
+ * cylinder_bounds - 뚜껑이 있는 원기둥의 경계 상자
+ * @cy: prepare_cylinder가 준비한 원기둥
+ *
+ * 각 좌표축 i 방향의 반폭은
+ *   half_height * |axis_i| + radius * sqrt(1 - axis_i²)
+ * 입니다 (축 방향 선분 + 뚜껑 원판의 그 축 방향 반폭).
+ * 경계에 스치는 광선을 놓치지 않도록 RT_EPSILON만큼 넓힙니다.
+ *
+ * Return: 경계 상자
+ */
+static t_aabb	cylinder_bounds(t_cylinder *cy)
+{
+	t_aabb	box;
+	t_vec3	e;
+
+	e.x = cy->half_height * RT_FABS(cy->axis.x)
+		+ cy->radius * RT_SQRT(fmax(0, 1 - cy->axis.x * cy->axis.x));
+	e.y = cy->half_height * RT_FABS(cy->axis.y)
+		+ cy->radius * RT_SQRT(fmax(0, 1 - cy->axis.y * cy->axis.y));
+	e.z = cy->half_height * RT_FABS(cy->axis.z)
+		+ cy->radius * RT_SQRT(fmax(0, 1 - cy->axis.z * cy->axis.z));
+	e = v3_add(e, v3_new(RT_EPSILON, RT_EPSILON, RT_EPSILON));
+	box.min = v3_sub(cy->center, e);
+	box.max = v3_add(cy->center, e);
+	return (box);
+}
+
+/*
+ * prim_bounds - 물체의 경계 상자
+ * @obj: prepare_object가 준비한 물체
+ * @box: 경계 상자 (출력, 원기둥처럼 RT_EPSILON만큼 넓힘)
+ *
+ * Return: BVH에 넣을 종류 번호 (PRIM_*),
+ *         -1 (평면처럼 무한한 물체, 또는 비어 있는 그룹의 배치)
+ */
+int	prim_bounds(t_object *obj, t_aabb *box)
+{
+	t_sphere	*sp;
+	t_vec3		r;
+
+	if (obj->type == OBJ_SPHERE)
+	{
+		sp = (t_sphere *)obj->object;
+		r = v3_new(sp->radius + RT_EPSILON, sp->radius + RT_EPSILON,
+				sp->radius + RT_EPSILON);
+		box->min = v3_sub(sp->center, r);
+		box->max = v3_add(sp->center, r);
+		return (PRIM_SPHERE);
+	}
+	if (obj->type == OBJ_CYLINDER)
+	{
+		*box = cylinder_bounds((t_cylinder *)obj->object);
+		return (PRIM_CYLINDER);
+	}
+	if (obj->type == OBJ_INSTANCE
+		&& instance_bounds((t_instance *)obj->object, box))
+		return (PRIM_INSTANCE);
+	return (-1);
+}
@@ -0,0 +1,137 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bvh_build.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "accel.h"
+
+/*
+ * range_box - [start, end) 범위 물체들의 경계 상자
+ * @b: 빌드 상태
+ * @start: 범위 시작
+ * @end: 범위 끝 (포함하지 않음)
+ *
+ * Return: 모든 물체를 감싸는 상자
+ */
+static t_aabb	range_box(t_bvh_build *b, int start, int end)
+{
+	t_aabb	box;
+
+	box = aabb_empty();
+	while (start < end)
+		box = aabb_union(box, b->refs[start++].box);
+	return (box);
+}
+
+/*
+ * partition - split 경계를 기준으로 물체를 왼쪽/오른쪽으로 나누기
+ * @b: 빌드 상태
+ * @start: 범위 시작
+ * @end: 범위 끝 (포함하지 않음)
+ * @split: bvh_find_split이 고른 경계
+ *
+ * SAH 비용상 잎이 더 싸더라도 물체가 너무 많으면 같은 경계로 나눕니다.
+ * 한쪽이 비게 되면 (모든 centroid가 같은 구간) 개수로 반씩 나눕니다.
+ *
+ * Return: 오른쪽 범위의 시작 번호
+ */
+static int	partition(t_bvh_build *b, int start, int end, t_bvh_split *split)
+{
+	t_prim_ref	tmp;
+	int			mid;
+	int			k;
+	int			i;
+
+	mid = start;
+	i = start;
+	while (i < end)
+	{
+		k = (int)((vec_axis(b->refs[i].centroid, split->axis) - split->min)
+				* split->scale);
+		if (k <= split->bin)
+		{
+			tmp = b->refs[i];
+			b->refs[i] = b->refs[mid];
+			b->refs[mid++] = tmp;
+		}
+		i++;
+	}
+	if (mid == start || mid == end)
+		mid = start + (end - start) / 2;
+	return (mid);
+}
+
+/*
+ * build_node - 노드 하나를 만들고 필요하면 두 자식으로 나누기
+ * @b: 빌드 상태
+ * @idx: 채울 노드 번호
+ * @range: 이 노드가 맡을 물체 범위 [start, end)
+ * @depth: 루트로부터의 깊이
+ *
+ * 나누는 조건:
+ * - SAH 비용상 나누는 편이 싸거나
+ * - 물체가 BVH_LEAF_MAX개보다 많을 때 (centroid가 모두 같아도 반으로)
+ * 탐색 스택이 넘치지 않도록 깊이가 b->max_depth (BVH_MAX_DEPTH 이하)가
+ * 되면 잎으로 둡니다. ACCEL_LIST는 max_depth가 0이라 루트가 잎입니다.
+ * 자식은 항상 연속된 두 번호(child, child + 1)에 만듭니다.
+ */
+static void	build_node(t_bvh_build *b, int idx, int *range, int depth)
+{
+	t_bvh_split	split;
+	t_bvh_node	*node;
+	int			sub[2];
+	int			mid;
+
+	node = &b->acc->nodes[idx];
+	node->box = range_box(b, range[0], range[1]);
+	if (depth >= b->max_depth || range[1] - range[0] <= 1
+		|| (!bvh_find_split(b, range[0], range[1], &split)
+			&& range[1] - range[0] <= BVH_LEAF_MAX))
+	{
+		bvh_leaf(b, node, range[0], range[1]);
+		return ;
+	}
+	mid = partition(b, range[0], range[1], &split);
+	node->child = b->acc->n_nodes;
+	b->acc->n_nodes += 2;
+	sub[0] = range[0];
+	sub[1] = mid;
+	build_node(b, node->child, sub, depth + 1);
+	sub[0] = mid;
+	sub[1] = range[1];
+	build_node(b, b->acc->nodes[idx].child + 1, sub, depth + 1);
+}
+
+/*
+ * bvh_build - b->refs의 물체들로 BVH 만들기
+ * @b: 물체 목록(refs)과 결과를 담을 가속 구조
+ * @count: 물체 수
+ *
+ * 이진 트리의 노드는 최대 2 * count - 1개이므로 한 번에 할당합니다.
+ * 잎이 만들어질 때마다 bvh_leaf가 물체를 종류별 배열에 옮깁니다.
+ *
+ * Return: 1 (성공), 0 (메모리 부족)
+ */
+int	bvh_build(t_bvh_build *b, int count)
+{
+	int	range[2];
+
+	b->acc->n_nodes = 0;
+	if (count == 0)
+		return (1);
+	b->acc->nodes = malloc(sizeof(t_bvh_node) * (2 * count - 1));
+	if (!b->acc->nodes)
+		return (0);
+	b->acc->n_nodes = 1;
+	range[0] = 0;
+	range[1] = count;
+	build_node(b, 0, range, 0);
+	return (1);
+}
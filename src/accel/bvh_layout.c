@@ -0,0 +1,104 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bvh_layout.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "accel.h"
+#include "libft.h"
+
+/*
+ * sort_by_type - 잎 범위의 물체를 종류 순서로 정렬
+ * @b: 빌드 상태 (tmp를 작업 공간으로 씀)
+ * @start: 범위 시작
+ * @end: 범위 끝 (포함하지 않음)
+ *
+ * 종류마다 범위를 한 번씩 훑어 tmp에 모은 뒤 되돌려 씁니다.
+ * 같은 종류끼리는 원래 순서를 유지하고, 잎이 아주 커도 (ACCEL_LIST,
+ * 균일 격자) 물체 수에 비례하는 시간이 걸립니다.
+ */
+static void	sort_by_type(t_bvh_build *b, int start, int end)
+{
+	int	type;
+	int	i;
+	int	n;
+
+	n = 0;
+	type = 0;
+	while (type < PRIM_BOUNDED)
+	{
+		i = start;
+		while (i < end)
+		{
+			if (b->refs[i].type == type)
+				b->tmp[n++] = b->refs[i];
+			i++;
+		}
+		type++;
+	}
+	ft_memcpy(&b->refs[start], b->tmp, sizeof(t_prim_ref) * n);
+}
+
+/*
+ * copy_prim - 물체의 기하 정보를 종류별 배열의 다음 칸에 복사
+ * @b: 빌드 상태 (fill이 종류별 다음 칸 번호)
+ * @ref: 복사할 물체 (accel_slot에 칸 번호를 기록)
+ */
+static void	copy_prim(t_bvh_build *b, t_prim_ref *ref)
+{
+	int	slot;
+
+	slot = b->fill[ref->type]++;
+	ref->obj->accel_slot = slot;
+	if (ref->type == PRIM_SPHERE)
+	{
+		b->acc->spheres[slot] = *(t_sphere *)ref->obj->object;
+		b->acc->sphere_objs[slot] = ref->obj;
+	}
+	else if (ref->type == PRIM_CYLINDER)
+	{
+		b->acc->cylinders[slot] = *(t_cylinder *)ref->obj->object;
+		b->acc->cylinder_objs[slot] = ref->obj;
+	}
+	else
+	{
+		b->acc->instances[slot] = *(t_instance *)ref->obj->object;
+		b->acc->instance_objs[slot] = ref->obj;
+	}
+}
+
+/*
+ * bvh_leaf - 노드를 잎으로 만들고 물체를 종류별 배열에 옮기기
+ * @b: 빌드 상태
+ * @node: 잎이 될 노드
+ * @start: 범위 시작
+ * @end: 범위 끝 (포함하지 않음)
+ *
+ * 잎은 만들어지는 순서대로 배열에 물체를 채우므로, 한 잎의 같은 종류
+ * 물체는 항상 배열에서 연속된 구간 [first, first + count)를 차지합니다.
+ */
+void	bvh_leaf(t_bvh_build *b, t_bvh_node *node, int start, int end)
+{
+	int	type;
+
+	node->child = -1;
+	sort_by_type(b, start, end);
+	type = 0;
+	while (type < PRIM_BOUNDED)
+	{
+		node->first[type] = b->fill[type];
+		node->count[type] = 0;
+		type++;
+	}
+	while (start < end)
+	{
+		node->count[b->refs[start].type]++;
+		copy_prim(b, &b->refs[start++]);
+	}
+}
@@ -0,0 +1,129 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bvh_link.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "accel.h"
+
+/*
+ * prim_index - 종류와 배열 내 번호를 모든 종류에 걸친 번호로 바꾸기
+ * @acc: 가속 구조
+ * @type: PRIM_* (PRIM_BOUNDED 미만)
+ * @slot: 종류별 배열 내 번호
+ *
+ * 구, 원기둥, 배치 순서로 이어 붙인 번호입니다 (refit.leaf의 번호).
+ *
+ * Return: 0 이상 (구 + 원기둥 + 배치 수) 미만의 번호
+ */
+int	prim_index(t_accel *acc, int type, int slot)
+{
+	if (type == PRIM_SPHERE)
+		return (slot);
+	if (type == PRIM_CYLINDER)
+		return (acc->n_spheres + slot);
+	return (acc->n_spheres + acc->n_cylinders + slot);
+}
+
+/*
+ * prim_object - 종류별 배열 칸의 원래 물체
+ * @acc: 가속 구조
+ * @type: PRIM_* (PRIM_BOUNDED 미만)
+ * @slot: 종류별 배열 내 번호
+ *
+ * Return: 그 칸에 기하 정보를 복사해 준 t_object
+ */
+t_object	*prim_object(t_accel *acc, int type, int slot)
+{
+	if (type == PRIM_SPHERE)
+		return (acc->sphere_objs[slot]);
+	if (type == PRIM_CYLINDER)
+		return (acc->cylinder_objs[slot]);
+	return (acc->instance_objs[slot]);
+}
+
+/*
+ * node_weight - SAH 비용에서 노드 표면적에 곱하는 가중치
+ * @node: BVH 노드
+ *
+ * bvh_find_split과 같이 탐색 비용을 1, 물체 하나의 교점 비용을 1로
+ * 봅니다.
+ *
+ * Return: 내부 노드는 1, 잎은 물체 수
+ */
+t_real	node_weight(t_bvh_node *node)
+{
+	int	sum;
+	int	type;
+
+	if (node->child >= 0)
+		return (1);
+	sum = 0;
+	type = 0;
+	while (type < PRIM_BOUNDED)
+		sum += node->count[type++];
+	return (sum);
+}
+
+/*
+ * bvh_link_subtree - 하위 트리의 부모, 잎, 표면적 기록
+ * @acc: refit 배열이 할당된 가속 구조
+ * @node: 하위 트리의 루트
+ * @parent: node의 부모 (루트는 -1)
+ *
+ * 하위 트리의 각 노드 표면적을 area0에 기록하고 refit.cost에 더합니다.
+ * 깊이는 BVH_MAX_DEPTH 이하이므로 재귀로 충분합니다.
+ */
+void	bvh_link_subtree(t_accel *acc, int node, int parent)
+{
+	t_bvh_node	*n;
+	int			type;
+	int			i;
+
+	n = &acc->nodes[node];
+	acc->refit.parent[node] = parent;
+	acc->refit.area0[node] = aabb_area(n->box);
+	acc->refit.cost += node_weight(n) * acc->refit.area0[node];
+	if (n->child >= 0)
+	{
+		bvh_link_subtree(acc, n->child, node);
+		bvh_link_subtree(acc, n->child + 1, node);
+		return ;
+	}
+	type = -1;
+	while (++type < PRIM_BOUNDED)
+	{
+		i = n->first[type];
+		while (i < n->first[type] + n->count[type])
+			acc->refit.leaf[prim_index(acc, type, i++)] = node;
+	}
+}
+
+/*
+ * bvh_link - 물체를 옮긴 뒤 BVH를 고치는 데 필요한 연결 정보 만들기
+ * @acc: 이진 BVH (n_nodes > 0)
+ *
+ * 정적인 장면은 이 정보가 필요 없으므로, 처음 accel_refit을 부를
+ * 때 만듭니다. 노드 상자는 그때까지 만들 때 그대로입니다.
+ *
+ * Return: 1 (성공), 0 (메모리 부족)
+ */
+int	bvh_link(t_accel *acc)
+{
+	acc->refit.parent = malloc(sizeof(int) * acc->n_nodes);
+	acc->refit.area0 = malloc(sizeof(t_real) * acc->n_nodes);
+	acc->refit.leaf = malloc(sizeof(int) * (acc->n_spheres
+				+ acc->n_cylinders + acc->n_instances + 1));
+	if (!acc->refit.parent || !acc->refit.area0 || !acc->refit.leaf)
+		return (0);
+	acc->refit.cost = 0;
+	bvh_link_subtree(acc, 0, -1);
+	acc->refit.built = acc->refit.cost / aabb_area(acc->nodes[0].box);
+	return (1);
+}
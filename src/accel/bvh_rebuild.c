@@ -0,0 +1,184 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bvh_rebuild.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "accel.h"
+#include "vec3_inline.h"
+
+/*
+ * scan_subtree - 하위 트리의 물체 범위, 노드 번호 범위, 비용 모으기
+ * @acc: 가속 구조
+ * @node: 하위 트리의 루트
+ * @st: 모은 결과 (count, cost, last를 0으로 두고 부름)
+ *
+ * 잎은 깊이 우선 순서로 배열을 채웠으므로 (부분 재구성 후에도 같음)
+ * 하위 트리의 같은 종류 물체는 첫 잎의 first부터 마지막 잎의
+ * first + count까지 연속된 구간입니다. 하위 트리의 노드(루트 제외)도
+ * [루트의 child, last] 안에 있습니다.
+ */
+static void	scan_subtree(t_accel *acc, int node, t_subtree *st)
+{
+	t_bvh_node	*n;
+	int			type;
+
+	n = &acc->nodes[node];
+	st->cost += node_weight(n) * aabb_area(n->box);
+	if (n->child >= 0)
+	{
+		if (n->child + 1 > st->last)
+			st->last = n->child + 1;
+		scan_subtree(acc, n->child, st);
+		scan_subtree(acc, n->child + 1, st);
+		return ;
+	}
+	type = -1;
+	while (++type < PRIM_BOUNDED)
+	{
+		if (st->count == 0)
+			st->lo[type] = n->first[type];
+		st->hi[type] = n->first[type] + n->count[type];
+	}
+	st->count += node_weight(n);
+}
+
+/*
+ * gather_refs - 하위 트리의 물체로 BVH 항목 만들기
+ * @acc: 가속 구조
+ * @st: scan_subtree의 결과
+ * @b: 빌드 상태 (refs, tmp를 할당하고 fill을 lo로 맞춤)
+ *
+ * 물체는 옮긴 뒤의 위치로 경계 상자를 다시 구합니다. 새 잎도
+ * 같은 구간을 다시 채우므로 하위 트리 밖의 배열은 그대로입니다.
+ *
+ * Return: 1 (성공), 0 (메모리 부족)
+ */
+static int	gather_refs(t_accel *acc, t_subtree *st, t_bvh_build *b)
+{
+	t_prim_ref	*ref;
+	int			type;
+	int			i;
+
+	b->refs = malloc(sizeof(t_prim_ref) * st->count);
+	b->tmp = malloc(sizeof(t_prim_ref) * st->count);
+	if (!b->refs || !b->tmp)
+		return (0);
+	ref = b->refs;
+	type = -1;
+	while (++type < PRIM_BOUNDED)
+	{
+		b->fill[type] = st->lo[type];
+		i = st->lo[type];
+		while (i < st->hi[type])
+		{
+			ref->obj = prim_object(acc, type, i++);
+			ref->type = prim_bounds(ref->obj, &ref->box);
+			ref->centroid = v3_mul(v3_add(ref->box.min, ref->box.max), 0.5);
+			ref++;
+		}
+	}
+	return (1);
+}
+
+/*
+ * node_depth - 루트로부터의 깊이
+ * @acc: refit.parent가 있는 가속 구조
+ * @node: 노드 번호
+ *
+ * Return: 루트는 0
+ */
+static int	node_depth(t_accel *acc, int node)
+{
+	int	depth;
+
+	depth = 0;
+	while (acc->refit.parent[node] >= 0)
+	{
+		node = acc->refit.parent[node];
+		depth++;
+	}
+	return (depth);
+}
+
+/*
+ * install - 따로 만든 하위 트리를 원래 노드 번호 자리에 옮기기
+ * @acc: 가속 구조
+ * @node: 하위 트리의 루트 번호
+ * @part: 따로 만든 하위 트리 (0번이 루트)
+ * @st: 원래 하위 트리 (scan_subtree의 결과)
+ *
+ * part의 i번(1 이상) 노드는 원래 루트의 child + i - 1번 자리로 가고,
+ * 자식 번호도 같이 옮깁니다. 남는 옛 자리는 더 이상 가리키는 노드가
+ * 없습니다. 옛 노드의 비용은 refit.cost에서 뺍니다.
+ *
+ * Return: 1 (성공), 0 (새 트리가 옛 자리보다 큼)
+ */
+static int	install(t_accel *acc, int node, t_accel *part, t_subtree *st)
+{
+	t_bvh_node	n;
+	int			base;
+	int			i;
+
+	base = acc->nodes[node].child;
+	if (part->n_nodes > 1
+		&& (base < 0 || part->n_nodes - 1 > st->last + 1 - base))
+		return (0);
+	acc->refit.cost -= st->cost;
+	i = 0;
+	while (i < part->n_nodes)
+	{
+		n = part->nodes[i];
+		if (n.child >= 0)
+			n.child += base - 1;
+		if (i == 0)
+			acc->nodes[node] = n;
+		else
+			acc->nodes[base + i - 1] = n;
+		i++;
+	}
+	return (1);
+}
+
+/*
+ * bvh_rebuild_subtree - 품질이 나빠진 하위 트리만 다시 만들기 (부분 재구성)
+ * @acc: refit 정보가 있는 이진 BVH
+ * @node: 다시 만들 하위 트리의 루트 (루트 노드 제외)
+ *
+ * 하위 트리의 물체를 SAH로 다시 나누어 임시 노드 배열에 만든 뒤,
+ * 원래 하위 트리가 쓰던 노드 번호 자리에 옮깁니다. 새 트리가 그
+ * 자리보다 크면 실패합니다. 이때는 물체 배열의 순서가 이미 바뀌었으므로
+ * 가속 구조 전체를 다시 만들어야 합니다.
+ *
+ * Return: 1 (성공), 0 (자리가 모자라거나 메모리 부족)
+ */
+int	bvh_rebuild_subtree(t_accel *acc, int node)
+{
+	t_bvh_build	b;
+	t_subtree	st;
+	t_accel		part;
+	int			ok;
+
+	st.count = 0;
+	st.cost = 0;
+	st.last = 0;
+	scan_subtree(acc, node, &st);
+	part = *acc;
+	part.nodes = NULL;
+	b.acc = &part;
+	b.max_depth = BVH_MAX_DEPTH - node_depth(acc, node);
+	ok = gather_refs(acc, &st, &b) && bvh_build(&b, st.count)
+		&& install(acc, node, &part, &st);
+	free(b.refs);
+	free(b.tmp);
+	free(part.nodes);
+	if (ok)
+		bvh_link_subtree(acc, node, acc->refit.parent[node]);
+	return (ok);
+}
@@ -0,0 +1,158 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bvh_refit.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "accel.h"
+
+/*
+ * leaf_box - 잎에 든 물체들의 현재 경계 상자
+ * @acc: 가속 구조
+ * @node: 잎 노드
+ *
+ * 배열의 복사본이 아니라 원래 물체로 계산하므로, 같은 잎에서 함께
+ * 옮긴 물체가 아직 복사되지 않았어도 상자는 그 물체를 감쌉니다.
+ *
+ * Return: 잎의 모든 물체를 감싸는 상자
+ */
+static t_aabb	leaf_box(t_accel *acc, t_bvh_node *node)
+{
+	t_aabb	box;
+	t_aabb	prim;
+	int		type;
+	int		i;
+
+	box = aabb_empty();
+	type = -1;
+	while (++type < PRIM_BOUNDED)
+	{
+		i = node->first[type];
+		while (i < node->first[type] + node->count[type])
+		{
+			prim_bounds(prim_object(acc, type, i++), &prim);
+			box = aabb_union(box, prim);
+		}
+	}
+	return (box);
+}
+
+/*
+ * set_box - 노드 상자를 바꾸고 SAH 비용 합을 함께 갱신
+ * @acc: 가속 구조
+ * @node: 노드 번호
+ * @box: 새 상자
+ */
+static void	set_box(t_accel *acc, int node, t_aabb box)
+{
+	t_bvh_node	*n;
+
+	n = &acc->nodes[node];
+	acc->refit.cost += node_weight(n) * (aabb_area(box) - aabb_area(n->box));
+	n->box = box;
+}
+
+/*
+ * refit_path - 잎에서 루트까지 상자를 다시 계산
+ * @acc: 가속 구조
+ * @node: 옮긴 물체가 든 잎
+ * @limit: 표면적이 area0의 limit배를 넘으면 품질이 나빠진 노드
+ *
+ * 지나는 노드 수는 트리 깊이이고, 부모 상자는 두 자식 상자의 합입니다.
+ *
+ * Return: 품질이 나빠진 노드 중 루트에 가장 가까운 노드, 없으면 -1
+ */
+static int	refit_path(t_accel *acc, int node, t_real limit)
+{
+	t_bvh_node	*n;
+	int			worst;
+
+	set_box(acc, node, leaf_box(acc, &acc->nodes[node]));
+	worst = -1;
+	while (node >= 0)
+	{
+		if (aabb_area(acc->nodes[node].box)
+			> limit * acc->refit.area0[node])
+			worst = node;
+		node = acc->refit.parent[node];
+		if (node < 0)
+			break ;
+		n = &acc->nodes[node];
+		set_box(acc, node, aabb_union(acc->nodes[n->child].box,
+				acc->nodes[n->child + 1].box));
+	}
+	return (worst);
+}
+
+/*
+ * refit_object - 옮긴 물체 하나를 배열에 다시 복사하고 BVH 고치기
+ * @acc: 가속 구조
+ * @obj: prepare_object를 다시 부른 물체
+ * @limit: 재구성 기준 (accel_refit)
+ *
+ * 평면은 BVH 밖의 배열만 고칩니다. 품질이 나빠진 노드가 있으면
+ * 그 하위 트리를 다시 만듭니다.
+ *
+ * Return: 1 (성공), 0 (루트까지 나빠졌거나 하위 트리를 다시 만들 수 없음)
+ */
+static int	refit_object(t_accel *acc, t_object *obj, t_real limit)
+{
+	t_aabb	box;
+	int		type;
+	int		worst;
+
+	type = prim_bounds(obj, &box);
+	if (obj->type == OBJ_PLANE)
+		plane_soa_set(&acc->planes, obj->accel_slot, (t_plane *)obj->object);
+	if (type < 0)
+		return (1);
+	if (type == PRIM_SPHERE)
+		acc->spheres[obj->accel_slot] = *(t_sphere *)obj->object;
+	else if (type == PRIM_CYLINDER)
+		acc->cylinders[obj->accel_slot] = *(t_cylinder *)obj->object;
+	else
+		acc->instances[obj->accel_slot] = *(t_instance *)obj->object;
+	worst = refit_path(acc, acc->refit.leaf[prim_index(acc, type,
+				obj->accel_slot)], limit);
+	if (worst == 0)
+		return (0);
+	return (worst < 0 || bvh_rebuild_subtree(acc, worst));
+}
+
+/*
+ * accel_refit - 몇몇 물체만 옮겼을 때 BVH를 다시 만들지 않고 고치기
+ * @acc: build_accel로 만든 가속 구조
+ * @moved: 옮긴 물체들 (acc를 만든 물체 목록의 원소, prepare_object 후)
+ * @n: moved의 개수
+ * @limit: 재구성 기준 (REFIT_DEFAULT_LIMIT 참고, 0이면 항상 실패)
+ *
+ * 옮긴 물체마다 잎에서 루트까지 상자를 다시 계산하므로 O(n × 깊이)
+ * 입니다. 표면적이 만들 때의 limit배를 넘은 노드는 그 하위 트리만
+ * 다시 만들고(부분 재구성), 트리 전체의 SAH 비용이 만들 때의
+ * limit배를 넘으면 0을 돌려줍니다.
+ * 이진 BVH만 고칠 수 있습니다 (격자, ACCEL_LIST, BVH=wide는 0).
+ *
+ * Return: 1 (acc를 계속 써도 됨), 0 (build_accel로 다시 만들어야 함)
+ */
+int	accel_refit(t_accel *acc, t_object **moved, int n, t_real limit)
+{
+	int	i;
+
+	if (acc->kind != ACCEL_BVH || BVH_WIDE || acc->n_nodes == 0)
+		return (0);
+	if (!acc->refit.parent && !bvh_link(acc))
+		return (0);
+	i = 0;
+	while (i < n)
+		if (!refit_object(acc, moved[i++], limit))
+			return (0);
+	acc->bounds = acc->nodes[0].box;
+	return (acc->refit.cost / aabb_area(acc->nodes[0].box)
+		<= limit * acc->refit.built);
+}
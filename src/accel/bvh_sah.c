@@ -0,0 +1,175 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bvh_sah.c                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "accel.h"
+#include "vec3_inline.h"
+#include <math.h>
+
+/*
+ * vec_axis - 벡터의 한 성분
+ * @v: 벡터
+ * @axis: 0 (x), 1 (y), 2 (z)
+ *
+ * Return: 선택한 성분
+ */
+t_real	vec_axis(t_vec3 v, int axis)
+{
+	if (axis == 0)
+		return (v.x);
+	if (axis == 1)
+		return (v.y);
+	return (v.z);
+}
+
+/*
+ * choose_axis - centroid가 가장 넓게 퍼진 축 선택
+ * @b: 빌드 상태
+ * @start: 범위 시작
+ * @end: 범위 끝 (포함하지 않음)
+ * @split: axis, min, scale을 채움 (출력)
+ *
+ * 나눌 수 없으면 bin = -1로 두어 partition이 개수로 반씩 나누게 합니다.
+ *
+ * Return: 1 (나눌 수 있음), 0 (모든 centroid가 한 점에 모임)
+ */
+static int	choose_axis(t_bvh_build *b, int start, int end, t_bvh_split *split)
+{
+	t_aabb	cb;
+	t_aabb	point;
+	t_vec3	extent;
+
+	cb = aabb_empty();
+	while (start < end)
+	{
+		point.min = b->refs[start++].centroid;
+		point.max = point.min;
+		cb = aabb_union(cb, point);
+	}
+	extent = v3_sub(cb.max, cb.min);
+	split->axis = 0;
+	if (extent.y > extent.x && extent.y >= extent.z)
+		split->axis = 1;
+	else if (extent.z > extent.x && extent.z > extent.y)
+		split->axis = 2;
+	split->min = vec_axis(cb.min, split->axis);
+	split->scale = 0;
+	split->bin = -1;
+	if (vec_axis(extent, split->axis) <= 0)
+		return (0);
+	split->scale = BVH_BINS / vec_axis(extent, split->axis);
+	return (1);
+}
+
+/*
+ * fill_bins - 각 물체를 centroid 위치에 따라 구간(bin)에 넣기
+ * @b: 빌드 상태
+ * @range: [start, end)
+ * @split: 분할 축과 구간 크기
+ * @bins: BVH_BINS개의 구간 (출력)
+ */
+static void	fill_bins(t_bvh_build *b, int *range, t_bvh_split *split,
+	t_bvh_bin *bins)
+{
+	int	i;
+	int	k;
+
+	i = 0;
+	while (i < BVH_BINS)
+	{
+		bins[i].box = aabb_empty();
+		bins[i++].count = 0;
+	}
+	i = range[0];
+	while (i < range[1])
+	{
+		k = (int)((vec_axis(b->refs[i].centroid, split->axis) - split->min)
+				* split->scale);
+		if (k >= BVH_BINS)
+			k = BVH_BINS - 1;
+		bins[k].box = aabb_union(bins[k].box, b->refs[i].box);
+		bins[k].count++;
+		i++;
+	}
+}
+
+/*
+ * sweep_bins - 구간 경계마다 SAH 비용을 계산해 가장 싼 경계 선택
+ * @bins: 채워진 구간
+ * @split: bin (경계의 왼쪽 마지막 구간), cost를 갱신
+ *         (호출 전에 cost를 무한대로 초기화)
+ *
+ * 경계 i에서 나누면 비용 ∝ 왼쪽 넓이 * 왼쪽 개수 + 오른쪽 넓이 * 오른쪽
+ * 개수입니다. 오른쪽 누적값을 먼저 구해 두고 왼쪽에서 한 번 훑습니다.
+ */
+static void	sweep_bins(t_bvh_bin *bins, t_bvh_split *split)
+{
+	t_real		right_cost[BVH_BINS];
+	t_bvh_bin	acc;
+	int			i;
+
+	acc.box = aabb_empty();
+	acc.count = 0;
+	i = BVH_BINS - 1;
+	while (i > 0)
+	{
+		acc.box = aabb_union(acc.box, bins[i].box);
+		acc.count += bins[i].count;
+		right_cost[i--] = aabb_area(acc.box) * acc.count;
+	}
+	acc.box = aabb_empty();
+	acc.count = 0;
+	while (++i < BVH_BINS - 1)
+	{
+		acc.box = aabb_union(acc.box, bins[i].box);
+		acc.count += bins[i].count;
+		if (aabb_area(acc.box) * acc.count + right_cost[i + 1] < split->cost)
+		{
+			split->cost = aabb_area(acc.box) * acc.count + right_cost[i + 1];
+			split->bin = i;
+		}
+	}
+}
+
+/*
+ * bvh_find_split - [start, end) 범위를 나눌 SAH 경계 찾기
+ * @b: 빌드 상태
+ * @start: 범위 시작
+ * @end: 범위 끝 (포함하지 않음)
+ * @split: 선택한 축과 경계 (출력), cost는 부모 넓이로 나눈 값
+ *
+ * 비용 모델: 노드 방문 1, 물체 교점 검사 1
+ *   잎으로 둘 때 = 물체 수
+ *   나눌 때 = 1 + Σ(자식 넓이 / 부모 넓이 * 자식 물체 수)
+ *
+ * Return: 1 (나누는 편이 더 쌈), 0 (잎으로 두는 편이 더 쌈)
+ */
+int	bvh_find_split(t_bvh_build *b, int start, int end, t_bvh_split *split)
+{
+	t_bvh_bin	bins[BVH_BINS];
+	t_aabb		box;
+	int			range[2];
+	int			i;
+
+	if (!choose_axis(b, start, end, split))
+		return (0);
+	range[0] = start;
+	range[1] = end;
+	fill_bins(b, range, split, bins);
+	split->cost = INFINITY;
+	sweep_bins(bins, split);
+	box = aabb_empty();
+	i = 0;
+	while (i < BVH_BINS)
+		box = aabb_union(box, bins[i++].box);
+	split->cost = 1 + split->cost / aabb_area(box);
+	return (split->cost < end - start);
+}
@@ -0,0 +1,81 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bvh_traverse.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "accel_inline.h"
+
+/*
+ * push_children - 광선이 지나는 자식을 가까운 쪽이 위에 오도록 쌓기
+ * @acc: 가속 구조
+ * @node: 내부 노드
+ * @tr: 탐색 상태
+ * @st: 탐색 스택
+ *
+ * 가까운 자식을 먼저 검사하면 best.t가 빨리 줄어들어
+ * 먼 자식을 꺼낼 때 건너뛸 가능성이 커집니다.
+ */
+static void	push_children(t_accel *acc, t_bvh_node *node, t_trav *tr,
+	t_bvh_stack *st)
+{
+	t_real	t[2];
+	int		near;
+	int		far;
+
+	t[0] = slab_test(&acc->nodes[node->child].box, tr);
+	t[1] = slab_test(&acc->nodes[node->child + 1].box, tr);
+	near = (t[1] < t[0]);
+	far = !near;
+	if (t[far] < INFINITY)
+	{
+		st->node[st->size] = node->child + far;
+		st->t[st->size++] = t[far];
+	}
+	if (t[near] < INFINITY)
+	{
+		st->node[st->size] = node->child + near;
+		st->t[st->size++] = t[near];
+	}
+}
+
+/*
+ * bvh_traverse - BVH를 스택으로 순회하며 잎의 물체 검사
+ * @acc: 가속 구조 (노드가 하나 이상)
+ * @tr: 탐색 상태 (best를 갱신)
+ *
+ * 스택에서 꺼낸 노드가 이미 찾은 교점보다 멀면 건너뜁니다.
+ *
+ * Return: 1 (any 모드에서 교점을 찾음), 0 (순회 완료)
+ */
+int	bvh_traverse(t_accel *acc, t_trav *tr)
+{
+	t_bvh_stack	st;
+	t_bvh_node	*node;
+
+	st.t[0] = slab_test(&acc->nodes[0].box, tr);
+	st.node[0] = 0;
+	st.size = (st.t[0] < INFINITY);
+	while (st.size > 0)
+	{
+		st.size--;
+		node = &acc->nodes[st.node[st.size]];
+		if (st.t[st.size] < tr->best.t)
+		{
+			if (node->child < 0)
+			{
+				if (bvh_visit_leaf(acc, node->first, node->count, tr))
+					return (1);
+			}
+			else
+				push_children(acc, node, tr, &st);
+		}
+	}
+	return (0);
+}
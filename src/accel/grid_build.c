@@ -0,0 +1,146 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   grid_build.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "accel.h"
+
+/*
+ * insert_item - 상자가 겹치는 모든 칸에 물체 항목 넣기
+ * @g: 격자
+ * @r: 칸 범위 (r[0..2]: 최소 칸 좌표, r[3..5]: 최대 칸 좌표)
+ * @item: 물체 항목 (번호 * PRIM_BOUNDED + 종류)
+ * @fill: 0이면 칸마다 개수만 세고 (start[c + 1]), 1이면 items에 기록
+ */
+static void	insert_item(t_grid *g, int *r, int item, int fill)
+{
+	int	c[3];
+	int	cell;
+
+	c[2] = r[2];
+	while (c[2] <= r[5])
+	{
+		c[1] = r[1];
+		while (c[1] <= r[4])
+		{
+			c[0] = r[0];
+			while (c[0] <= r[3])
+			{
+				cell = (c[2] * g->res[1] + c[1]) * g->res[0] + c[0];
+				if (fill)
+					g->items[g->start[cell]++] = item;
+				else
+					g->start[cell + 1]++;
+				c[0]++;
+			}
+			c[1]++;
+		}
+		c[2]++;
+	}
+}
+
+/*
+ * grid_fill - 모든 물체를 격자에 넣기 (개수 세기 또는 기록)
+ * @b: 빌드 상태 (refs는 종류 순서로 정렬되어 있음)
+ * @count: 물체 수
+ * @fill: insert_item 참고
+ *
+ * refs가 종류별 배열과 같은 순서이므로, 종류별 배열 내 번호는
+ * 앞선 종류의 물체 수를 뺀 값입니다.
+ */
+static void	grid_fill(t_bvh_build *b, int count, int fill)
+{
+	t_prim_ref	*ref;
+	int			r[6];
+	int			index;
+	int			i;
+
+	i = 0;
+	while (i < count)
+	{
+		ref = &b->refs[i];
+		grid_cell_coord(&b->acc->grid, ref->box.min, r);
+		grid_cell_coord(&b->acc->grid, ref->box.max, r + 3);
+		index = i - (ref->type > PRIM_SPHERE) * b->acc->n_spheres
+			- (ref->type > PRIM_CYLINDER) * b->acc->n_cylinders;
+		insert_item(&b->acc->grid, r, index * PRIM_BOUNDED + ref->type,
+			fill);
+		i++;
+	}
+}
+
+/*
+ * grid_count - 칸별 물체 수를 세어 start를 시작 위치로 만들기
+ * @b: 빌드 상태
+ * @count: 물체 수
+ *
+ * Return: 1 (성공), 0 (메모리 부족)
+ */
+static int	grid_count(t_bvh_build *b, int count)
+{
+	t_grid	*g;
+	int		i;
+
+	g = &b->acc->grid;
+	g->start = malloc(sizeof(int) * (g->n_cells + 1));
+	if (!g->start)
+		return (0);
+	i = 0;
+	while (i <= g->n_cells)
+		g->start[i++] = 0;
+	grid_fill(b, count, 0);
+	i = 0;
+	while (i < g->n_cells)
+	{
+		g->start[i + 1] += g->start[i];
+		i++;
+	}
+	g->n_items = g->start[g->n_cells];
+	return (1);
+}
+
+/*
+ * grid_build - b->refs의 물체들로 균일 격자 만들기
+ * @b: 물체 목록(refs)과 결과를 담을 가속 구조 (bounds는 계산됨)
+ * @count: 물체 수
+ *
+ * 모든 물체를 잎 하나처럼 종류별 배열에 옮긴 뒤, 각 물체의 상자가
+ * 겹치는 칸마다 항목을 넣습니다 (칸별 개수 → 시작 위치 → 기록).
+ * 기록하는 동안 start[c]가 다음 칸의 시작으로 밀리므로 마지막에
+ * 한 칸씩 되돌립니다.
+ *
+ * Return: 1 (성공), 0 (메모리 부족)
+ */
+int	grid_build(t_bvh_build *b, int count)
+{
+	t_bvh_node	all;
+	t_grid		*g;
+	int			i;
+
+	bvh_leaf(b, &all, 0, count);
+	if (count == 0)
+		return (1);
+	g = &b->acc->grid;
+	grid_setup(g, b->acc->bounds, GRID_DENSITY, count);
+	if (!grid_count(b, count))
+		return (0);
+	g->items = malloc(sizeof(int) * (g->n_items + 1));
+	if (!g->items)
+		return (0);
+	grid_fill(b, count, 1);
+	i = g->n_cells;
+	while (i > 0)
+	{
+		g->start[i] = g->start[i - 1];
+		i--;
+	}
+	g->start[0] = 0;
+	return (1);
+}
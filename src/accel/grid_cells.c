@@ -0,0 +1,73 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   grid_cells.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "accel.h"
+#include <math.h>
+
+/*
+ * grid_setup - 상자를 물체 수에 맞는 크기의 칸으로 나누기
+ * @g: 격자 (box, origin, cell, inv_cell, res, n_cells를 채움)
+ * @box: 격자가 덮을 상자 (물체 상자의 합, RT_EPSILON만큼 넓혀져 있음)
+ * @density: 물체 하나당 칸 수
+ * @count: 물체 수 (1 이상)
+ *
+ * 칸이 정육면체에 가깝도록 한 변의 칸 수를 상자의 변 길이에 비례해
+ * 정합니다: res[a] = ceil(d[a] * cbrt(density * count / 부피)).
+ * 축마다 1 ~ GRID_MAX_RES칸입니다.
+ */
+void	grid_setup(t_grid *g, t_aabb box, t_real density, int count)
+{
+	t_real	d;
+	t_real	k;
+	int		a;
+
+	g->box = box;
+	d = (box.max.x - box.min.x) * (box.max.y - box.min.y)
+		* (box.max.z - box.min.z);
+	k = cbrt(density * count / d);
+	a = 0;
+	while (a < 3)
+	{
+		g->origin[a] = vec_axis(box.min, a);
+		d = vec_axis(box.max, a) - g->origin[a];
+		g->res[a] = (int)fmin(fmax(ceil(d * k), 1), GRID_MAX_RES);
+		g->cell[a] = d / g->res[a];
+		g->inv_cell[a] = g->res[a] / d;
+		a++;
+	}
+	g->n_cells = g->res[0] * g->res[1] * g->res[2];
+}
+
+/*
+ * grid_cell_coord - 점이 들어 있는 칸의 좌표
+ * @g: 격자
+ * @p: 점
+ * @idx: 칸의 x, y, z 좌표 (출력, 격자 밖의 점은 가장 가까운 칸)
+ */
+void	grid_cell_coord(t_grid *g, t_vec3 p, int *idx)
+{
+	t_real	v;
+	int		a;
+
+	a = 0;
+	while (a < 3)
+	{
+		v = (vec_axis(p, a) - g->origin[a]) * g->inv_cell[a];
+		if (!(v >= 0))
+			idx[a] = 0;
+		else if (v >= g->res[a])
+			idx[a] = g->res[a] - 1;
+		else
+			idx[a] = (int)v;
+		a++;
+	}
+}
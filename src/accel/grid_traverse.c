@@ -0,0 +1,111 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   grid_traverse.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "accel_inline.h"
+
+/*
+ * dda_init - 광선이 격자에 들어가는 칸과 축별 진행 상태 계산
+ * @g: 격자
+ * @tr: 탐색 상태
+ * @d: DDA 상태 (출력)
+ * @t0: 광선이 격자 상자에 들어가는 t
+ *
+ * next[a]는 a축 방향으로 다음 칸 경계를 지나는 t, delta[a]는 한 칸을
+ * 지나는 데 드는 t입니다. 방향 성분이 0인 축은 경계를 지나지 않습니다.
+ */
+static void	dda_init(t_grid *g, t_trav *tr, t_dda *d, t_real t0)
+{
+	t_real	dir;
+	int		a;
+
+	grid_cell_coord(g, v3_add(tr->ray.origin,
+			v3_mul(tr->ray.direction, t0)), d->idx);
+	a = 0;
+	while (a < 3)
+	{
+		dir = vec_axis(tr->ray.direction, a);
+		d->step[a] = (dir > 0) - (dir < 0);
+		d->next[a] = INFINITY;
+		d->delta[a] = INFINITY;
+		if (dir != 0)
+		{
+			d->next[a] = (g->origin[a] + (d->idx[a] + (dir > 0))
+					* g->cell[a] - vec_axis(tr->ray.origin, a)) / dir;
+			d->delta[a] = g->cell[a] / RT_FABS(dir);
+		}
+		a++;
+	}
+}
+
+/*
+ * visit_cell - 칸 하나의 물체 검사
+ * @acc: 가속 구조
+ * @cell: 칸 번호
+ * @tr: 탐색 상태
+ *
+ * Return: 1 (any 모드에서 교점을 찾음), 0 (계속)
+ */
+static int	visit_cell(t_accel *acc, int cell, t_trav *tr)
+{
+	int	i;
+	int	end;
+
+	i = acc->grid.start[cell];
+	end = acc->grid.start[cell + 1];
+	while (i < end)
+	{
+		if (prim_item(acc, acc->grid.items[i], tr))
+			return (1);
+		i++;
+	}
+	return (0);
+}
+
+/*
+ * grid_traverse - 3D-DDA로 광선이 지나는 칸을 가까운 순서로 검사
+ * @acc: 가속 구조 (kind == ACCEL_GRID)
+ * @tr: 탐색 상태
+ *
+ * 칸을 검사한 뒤 찾은 교점이 그 칸을 벗어나는 t보다 가까우면 멈춥니다.
+ * 더 먼 칸의 물체는 그보다 가까운 교점을 가질 수 없기 때문입니다.
+ * 여러 칸에 걸친 물체는 칸마다 다시 검사될 수 있습니다.
+ *
+ * Return: 1 (any 모드에서 교점을 찾음), 0 (탐색 완료)
+ */
+int	grid_traverse(t_accel *acc, t_trav *tr)
+{
+	t_dda	d;
+	t_real	t0;
+	int		a;
+
+	if (acc->grid.n_cells == 0)
+		return (0);
+	t0 = slab_test(&acc->grid.box, tr);
+	if (t0 == INFINITY)
+		return (0);
+	dda_init(&acc->grid, tr, &d, t0);
+	while (1)
+	{
+		if (visit_cell(acc, (d.idx[2] * acc->grid.res[1] + d.idx[1])
+				* acc->grid.res[0] + d.idx[0], tr))
+			return (1);
+		a = (d.next[1] < d.next[0]);
+		if (d.next[2] < d.next[a])
+			a = 2;
+		if (tr->best.t <= d.next[a])
+			return (0);
+		d.idx[a] += d.step[a];
+		if (d.idx[a] < 0 || d.idx[a] >= acc->grid.res[a])
+			return (0);
+		d.next[a] += d.delta[a];
+	}
+}
@@ -0,0 +1,119 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   instance_hit.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "accel.h"
+#include "vec3_inline.h"
+#include <math.h>
+
+/*
+ * box_corner - 상자의 꼭짓점 하나
+ * @box: 상자
+ * @i: 꼭짓점 번호 (0 ~ 7, 비트 0/1/2가 x/y/z축의 max 여부)
+ *
+ * Return: 꼭짓점
+ */
+static t_vec3	box_corner(t_aabb *box, int i)
+{
+	t_vec3	corner;
+
+	corner = box->min;
+	if (i & 1)
+		corner.x = box->max.x;
+	if (i & 2)
+		corner.y = box->max.y;
+	if (i & 4)
+		corner.z = box->max.z;
+	return (corner);
+}
+
+/*
+ * instance_bounds - 배치의 세계 좌표 경계 상자
+ * @inst: prepare_instance가 준비한 배치
+ * @box: 경계 상자 (출력)
+ *
+ * 그룹 가속 구조의 로컬 상자 꼭짓점 8개를 세계 좌표로 옮겨 감쌉니다.
+ * 회전한 상자를 다시 축에 맞춰 감싸므로 실제보다 조금 클 수 있습니다.
+ *
+ * Return: 1 (성공), 0 (그룹이 비었거나 가속 구조가 없음)
+ */
+int	instance_bounds(t_instance *inst, t_aabb *box)
+{
+	t_aabb	corner;
+	int		i;
+
+	if (!inst->group->accel
+		|| inst->group->accel->bounds.min.x > inst->group->accel->bounds.max.x)
+		return (0);
+	*box = aabb_empty();
+	i = 0;
+	while (i < 8)
+	{
+		corner.min = box_corner(&inst->group->accel->bounds, i);
+		corner.min = v3_add(inst->position, v3_mul(
+					instance_dir_to_world(inst, corner.min), inst->scale));
+		corner.max = corner.min;
+		*box = aabb_union(*box, corner);
+		i++;
+	}
+	return (1);
+}
+
+/*
+ * local_trav - 세계 좌표의 탐색 상태를 그룹의 로컬 좌표로 옮기기
+ * @inst: 배치
+ * @tr: 세계 좌표의 탐색 상태
+ * @local: 로컬 좌표의 탐색 상태 (출력)
+ *
+ * 방향은 회전만 하므로 단위 벡터 그대로이고, 거리는 1 / scale배가
+ * 됩니다. 현재까지의 best.t도 같은 비율로 줄여 그보다 먼 교점은
+ * 그룹 안에서도 건너뜁니다.
+ */
+static void	local_trav(t_instance *inst, t_trav *tr, t_trav *local)
+{
+	local->ray.origin = instance_point_to_local(inst, tr->ray.origin);
+	local->ray.direction = instance_dir_to_local(inst, tr->ray.direction);
+	local->inv_dir = v3_new(1.0 / local->ray.direction.x,
+			1.0 / local->ray.direction.y, 1.0 / local->ray.direction.z);
+	local->best.t = tr->best.t * inst->inv_scale;
+	local->any = tr->any;
+}
+
+/*
+ * instance_hit - 배치 하나와 광선의 교점 (BVH 잎의 PRIM_INSTANCE)
+ * @inst: 배치
+ * @index: 가속 구조의 배치 배열 내 번호
+ * @tr: 탐색 상태 (더 가까운 교점이면 best를 갱신)
+ *
+ * 그룹의 가속 구조를 로컬 좌표로 탐색하고, 찾은 거리에 scale을 곱해
+ * 세계 거리로 되돌립니다. 만난 그룹의 물체는 best.obj에 남깁니다.
+ *
+ * Return: 1 (any 모드에서 교점을 찾음, 탐색 중단), 0 (계속)
+ */
+int	instance_hit(t_instance *inst, int index, t_trav *tr)
+{
+	t_trav	local;
+	t_real	limit;
+	t_hit	hit;
+
+	local_trav(inst, tr, &local);
+	limit = local.best.t;
+	if (accel_trace(inst->group->accel, &local))
+		return (1);
+	if (!(local.best.t < limit))
+		return (0);
+	accel_resolve(inst->group->accel, &local.best, &hit);
+	tr->best.t = local.best.t * inst->scale;
+	tr->best.type = PRIM_INSTANCE;
+	tr->best.index = index;
+	tr->best.obj = hit.object;
+	return (tr->any);
+}
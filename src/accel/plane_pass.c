@@ -0,0 +1,130 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   plane_pass.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "accel.h"
+#include <math.h>
+
+/*
+ * plane_soa_init - 평면 배열(SoA) 할당
+ * @soa: 채울 배열
+ * @n: 평면 수
+ *
+ * 성분마다 따로 된 배열 여섯 개를 한 번에 할당합니다. 길이는
+ * PLANE_BLOCK의 배수로 올림하고, 남는 칸은 법선이 0인 평면으로
+ * 채워 둡니다 (분모가 0이므로 절대 교점이 생기지 않음).
+ *
+ * Return: 1 (성공), 0 (메모리 부족, soa->px는 NULL)
+ */
+int	plane_soa_init(t_plane_soa *soa, int n)
+{
+	int	i;
+
+	soa->size = (n + PLANE_BLOCK - 1) / PLANE_BLOCK * PLANE_BLOCK;
+	soa->px = malloc(sizeof(t_real) * 6 * (soa->size + 1));
+	if (!soa->px)
+		return (0);
+	soa->py = soa->px + soa->size;
+	soa->pz = soa->py + soa->size;
+	soa->nx = soa->pz + soa->size;
+	soa->ny = soa->nx + soa->size;
+	soa->nz = soa->ny + soa->size;
+	i = 0;
+	while (i < 6 * soa->size)
+		soa->px[i++] = 0;
+	return (1);
+}
+
+/*
+ * plane_soa_set - i번째 칸에 평면 저장
+ * @soa: 평면 배열
+ * @i: 칸 번호
+ * @pl: prepare_plane이 준비한 평면
+ */
+void	plane_soa_set(t_plane_soa *soa, int i, t_plane *pl)
+{
+	soa->px[i] = pl->point.x;
+	soa->py[i] = pl->point.y;
+	soa->pz[i] = pl->point.z;
+	soa->nx[i] = pl->normal.x;
+	soa->ny[i] = pl->normal.y;
+	soa->nz[i] = pl->normal.z;
+}
+
+/*
+ * plane_block - PLANE_BLOCK개 평면의 분모와 t를 한 번에 계산
+ * @soa: 평면 배열
+ * @base: 블록의 첫 칸
+ * @ray: 광선
+ * @out: out[0..]에 분모, out[PLANE_BLOCK..]에 t (출력)
+ *
+ * 분기가 없고 반복 횟수가 고정된 반복문이라 컴파일러가 SIMD로
+ * 바꿀 수 있습니다. 식과 계산 순서는 intersect_plane과 같으므로
+ * 결과도 비트 단위로 같습니다. 평행한 평면의 t는 inf나 NaN이
+ * 될 수 있지만 plane_pass가 분모를 보고 버립니다.
+ */
+static void	plane_block(t_plane_soa *soa, int base, t_ray *ray, t_real *out)
+{
+	int	i;
+
+	i = 0;
+	while (i < PLANE_BLOCK)
+	{
+		out[i] = ray->direction.x * soa->nx[base + i]
+			+ ray->direction.y * soa->ny[base + i]
+			+ ray->direction.z * soa->nz[base + i];
+		out[PLANE_BLOCK + i] = ((soa->px[base + i] - ray->origin.x)
+				* soa->nx[base + i]
+				+ (soa->py[base + i] - ray->origin.y) * soa->ny[base + i]
+				+ (soa->pz[base + i] - ray->origin.z) * soa->nz[base + i])
+			/ out[i];
+		i++;
+	}
+}
+
+/*
+ * plane_pass - 모든 평면을 검사해 tr->best 갱신
+ * @acc: 가속 구조
+ * @tr: 탐색 상태
+ *
+ * BVH 탐색보다 먼저 실행합니다. 가장 가까운 평면의 t가 best.t가
+ * 되므로, 바닥이나 벽 뒤에 있는 BVH 노드는 slab 검사에서 바로
+ * 걸러집니다.
+ *
+ * Return: 1 (any 모드에서 교점을 찾음), 0 (계속)
+ */
+int	plane_pass(t_accel *acc, t_trav *tr)
+{
+	t_real	out[2 * PLANE_BLOCK];
+	int		base;
+	int		i;
+
+	base = 0;
+	while (base < acc->n_planes)
+	{
+		plane_block(&acc->planes, base, &tr->ray, out);
+		i = -1;
+		while (++i < PLANE_BLOCK && base + i < acc->n_planes)
+		{
+			if (RT_FABS(out[i]) > RT_EPSILON && out[PLANE_BLOCK + i]
+				> RT_EPSILON && out[PLANE_BLOCK + i] < tr->best.t)
+			{
+				tr->best.t = out[PLANE_BLOCK + i];
+				tr->best.type = PRIM_PLANE;
+				tr->best.index = base + i;
+				if (tr->any)
+					return (1);
+			}
+		}
+		base += PLANE_BLOCK;
+	}
+	return (0);
+}
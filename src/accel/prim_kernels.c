@@ -0,0 +1,124 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   prim_kernels.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "accel.h"
+
+/*
+ * 잎 안의 종류별 반복문
+ *
+ * 각 커널은 배열의 [first, first + count) 구간을 같은 교점 함수로
+ * 검사합니다. 물체마다 종류를 비교하던 분기가 없으므로 반복문이
+ * 단순하고, 같은 종류의 기하 정보가 메모리에 연속으로 놓입니다.
+ * tr->any가 켜져 있으면 (그림자 광선) 처음 찾은 교점에서 멈춥니다.
+ *
+ * Return: 1 (any 모드에서 교점을 찾음, 탐색 중단), 0 (계속)
+ */
+int	kernel_spheres(t_accel *acc, int first, int count, t_trav *tr)
+{
+	t_real	t;
+	int		end;
+
+	end = first + count;
+	while (first < end)
+	{
+		t = intersect_sphere(tr->ray, &acc->spheres[first]);
+		if (t > 0 && t < tr->best.t)
+		{
+			tr->best.t = t;
+			tr->best.type = PRIM_SPHERE;
+			tr->best.index = first;
+			if (tr->any)
+				return (1);
+		}
+		first++;
+	}
+	return (0);
+}
+
+int	kernel_cylinders(t_accel *acc, int first, int count, t_trav *tr)
+{
+	t_real	t;
+	int		end;
+
+	end = first + count;
+	while (first < end)
+	{
+		t = intersect_cylinder(tr->ray, &acc->cylinders[first]);
+		if (t > 0 && t < tr->best.t)
+		{
+			tr->best.t = t;
+			tr->best.type = PRIM_CYLINDER;
+			tr->best.index = first;
+			if (tr->any)
+				return (1);
+		}
+		first++;
+	}
+	return (0);
+}
+
+int	kernel_instances(t_accel *acc, int first, int count, t_trav *tr)
+{
+	int	end;
+
+	end = first + count;
+	while (first < end)
+	{
+		if (instance_hit(&acc->instances[first], first, tr))
+			return (1);
+		first++;
+	}
+	return (0);
+}
+
+/*
+ * bvh_visit_leaf - 잎의 물체를 종류별 커널로 검사
+ * @acc: 가속 구조
+ * @first: 종류별 배열 내 시작 번호
+ * @count: 종류별 물체 수
+ * @tr: 탐색 상태
+ *
+ * 새로운 종류는 g_kernels에 커널을 하나 추가하면 됩니다.
+ *
+ * Return: 1 (any 모드에서 교점을 찾음), 0 (계속)
+ */
+int	bvh_visit_leaf(t_accel *acc, int *first, int *count, t_trav *tr)
+{
+	static const t_prim_kernel	g_kernels[PRIM_BOUNDED] = {
+		kernel_spheres, kernel_cylinders, kernel_instances};
+	int							type;
+
+	type = 0;
+	while (type < PRIM_BOUNDED)
+	{
+		if (count[type] && g_kernels[type](acc, first[type], count[type], tr))
+			return (1);
+		type++;
+	}
+	return (0);
+}
+
+/*
+ * prim_item - 격자 항목 하나를 종류별 커널로 검사
+ * @acc: 가속 구조
+ * @item: 격자 항목 (번호 * PRIM_BOUNDED + 종류)
+ * @tr: 탐색 상태
+ *
+ * Return: 1 (any 모드에서 교점을 찾음), 0 (계속)
+ */
+int	prim_item(t_accel *acc, int item, t_trav *tr)
+{
+	static const t_prim_kernel	g_kernels[PRIM_BOUNDED] = {
+		kernel_spheres, kernel_cylinders, kernel_instances};
+
+	return (g_kernels[item % PRIM_BOUNDED](acc, item / PRIM_BOUNDED, 1, tr));
+}
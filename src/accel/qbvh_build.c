@@ -0,0 +1,155 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   qbvh_build.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "accel.h"
+
+/*
+ * widest - 고른 자식 중 겉넓이가 가장 큰 내부 노드
+ * @acc: 이진 BVH가 있는 가속 구조
+ * @slot: 고른 이진 노드 번호들
+ * @n: 고른 수
+ *
+ * Return: slot 안의 위치, 모두 잎이면 -1
+ */
+static int	widest(t_accel *acc, int *slot, int n)
+{
+	int	best;
+	int	i;
+
+	best = -1;
+	i = 0;
+	while (i < n)
+	{
+		if (acc->nodes[slot[i]].child >= 0 && (best < 0
+				|| aabb_area(acc->nodes[slot[i]].box)
+				> aabb_area(acc->nodes[slot[best]].box)))
+			best = i;
+		i++;
+	}
+	return (best);
+}
+
+/*
+ * gather - 이진 노드 아래에서 최대 QBVH_WIDTH개의 자식 고르기
+ * @acc: 이진 BVH가 있는 가속 구조
+ * @idx: 이진 노드 번호
+ * @slot: 고른 이진 노드 번호들 (출력)
+ *
+ * 두 자식에서 시작해, 내부 노드 중 겉넓이가 가장 큰 것을 그 두
+ * 자식으로 바꾸는 일을 칸이 찰 때까지 반복합니다. 루트 자체가 잎이면
+ * 그 잎 하나만 고릅니다.
+ *
+ * Return: 고른 자식 수
+ */
+static int	gather(t_accel *acc, int idx, int *slot)
+{
+	int	n;
+	int	best;
+
+	slot[0] = idx;
+	if (acc->nodes[idx].child < 0)
+		return (1);
+	slot[0] = acc->nodes[idx].child;
+	slot[1] = slot[0] + 1;
+	n = 2;
+	best = widest(acc, slot, n);
+	while (n < QBVH_WIDTH && best >= 0)
+	{
+		slot[n++] = acc->nodes[slot[best]].child + 1;
+		slot[best] = acc->nodes[slot[best]].child;
+		best = widest(acc, slot, n);
+	}
+	return (n);
+}
+
+/*
+ * leaf_slot - 이진 잎을 잎 배열에 옮기고 자식 번호로 인코딩
+ * @acc: 가속 구조
+ * @node: 이진 잎 노드
+ *
+ * Return: -(잎 번호 + 1)
+ */
+static int	leaf_slot(t_accel *acc, t_bvh_node *node)
+{
+	int	type;
+
+	type = 0;
+	while (type < PRIM_BOUNDED)
+	{
+		acc->leaves[acc->n_leaves].first[type] = node->first[type];
+		acc->leaves[acc->n_leaves].count[type] = node->count[type];
+		type++;
+	}
+	return (-(acc->n_leaves++) - 1);
+}
+
+/*
+ * build_wide - 이진 노드 bin을 4갈래 노드 wide로 옮기기 (재귀)
+ * @acc: 가속 구조
+ * @bin: 이진 노드 번호
+ * @wide: 채울 4갈래 노드 번호
+ */
+static void	build_wide(t_accel *acc, int bin, int wide)
+{
+	t_qbvh_node	*q;
+	int			slot[QBVH_WIDTH];
+	int			n;
+	int			i;
+
+	n = gather(acc, bin, slot);
+	q = &acc->wide[wide];
+	qbvh_set_frame(q, &acc->nodes[bin].box);
+	i = 0;
+	while (i < QBVH_WIDTH)
+		q->child[i++] = QBVH_EMPTY;
+	i = -1;
+	while (++i < n)
+	{
+		qbvh_quantize(q, i, &acc->nodes[slot[i]].box);
+		if (acc->nodes[slot[i]].child < 0)
+			q->child[i] = leaf_slot(acc, &acc->nodes[slot[i]]);
+		else
+		{
+			q->child[i] = acc->n_wide++;
+			build_wide(acc, slot[i], q->child[i]);
+		}
+	}
+}
+
+/*
+ * qbvh_build - 이진 BVH를 4갈래 양자화 BVH로 바꾸기
+ * @acc: bvh_build가 끝난 가속 구조
+ *
+ * 4갈래 노드와 잎의 수는 이진 노드 수를 넘지 않습니다. 노드 배열은
+ * 캐시 라인(64바이트) 경계에 맞춰 할당하고, 다 옮긴 뒤 이진 노드는
+ * 해제합니다.
+ *
+ * Return: 1 (성공), 0 (메모리 부족)
+ */
+int	qbvh_build(t_accel *acc)
+{
+	size_t	bytes;
+
+	if (acc->n_nodes == 0)
+		return (1);
+	bytes = (sizeof(t_qbvh_node) * acc->n_nodes + 63) / 64 * 64;
+	acc->wide = aligned_alloc(64, bytes);
+	acc->leaves = malloc(sizeof(t_bvh_leaf) * acc->n_nodes);
+	if (!acc->wide || !acc->leaves)
+		return (0);
+	acc->n_wide = 1;
+	build_wide(acc, 0, 0);
+	free(acc->nodes);
+	acc->nodes = NULL;
+	acc->n_nodes = 0;
+	return (1);
+}
@@ -0,0 +1,114 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   qbvh_quant.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "accel_inline.h"
+
+/*
+ * round_down - x 이하인 가장 가까운 float
+ * @x: 좌표
+ *
+ * Return: (float)x가 x보다 크면 그 바로 아래 float, 아니면 (float)x
+ */
+static float	round_down(t_real x)
+{
+	float	f;
+
+	f = (float)x;
+	if (f > x)
+		f = nextafterf(f, -INFINITY);
+	return (f);
+}
+
+/*
+ * qbvh_set_frame - 부모 상자로 양자화 기준(origin, scale) 정하기
+ * @q: 채울 노드 (모든 칸의 lo, hi도 0으로 초기화)
+ * @box: 부모 상자
+ *
+ * origin은 상자의 min 이하로 내림하고, scale은 코드 255가 상자의
+ * max 이상이 될 때까지 float 한 칸씩 키웁니다. 따라서 0 ~ 255 안의
+ * 코드로 부모 상자 안의 어떤 좌표든 보수적으로 나타낼 수 있습니다.
+ */
+void	qbvh_set_frame(t_qbvh_node *q, t_aabb *box)
+{
+	int	a;
+	int	i;
+
+	a = 0;
+	while (a < 3)
+	{
+		i = 0;
+		while (i < QBVH_WIDTH)
+		{
+			q->lo[a][i] = 0;
+			q->hi[a][i++] = 0;
+		}
+		q->origin[a] = round_down(vec_axis(box->min, a));
+		q->scale[a] = (float)((vec_axis(box->max, a) - q->origin[a]) / 255);
+		while (qbvh_dequant(q, a, 255) < vec_axis(box->max, a))
+			q->scale[a] = nextafterf(q->scale[a], INFINITY);
+		a++;
+	}
+}
+
+/*
+ * quantize_axis - 한 축의 [min, max]를 감싸는 가장 좁은 코드 쌍
+ * @q: 기준이 정해진 노드
+ * @a: 축
+ * @range: 자식 상자의 [min, max]
+ * @code: 코드 [lo, hi] (출력)
+ *
+ * 나눗셈으로 구한 코드를 qbvh_dequant로 되돌려 확인하고, 감싸지
+ * 못하면 한 칸씩 넓힙니다. 탐색도 qbvh_dequant를 쓰므로 되돌린 상자는
+ * 반올림 오차와 관계없이 항상 원래 상자를 감쌉니다.
+ */
+static void	quantize_axis(t_qbvh_node *q, int a, t_real *range, int *code)
+{
+	code[0] = 0;
+	code[1] = 255;
+	if (q->scale[a] > 0)
+	{
+		code[0] = (int)fmax(0, floor((range[0] - q->origin[a]) / q->scale[a]));
+		code[1] = (int)fmin(255, ceil((range[1] - q->origin[a]) / q->scale[a]));
+	}
+	if (code[0] > 255)
+		code[0] = 255;
+	if (code[1] < 0)
+		code[1] = 0;
+	while (code[0] > 0 && qbvh_dequant(q, a, code[0]) > range[0])
+		code[0]--;
+	while (code[1] < 255 && qbvh_dequant(q, a, code[1]) < range[1])
+		code[1]++;
+}
+
+/*
+ * qbvh_quantize - slot번째 자식의 상자를 8비트 코드로 저장
+ * @q: qbvh_set_frame으로 기준을 정한 노드
+ * @slot: 0 ~ QBVH_WIDTH - 1
+ * @box: 자식 상자 (부모 상자 안에 있어야 함)
+ */
+void	qbvh_quantize(t_qbvh_node *q, int slot, t_aabb *box)
+{
+	t_real	range[2];
+	int		code[2];
+	int		a;
+
+	a = 0;
+	while (a < 3)
+	{
+		range[0] = vec_axis(box->min, a);
+		range[1] = vec_axis(box->max, a);
+		quantize_axis(q, a, range, code);
+		q->lo[a][slot] = (unsigned char)code[0];
+		q->hi[a][slot] = (unsigned char)code[1];
+		a++;
+	}
+}
@@ -0,0 +1,143 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   qbvh_traverse.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "accel_inline.h"
+
+/*
+ * push_sorted - 후보 자식을 먼 것부터 쌓아 가장 가까운 것이 위에 오게
+ * @st: 탐색 스택
+ * @child: 자식 번호 (인코딩된 값)
+ * @t: 각 자식 상자에 들어가는 t
+ * @n: 후보 수 (최대 QBVH_WIDTH)
+ */
+static void	push_sorted(t_bvh_stack *st, int *child, t_real *t, int n)
+{
+	int		i;
+	int		far;
+
+	while (n > 0)
+	{
+		far = 0;
+		i = 1;
+		while (i < n)
+		{
+			if (t[i] > t[far])
+				far = i;
+			i++;
+		}
+		st->node[st->size] = child[far];
+		st->t[st->size++] = t[far];
+		child[far] = child[--n];
+		t[far] = t[n];
+	}
+}
+
+/*
+ * child_entry - slot번째 자식 상자에 들어가는 t
+ * @q: 4갈래 노드
+ * @slot: 자식 칸
+ * @ab: 축마다 (origin - 광선 원점) / 방향, scale / 방향
+ * @tr: 탐색 상태
+ *
+ * 코드 c인 경계 평면까지의 거리는 ab[a] + c * ab[3 + a]이므로
+ * 상자를 실수 좌표로 되돌리지 않고 곱셈 한 번으로 구합니다.
+ * 반올림 차이는 경계 상자에 더해 둔 RT_EPSILON 여유 안에 듭니다.
+ *
+ * Return: 상자에 들어가는 t (0 이상), 만나지 않으면 INFINITY
+ */
+static t_real	child_entry(t_qbvh_node *q, int slot, t_real *ab, t_trav *tr)
+{
+	t_real	range[2];
+	int		a;
+
+	range[0] = 0;
+	range[1] = tr->best.t;
+	a = 0;
+	while (a < 3)
+	{
+		slab_axis(ab[a] + q->lo[a][slot] * ab[3 + a],
+			ab[a] + q->hi[a][slot] * ab[3 + a], range);
+		a++;
+	}
+	if (range[0] > range[1])
+		return (INFINITY);
+	return (range[0]);
+}
+
+/*
+ * push_wide - 4갈래 노드에서 광선이 지나는 자식들을 스택에 쌓기
+ * @q: 4갈래 노드
+ * @tr: 탐색 상태
+ * @st: 탐색 스택
+ *
+ * 자식 상자는 8비트 코드가 나타내는 보수적인 상자이므로,
+ * 실제 상자보다 조금 커서 가끔 더 방문할 뿐 교점을 놓치지 않습니다.
+ */
+static void	push_wide(t_qbvh_node *q, t_trav *tr, t_bvh_stack *st)
+{
+	t_real	ab[6];
+	t_real	t[QBVH_WIDTH];
+	int		child[QBVH_WIDTH];
+	int		n;
+	int		i;
+
+	ab[0] = (q->origin[0] - tr->ray.origin.x) * tr->inv_dir.x;
+	ab[1] = (q->origin[1] - tr->ray.origin.y) * tr->inv_dir.y;
+	ab[2] = (q->origin[2] - tr->ray.origin.z) * tr->inv_dir.z;
+	ab[3] = q->scale[0] * tr->inv_dir.x;
+	ab[4] = q->scale[1] * tr->inv_dir.y;
+	ab[5] = q->scale[2] * tr->inv_dir.z;
+	n = 0;
+	i = 0;
+	while (i < QBVH_WIDTH && q->child[i] != QBVH_EMPTY)
+	{
+		t[n] = child_entry(q, i, ab, tr);
+		child[n] = q->child[i++];
+		n += (t[n] < INFINITY);
+	}
+	push_sorted(st, child, t, n);
+}
+
+/*
+ * qbvh_traverse - 4갈래 양자화 BVH를 스택으로 순회하며 잎 검사
+ * @acc: qbvh_build가 끝난 가속 구조 (노드가 하나 이상)
+ * @tr: 탐색 상태 (best를 갱신)
+ *
+ * 루트 상자는 저장하지 않으므로 루트는 t = 0으로 넣고, 자식 상자에서
+ * 처음 걸러냅니다. 꺼낸 항목이 이미 찾은 교점보다 멀면 건너뜁니다.
+ *
+ * Return: 1 (any 모드에서 교점을 찾음), 0 (순회 완료)
+ */
+int	qbvh_traverse(t_accel *acc, t_trav *tr)
+{
+	t_bvh_stack	st;
+	t_bvh_leaf	*leaf;
+	int			code;
+
+	st.node[0] = 0;
+	st.t[0] = 0;
+	st.size = 1;
+	while (st.size > 0)
+	{
+		st.size--;
+		code = st.node[st.size];
+		if (st.t[st.size] < tr->best.t && code < 0)
+		{
+			leaf = &acc->leaves[-code - 1];
+			if (bvh_visit_leaf(acc, leaf->first, leaf->count, tr))
+				return (1);
+		}
+		else if (st.t[st.size] < tr->best.t)
+			push_wide(&acc->wide[code], tr, &st);
+	}
+	return (0);
+}
@@ -0,0 +1,167 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   tile_bins.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "accel.h"
+
+/*
+ * insert_item - 타일 범위의 모든 타일에 물체 항목 넣기
+ * @bins: 타일 후보 목록
+ * @r: 타일 범위 (tile_rect)
+ * @item: 물체 항목 (번호 * PRIM_BOUNDED + 종류)
+ * @fill: 0이면 타일마다 개수만 세고, 1이면 목록을 쓰는 타일에만 기록
+ */
+static void	insert_item(t_tile_bins *bins, int *r, int item, int fill)
+{
+	int	x;
+	int	y;
+	int	t;
+
+	y = r[1];
+	while (y <= r[3])
+	{
+		x = r[0];
+		while (x <= r[2])
+		{
+			t = y * TILE_COLS + x;
+			if (!fill)
+				bins->count[t]++;
+			else if (bins->count[t] >= 0)
+				bins->items[bins->start[t] + bins->count[t]++] = item;
+			x++;
+		}
+		y++;
+	}
+}
+
+/*
+ * bin_object - 물체 하나를 그 경계 상자를 덮는 타일에 넣기
+ * @bins: 타일 후보 목록
+ * @scene: 카메라와 가속 구조
+ * @i: 구, 원기둥, 배치 순서의 전체 번호 (prim_index)
+ * @fill: insert_item 참고
+ *
+ * Return: 넣은 항목 수 (덮는 타일 수)
+ */
+static long	bin_object(t_tile_bins *bins, t_scene *scene, int i, int fill)
+{
+	t_accel	*acc;
+	t_aabb	box;
+	int		r[4];
+	int		type;
+	int		slot;
+
+	acc = scene->accel;
+	type = (i >= acc->n_spheres) + (i >= acc->n_spheres + acc->n_cylinders);
+	slot = i - prim_index(acc, type, 0);
+	prim_bounds(prim_object(acc, type, slot), &box);
+	if (!tile_rect(&scene->camera, &box, r))
+		return (0);
+	insert_item(bins, r, slot * PRIM_BOUNDED + type, fill);
+	return ((long)(r[2] - r[0] + 1) *(r[3] - r[1] + 1));
+}
+
+/*
+ * bin_objects - 크기가 있는 모든 물체를 타일에 넣기
+ * @bins: 타일 후보 목록
+ * @scene: 카메라와 가속 구조
+ * @fill: insert_item 참고
+ * @budget: 넣은 항목 수가 이보다 많아지면 멈춤
+ *
+ * 개수를 셀 때는 먼저 모든 타일의 count를 0으로 둡니다.
+ *
+ * Return: 넣은 항목 수 (멈췄으면 budget보다 큼)
+ */
+static long	bin_objects(t_tile_bins *bins, t_scene *scene, int fill,
+	long budget)
+{
+	t_accel	*acc;
+	long	total;
+	int		i;
+
+	acc = scene->accel;
+	i = 0;
+	while (!fill && i < TILE_COUNT)
+		bins->count[i++] = 0;
+	total = 0;
+	i = 0;
+	while (i < acc->n_spheres + acc->n_cylinders + acc->n_instances
+		&& total <= budget)
+		total += bin_object(bins, scene, i++, fill);
+	return (total);
+}
+
+/*
+ * set_offsets - 타일별 개수로 목록 시작 위치 정하기
+ * @bins: 개수를 센 타일 후보 목록
+ *
+ * 후보가 TILE_MAX_CANDIDATES보다 많은 타일은 count를 -1로 두어 목록
+ * 대신 가속 구조를 쓰게 합니다. 나머지 타일의 count는 기록하며 다시
+ * 세도록 0으로 돌립니다.
+ *
+ * Return: 목록에 기록할 항목 수
+ */
+static int	set_offsets(t_tile_bins *bins)
+{
+	int	total;
+	int	t;
+
+	total = 0;
+	t = 0;
+	while (t < TILE_COUNT)
+	{
+		bins->start[t] = total;
+		if (bins->count[t] > TILE_MAX_CANDIDATES)
+			bins->count[t] = -1;
+		else
+		{
+			total += bins->count[t];
+			bins->count[t] = 0;
+		}
+		t++;
+	}
+	return (total);
+}
+
+/*
+ * tile_bins_build - 현재 카메라로 화면 타일별 후보 목록 만들기
+ * @bins: 채울 타일 후보 목록 (이전 내용은 무시)
+ * @scene: prepare_scene이 끝난 장면 (scene->accel이 있어야 함)
+ *
+ * 물체를 타일에 넣은 항목 수가 TILE_MAX_CANDIDATES × 타일 수의 두
+ * 배를 넘으면 대부분의 타일이 목록을 쓰지 못하므로 세기를 멈추고
+ * 실패합니다. 그래서 물체가 아주 많거나 큰 장면에서도 만드는 비용은
+ * 물체 수와 타일 수에 비례합니다.
+ *
+ * Return: 1 (성공), 0 (목록 없이 가속 구조만 쓸 것, bins는 비어 있음)
+ */
+int	tile_bins_build(t_tile_bins *bins, t_scene *scene)
+{
+	long	budget;
+
+	bins->queries = NULL;
+	bins->count = malloc(sizeof(int) * TILE_COUNT);
+	bins->start = malloc(sizeof(int) * TILE_COUNT);
+	bins->items = NULL;
+	budget = 2L * TILE_MAX_CANDIDATES * TILE_COUNT;
+	if (bins->count && bins->start
+		&& bin_objects(bins, scene, 0, budget) <= budget)
+	{
+		bins->items = malloc(sizeof(int) * (set_offsets(bins) + 1));
+		if (bins->items)
+		{
+			bin_objects(bins, scene, 1, budget);
+			return (1);
+		}
+	}
+	tile_bins_free(bins);
+	return (0);
+}
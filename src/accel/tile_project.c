@@ -0,0 +1,133 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   tile_project.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "accel.h"
+#include "vec3_inline.h"
+
+/*
+ * project_point - 점을 화면의 픽셀 좌표로 투영
+ * @cam: prepare_scene이 준비한 카메라
+ * @p: 세계 좌표의 점
+ * @xy: 픽셀 좌표 (출력, get_ray의 i, j와 같은 단위)
+ *
+ * get_ray의 식을 거꾸로 풉니다. 픽셀 (i, j)의 광선은 카메라 좌표로
+ * (x, y, 1) 방향이므로 x = (2(i + 0.5) / W - 1) tan aspect에서 i를
+ * 구합니다. 픽셀 중심이 정수 좌표이므로 점이 든 픽셀은 반올림으로
+ * 구합니다 (재투영, render_reproject.c).
+ *
+ * Return: 1 (카메라 앞), 0 (카메라 뒤 또는 카메라 평면 위)
+ */
+int	project_point(t_camera *cam, t_vec3 p, t_real *xy)
+{
+	t_vec3	d;
+	t_real	z;
+
+	d = v3_sub(p, cam->position);
+	z = v3_dot(d, cam->forward);
+	if (z <= 0)
+		return (0);
+	xy[0] = (v3_dot(d, cam->right) / (z * cam->tan_half_fov
+				* ((t_real)WIDTH / HEIGHT)) + 1) * WIDTH / 2 - 0.5;
+	xy[1] = (1 - v3_dot(d, cam->up) / (z * cam->tan_half_fov))
+		* HEIGHT / 2 - 0.5;
+	return (1);
+}
+
+/*
+ * tile_px_rect - 픽셀 범위를 한 픽셀 넓혀 화면 안으로 자르고 타일 범위로
+ * @px: 픽셀 범위 (최소 x, 최소 y, 최대 x, 최대 y)
+ * @rect: 타일 범위 (출력, 같은 순서, 양 끝 포함)
+ *
+ * 반올림 오차를 덮도록 한 픽셀씩 넓힙니다.
+ *
+ * Return: 1 (화면과 겹침), 0 (화면 밖)
+ */
+int	tile_px_rect(t_real *px, int *rect)
+{
+	if (px[2] < -1 || px[3] < -1 || px[0] > WIDTH || px[1] > HEIGHT)
+		return (0);
+	rect[0] = (int)fmax(0, px[0] - 1) / TILE_SIZE;
+	rect[1] = (int)fmax(0, px[1] - 1) / TILE_SIZE;
+	rect[2] = (int)fmin(WIDTH - 1, px[2] + 1) / TILE_SIZE;
+	rect[3] = (int)fmin(HEIGHT - 1, px[3] + 1) / TILE_SIZE;
+	return (1);
+}
+
+/*
+ * project_box - 경계 상자의 꼭짓점 8개를 투영한 픽셀 범위
+ * @cam: 카메라
+ * @box: 세계 좌표의 경계 상자
+ * @px: 카메라 앞 꼭짓점들의 픽셀 범위 (빈 범위로 두고 부름,
+ *      tile_px_rect 참고)
+ *
+ * Return: 카메라 앞에 있는 꼭짓점 수
+ */
+static int	project_box(t_camera *cam, t_aabb *box, t_real *px)
+{
+	t_vec3	ends[2];
+	t_real	xy[2];
+	int		front;
+	int		k;
+
+	ends[0] = box->min;
+	ends[1] = box->max;
+	front = 0;
+	k = -1;
+	while (++k < 8)
+	{
+		if (project_point(cam, v3_new(ends[k & 1].x, ends[(k >> 1) & 1].y,
+					ends[(k >> 2) & 1].z), xy))
+		{
+			front++;
+			px[0] = fmin(px[0], xy[0]);
+			px[1] = fmin(px[1], xy[1]);
+			px[2] = fmax(px[2], xy[0]);
+			px[3] = fmax(px[3], xy[1]);
+		}
+	}
+	return (front);
+}
+
+/*
+ * tile_rect - 경계 상자를 덮는 화면 타일 범위
+ * @cam: 카메라
+ * @box: 세계 좌표의 경계 상자
+ * @rect: 타일 범위 (출력, 최소 x, 최소 y, 최대 x, 최대 y, 양 끝 포함)
+ *
+ * 상자의 꼭짓점을 투영한 범위는 상자 전체의 투영을 덮습니다
+ * (모든 꼭짓점이 카메라 앞일 때). 카메라 광선은 카메라 앞만 지나므로
+ * 모든 꼭짓점이 뒤에 있으면 어떤 카메라 광선도 상자와 만나지 않습니다.
+ * 일부만 앞에 있으면 화면 전체를 덮는다고 봅니다.
+ *
+ * Return: 1 (rect를 채움), 0 (어떤 타일과도 겹치지 않음)
+ */
+int	tile_rect(t_camera *cam, t_aabb *box, int *rect)
+{
+	t_real	px[4];
+	int		front;
+
+	px[0] = INFINITY;
+	px[1] = INFINITY;
+	px[2] = -INFINITY;
+	px[3] = -INFINITY;
+	front = project_box(cam, box, px);
+	if (front == 0)
+		return (0);
+	if (front < 8)
+	{
+		px[0] = 0;
+		px[1] = 0;
+		px[2] = WIDTH;
+		px[3] = HEIGHT;
+	}
+	return (tile_px_rect(px, rect));
+}
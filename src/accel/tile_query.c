@@ -0,0 +1,73 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   tile_query.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "accel.h"
+#include "vec3_inline.h"
+#include <math.h>
+
+/*
+ * tile_closest - 카메라 광선을 타일의 후보 목록으로 검사
+ * @scene: 장면 정보
+ * @bins: tile_bins_build로 만든 후보 목록 (NULL이면 쓰지 않음)
+ * @tile: 광선이 지나는 픽셀의 타일 번호
+ * @ray: 그 픽셀의 카메라 광선 (get_ray)
+ *
+ * 평면 배열을 검사한 뒤 후보만 종류별 커널로 검사합니다. 후보가
+ * 없는 타일은 평면만 검사합니다. 목록이 없거나 후보가 너무 많은
+ * 타일은 find_closest_intersection과 같습니다.
+ *
+ * Return: 교점 정보 (find_closest_intersection과 같은 형식)
+ */
+t_hit	tile_closest(t_scene *scene, t_tile_bins *bins, int tile, t_ray ray)
+{
+	t_trav	tr;
+	t_hit	hit;
+	int		i;
+
+	if (bins && bins->queries)
+		bins->queries[tile]++;
+	if (!bins || !bins->count || bins->count[tile] < 0)
+		return (find_closest_intersection(scene, ray));
+	tr.ray = ray;
+	tr.inv_dir = v3_new(1.0 / ray.direction.x, 1.0 / ray.direction.y,
+			1.0 / ray.direction.z);
+	tr.best.t = INFINITY;
+	tr.any = 0;
+	plane_pass(scene->accel, &tr);
+	i = bins->start[tile];
+	while (i < bins->start[tile] + bins->count[tile])
+		prim_item(scene->accel, bins->items[i++], &tr);
+	hit.t = -1;
+	hit.object = NULL;
+	hit.instance = NULL;
+	if (tr.best.t == INFINITY)
+		return (hit);
+	hit.t = tr.best.t;
+	accel_resolve(scene->accel, &tr.best, &hit);
+	return (hit);
+}
+
+/*
+ * tile_bins_free - 타일 후보 목록의 메모리 해제
+ * @bins: 해제할 목록 (구조체 자체는 해제하지 않음)
+ *
+ * 해제한 뒤에는 tile_closest가 가속 구조만 씁니다.
+ */
+void	tile_bins_free(t_tile_bins *bins)
+{
+	free(bins->count);
+	free(bins->start);
+	free(bins->items);
+	bins->count = NULL;
+	bins->start = NULL;
+	bins->items = NULL;
+}
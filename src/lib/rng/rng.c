@@ -0,0 +1,81 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   rng.c                                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "rng.h"
+#include <math.h>
+
+/*
+ * rng_next - splitmix64 난수 생성기
+ * @state: 생성기 상태 (갱신됨)
+ *
+ * libc의 rand()와 달리 플랫폼에 관계없이 같은 시드에서
+ * 항상 같은 수열을 만듭니다. 차등 테스트의 실패 사례 재현과
+ * 장면 생성기의 결정적 출력에 사용합니다.
+ *
+ * Return: 64비트 난수
+ */
+unsigned long long	rng_next(unsigned long long *state)
+{
+	unsigned long long	z;
+
+	*state += 0x9E3779B97F4A7C15ULL;
+	z = *state;
+	z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+	z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+	return (z ^ (z >> 31));
+}
+
+/*
+ * rng_range - [lo, hi) 구간의 균등 분포 실수
+ */
+double	rng_range(unsigned long long *state, double lo, double hi)
+{
+	double	unit;
+
+	unit = (rng_next(state) >> 11) * (1.0 / 9007199254740992.0);
+	return (lo + (hi - lo) * unit);
+}
+
+/*
+ * rng_point - 한 변이 2 * extent인 정육면체 안의 임의의 점
+ */
+t_vec3	rng_point(unsigned long long *state, double extent)
+{
+	t_vec3	p;
+
+	p.x = rng_range(state, -extent, extent);
+	p.y = rng_range(state, -extent, extent);
+	p.z = rng_range(state, -extent, extent);
+	return (p);
+}
+
+/*
+ * rng_unit - 구면 위에 균등하게 분포한 단위 벡터
+ *
+ * z를 [-1, 1]에서, 방위각을 [0, 2π)에서 뽑는 방식으로
+ * 방향이 한쪽으로 치우치지 않게 합니다.
+ */
+t_vec3	rng_unit(unsigned long long *state)
+{
+	double	z;
+	double	phi;
+	double	r;
+	t_vec3	v;
+
+	z = rng_range(state, -1.0, 1.0);
+	phi = rng_range(state, 0.0, 2.0 * M_PI);
+	r = sqrt(1.0 - z * z);
+	v.x = r * cos(phi);
+	v.y = r * sin(phi);
+	v.z = z;
+	return (v);
+}
@@ -26,7 +26,7 @@
  *
  * Return: 나눗셈 결과 벡터
  */
-t_vec3	vec3_div(t_vec3 v, double t)
+t_vec3	vec3_div(t_vec3 v, t_real t)
 {
 	t_vec3	result;
 
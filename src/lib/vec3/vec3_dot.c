@@ -28,7 +28,7 @@
  *
  * Return: 내적 결과 (스칼라 값)
  */
-double	vec3_dot(t_vec3 v1, t_vec3 v2)
+t_real	vec3_dot(t_vec3 v1, t_vec3 v2)
 {
 	return (v1.x * v2.x + v1.y * v2.y + v1.z * v2.z);
 }
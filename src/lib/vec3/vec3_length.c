@@ -28,7 +28,7 @@
  *
  * Return: 벡터의 길이 (항상 0 이상의 실수)
  */
-double	vec3_length(t_vec3 v)
+t_real	vec3_length(t_vec3 v)
 {
-	return (sqrt(vec3_dot(v, v)));
+	return (RT_SQRT(vec3_dot(v, v)));
 }
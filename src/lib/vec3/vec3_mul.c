@@ -25,7 +25,7 @@
  *
  * Return: 스칼라 곱셈 결과 벡터
  */
-t_vec3	vec3_mul(t_vec3 v, double t)
+t_vec3	vec3_mul(t_vec3 v, t_real t)
 {
 	t_vec3	result;
 
@@ -26,7 +26,7 @@
  *
  * Return: 초기화된 t_vec3 구조체
  */
-t_vec3	vec3_new(double x, double y, double z)
+t_vec3	vec3_new(t_real x, t_real y, t_real z)
 {
 	t_vec3	result;
 
@@ -10,33 +10,18 @@
 /*                                                                            */
 /* ************************************************************************** */
 
-#include "minirt.h"
+#include "render.h"
+#include "server.h"
+#include "libft.h"
 #include <mlx.h>
 
 int	handle_key(int keycode, t_mlx_data *data);
 
-/*
- * check_args - 커맨드 라인 인자 검증
- * @argc: 인자 개수
- *
- * 프로그램 실행 시 올바른 인자가 제공되었는지 확인합니다.
- * 사용법: ./miniRT <scene.rt>
- *
- * Return: 1 (성공), 0 (실패)
- */
-static int	check_args(int argc)
-{
-	if (argc != 2)
-	{
-		printf("Error\nUsage: ./miniRT <scene.rt>\n");
-		return (0);
-	}
-	return (1);
-}
-
 /*
  * init_scene - 장면 파일 파싱 및 초기화
  * @filename: .rt 장면 파일 경로
+ * @opt: 커맨드 라인 옵션 (가속 구조, 픽셀 순서, --aa나 --time-budget이면
+ *       안티앨리어싱)
  *
  * 장면 파일을 읽어서 파싱하고 내부 데이터 구조로 변환합니다.
  * 장면 파일에는 다음 정보가 포함됩니다:
@@ -47,9 +32,11 @@ static int	check_args(int argc)
  * - pl: 평면 (Plane)
  * - cy: 원기둥 (Cylinder)
  *
+ * 파싱 후 prepare_scene으로 렌더링에 필요한 불변값을 미리 계산합니다.
+ *
  * Return: 파싱된 장면 구조체, 실패 시 NULL
  */
-static t_scene	*init_scene(char *filename)
+static t_scene	*init_scene(char *filename, t_options *opt)
 {
 	t_scene	*scene;
 
@@ -57,24 +44,58 @@ static t_scene	*init_scene(char *filename)
 	scene = parse_scene(filename);
 	if (!scene)
 		return (NULL);
+	scene->accel_mode = opt->accel_mode;
+	scene->pixel_order = opt->pixel_order;
+	scene->antialias = (opt->antialias || opt->budget_ms > 0);
+	prepare_scene(scene);
 	return (scene);
 }
 
+/*
+ * start_pool - 작업 스레드를 만들고 첫 프레임 시작
+ * @data: MLX 데이터 (data->pool을 채움, 만들 수 없으면 NULL)
+ * @scene: 렌더링할 장면
+ * @opt: 커맨드 라인 옵션 (gbuffer, budget_ms)
+ *
+ * --gbuffer이면 작업 스레드가 교점을 기록해 R 키로 광원만 바꿀 때
+ * 다시 씁니다 (pool_gbuffer). --aa도 그 교점으로 가장자리를 찾으므로
+ * G-버퍼를 켭니다. --time-budget이면 낮은 해상도부터 시작해 예산
+ * 안에서 다듬습니다 (pool_budget). 예산은 check_args를 부른 때부터
+ * 재므로 파싱과 prepare_scene의 시간도 들어갑니다.
+ */
+static void	start_pool(t_mlx_data *data, t_scene *scene, t_options *opt)
+{
+	data->pool = pool_start(scene, data, 0);
+	if (!data->pool)
+		return ;
+	if (opt->gbuffer || scene->antialias)
+		pool_gbuffer(data->pool);
+	if (opt->budget_ms > 0)
+		pool_budget(data->pool, opt->start, opt->budget_ms);
+	pool_render(data->pool);
+}
+
 /*
  * init_and_render - MLX 초기화 및 렌더링 수행
  * @scene: 렌더링할 장면
+ * @opt: 커맨드 라인 옵션 (progressive, 나머지는 start_pool)
  *
  * MiniLibX를 초기화하고 레이트레이싱을 수행합니다.
  *
  * 동작 과정:
  * 1. MLX 초기화 (창, 이미지 버퍼 생성)
- * 2. 장면 렌더링 (render_scene)
- *    - 모든 픽셀에 대해 레이트레이싱 수행
+ * 2. 장면 렌더링
+ *    - 작업 스레드들이 타일별로 레이트레이싱 수행 (pool_render)
  * 3. BMP 파일로 저장 (output.bmp)
  *
+ * 2, 3은 창을 띄운 뒤에 진행되고, loop_hook이 끝난 타일을 표시하고
+ * 완성된 이미지를 저장합니다. 점진적 렌더링이면 loop_hook이 직접
+ * 나누어 렌더링합니다 (progress_start). 작업 스레드를 만들 수 없으면
+ * 창을 띄우기 전에 이 스레드에서 렌더링합니다 (render_scene).
+ *
  * Return: 초기화된 MLX 데이터, 실패 시 NULL
  */
-static t_mlx_data	*init_and_render(t_scene *scene)
+static t_mlx_data	*init_and_render(t_scene *scene, t_options *opt)
 {
 	t_mlx_data	*data;
 
@@ -85,6 +106,12 @@ static t_mlx_data	*init_and_render(t_scene *scene)
 		printf("Error\nFailed to initialize MLX\n");
 		return (NULL);
 	}
+	if (opt->progressive)
+		data->progress = progress_start(scene, data);
+	else
+		start_pool(data, scene, opt);
+	if (data->progress || data->pool)
+		return (data);
 	printf("Rendering scene...\n");
 	render_scene(scene, data);
 	printf("Saving to output.bmp...\n");
@@ -100,11 +127,12 @@ static t_mlx_data	*init_and_render(t_scene *scene)
  * miniRT 레이트레이서의 메인 함수입니다.
  *
  * 실행 흐름:
- * 1. 커맨드 라인 인자 검증
+ * 1. 커맨드 라인 인자 검증 (--serve이면 창 없이 렌더 서버 실행)
  * 2. 장면 파일 파싱
- * 3. MLX 초기화 및 렌더링
+ * 3. MLX 초기화 및 렌더링 (점진적 렌더링이면 창을 먼저 띄움)
  * 4. 이벤트 핸들러 등록
- *    - 키보드 입력 (ESC로 종료)
+ *    - 키보드 입력 (ESC로 종료, WASD로 카메라 이동, R로 광원 다시 읽기)
+ *    - --watch이면 장면 파일을 저장할 때마다 다시 읽기 (watch_start)
  *    - 창 닫기 이벤트
  *    - 화면 갱신 이벤트
  * 5. 이벤트 루프 시작 (창 유지)
@@ -120,18 +148,24 @@ int	main(int argc, char **argv)
 {
 	t_scene		*scene;
 	t_mlx_data	*data;
+	t_options	opt;
 
-	if (!check_args(argc))
+	if (argc == 3 && !ft_strcmp(argv[1], "--serve"))
+		return (server_run(argv[2]));
+	if (!check_args(argc, argv, &opt))
 		return (1);
-	scene = init_scene(argv[1]);
+	scene = init_scene(argv[1], &opt);
 	if (!scene)
 		return (1);
-	data = init_and_render(scene);
+	data = init_and_render(scene, &opt);
 	if (!data)
 		return (1);
+	data->scene_path = argv[1];
+	if (opt.watch && data->pool)
+		data->watch = watch_start(argv[1], &scene->camera);
 	printf("Done! Displaying (ESC to exit).\n");
 	mlx_loop_hook(data->mlx, (int (*)(void *))loop_hook, data);
-	mlx_key_hook(data->win, handle_key, data);
+	mlx_hook(data->win, EVENT_KEY_PRESS, 1L << 0, handle_key, data);
 	mlx_hook(data->win, EVENT_CLOSE, 0, close_window, data);
 	mlx_hook(data->win, EVENT_EXPOSE, 0, expose_hook, data);
 	mlx_loop(data->mlx);
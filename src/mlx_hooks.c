@@ -10,7 +10,7 @@
 /*                                                                            */
 /* ************************************************************************** */
 
-#include "minirt.h"
+#include "render.h"
 #include <mlx.h>
 
 /*
@@ -31,19 +31,48 @@ void	display_image(t_mlx_data *data)
  * @data: MLX 데이터
  *
  * MLX의 메인 루프에서 매 프레임마다 호출됩니다.
- * 아직 이미지가 표시되지 않았으면 표시합니다.
- * 
- * 이 함수는 프로그램 시작 시 한 번만 이미지를 표시하고,
+ *
+ * --time-budget의 마감이 되면 렌더링을 멈추고, 그때까지 끝난 타일을
+ * 옮긴 창 이미지를 저장합니다 (budget_expired).
+ * --watch이면 먼저 장면 파일이 저장되었는지 보고, 저장되었으면 바뀐
+ * 부분만 옮겨 다시 렌더링합니다 (pool_watch).
+ * 백그라운드 렌더링 중이면 작업 스레드가 끝낸 타일을 창 이미지로
+ * 옮기고 (pool_swap) 창에 표시합니다. 모든 타일이 옮겨졌을 때 낮은
+ * 해상도 프레임이면 해상도를 올려 다시 렌더링하고 (view_refine),
+ * 전체 해상도이면 (--aa이면 가장자리를 다시 샘플링한 뒤) 완성된
+ * 이미지를 output.bmp로 저장합니다.
+ * 점진적 렌더링 중이면 다음 PROGRESSIVE_BATCH 샘플을 렌더링하고
+ * 바로 창에 표시합니다. 마지막 단계가 끝나면 output.bmp로 저장합니다.
+ * 그렇지 않으면 아직 이미지가 표시되지 않았을 때 한 번만 표시하고,
  * 이후에는 아무 작업도 하지 않습니다.
  *
  * Return: 0 (계속 실행)
  */
 int	loop_hook(t_mlx_data *data)
 {
-	if (!data->img_displayed)
+	int	done;
+
+	done = (data->pool && budget_expired(data->pool));
+	if (data->watch && data->pool)
+		pool_watch(data->pool, data->watch);
+	if (data->pool && pool_swap(data->pool) > 0)
+	{
+		display_image(data);
+		done = (done || (data->pool->shown == TILE_COUNT
+					&& view_refine(data->pool)));
+	}
+	else if (data->progress && data->progress->step > 0)
 	{
-		mlx_put_image_to_window(data->mlx, data->win, data->img, 0, 0);
-		data->img_displayed = 1;
+		progress_step(data->progress, PROGRESSIVE_BATCH);
+		display_image(data);
+		done = (data->progress->step == 0);
+	}
+	else if (!data->img_displayed)
+		display_image(data);
+	if (done)
+	{
+		printf("Saving to output.bmp...\n");
+		save_to_bmp(data, "output.bmp");
 	}
 	return (0);
 }
@@ -70,14 +99,19 @@ int	expose_hook(t_mlx_data *data)
  * 창의 X 버튼을 클릭하거나 프로그램을 종료할 때 호출됩니다.
  * 
  * 정리 작업:
- * 1. 이미지 메모리 해제
- * 2. 창 파괴
- * 3. 프로그램 종료
+ * 1. 렌더링 작업 스레드 종료 (렌더링 중인 타일 하나만 기다림),
+ *    장면 파일 감시 종료
+ * 2. 이미지 메모리 해제
+ * 3. 창 파괴
+ * 4. 프로그램 종료
  *
  * Return: 0 (실제로는 exit로 종료됨)
  */
 int	close_window(t_mlx_data *data)
 {
+	if (data->pool)
+		pool_stop(data->pool);
+	watch_stop(data->watch);
 	if (data->img)
 		mlx_destroy_image(data->mlx, data->img);
 	if (data->win)
@@ -92,12 +126,18 @@ int	close_window(t_mlx_data *data)
  * @data: MLX 데이터
  *
  * 키보드 입력을 처리합니다.
- * 현재는 ESC 키만 처리하여 프로그램을 종료합니다.
+ * ESC 키는 프로그램을 종료합니다. 다른 키는 렌더링 중인 프레임을
+ * 취소하고 다시 렌더링합니다 (view_key). WASD는 카메라를 옮기고
+ * 움직이는 동안 낮은 해상도로 렌더링합니다. 렌더링은 작업 스레드가
+ * 하므로 모두 바로 반응합니다. 키를 누르고 있으면 자동 반복으로
+ * 계속 움직이도록 키를 뗄 때가 아니라 누를 때 호출됩니다
+ * (EVENT_KEY_PRESS). R 키는 장면 파일의 광원과 환경광만 다시 읽고
+ * (scene_reload_lights), 카메라가 그대로이므로 G-버퍼가 있으면 광선
+ * 추적 없이 조명만 다시 계산합니다 (pool_relight).
  *
  * 확장 가능성:
- * - 방향키로 카메라 이동
+ * - 방향키로 카메라 회전
  * - 숫자 키로 다른 장면 로드
- * - 스페이스바로 렌더링 재시작
  *
  * Return: 0
  */
@@ -105,5 +145,14 @@ int	handle_key(int keycode, t_mlx_data *data)
 {
 	if (keycode == KEY_ESC)
 		close_window(data);
+	else if (keycode == KEY_R && data->pool)
+	{
+		pool_cancel(data->pool);
+		if (!scene_reload_lights(data->pool->frame.scene, data->scene_path))
+			printf("Error\nCannot reload lights from %s\n", data->scene_path);
+		pool_relight(data->pool);
+	}
+	else if (data->pool)
+		view_key(data->pool, keycode);
 	return (0);
 }
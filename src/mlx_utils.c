@@ -42,6 +42,10 @@ t_mlx_data	*init_mlx(void)
 	if (!data)
 		return (NULL);
 	data->img_displayed = 0;
+	data->progress = NULL;
+	data->pool = NULL;
+	data->scene_path = NULL;
+	data->watch = NULL;
 	if (!init_mlx_connection(data))
 	{
 		free(data);
@@ -0,0 +1,108 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   options.c                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "render.h"
+#include "libft.h"
+
+/*
+ * print_usage - 인자를 다 읽은 뒤 잘못되었으면 사용법 출력
+ * @argc: 인자 개수
+ * @opt: check_args가 채운 옵션
+ *
+ * Return: 1 (올바름), 0 (사용법을 출력함, check_args의 실패)
+ */
+static int	print_usage(int argc, t_options *opt)
+{
+	if (argc >= 2 && opt->accel_mode >= 0 && opt->pixel_order >= 0
+		&& opt->budget_ms >= 0)
+		return (1);
+	printf("Error\nUsage: ./miniRT <scene.rt> [--accel auto|none|bvh|grid]"
+		" [--order tile|scanline|morton|hilbert] [--progressive]"
+		" [--gbuffer] [--watch] [--aa] [--time-budget 2s|500ms]\n"
+		"       ./miniRT --serve <socket>\n");
+	return (0);
+}
+
+/*
+ * flag_field - 값이 없는 옵션이 켜는 필드
+ * @opt: 옵션
+ * @arg: 인자
+ *
+ * Return: --progressive, --gbuffer, --watch, --aa의 필드,
+ *         값이 없는 옵션이 아니면 NULL
+ */
+static int	*flag_field(t_options *opt, char *arg)
+{
+	if (!ft_strcmp(arg, "--progressive"))
+		return (&opt->progressive);
+	if (!ft_strcmp(arg, "--gbuffer"))
+		return (&opt->gbuffer);
+	if (!ft_strcmp(arg, "--watch"))
+		return (&opt->watch);
+	if (!ft_strcmp(arg, "--aa"))
+		return (&opt->antialias);
+	return (NULL);
+}
+
+/*
+ * options_init - 옵션을 기본값으로 채우기
+ * @opt: 채울 옵션
+ *
+ * --time-budget의 예산을 잴 시작 시각 (start)도 여기서 기록합니다.
+ */
+static void	options_init(t_options *opt)
+{
+	opt->accel_mode = ACCEL_AUTO;
+	opt->pixel_order = ORDER_TILE;
+	opt->progressive = 0;
+	opt->gbuffer = 0;
+	opt->watch = 0;
+	opt->antialias = 0;
+	opt->budget_ms = 0;
+	opt->start = view_now();
+}
+
+/*
+ * check_args - 커맨드 라인 인자 검증
+ * @argc: 인자 개수
+ * @argv: 인자 배열
+ * @opt: 읽은 옵션 (출력, t_options)
+ *
+ * 프로그램 실행 시 올바른 인자가 제공되었는지 확인합니다.
+ * 사용법: ./miniRT <scene.rt> [--accel auto|none|bvh|grid]
+ *                  [--order tile|scanline|morton|hilbert] [--progressive]
+ *                  [--gbuffer] [--watch] [--aa] [--time-budget 2s|500ms]
+ *
+ * Return: 1 (성공), 0 (실패)
+ */
+int	check_args(int argc, char **argv, t_options *opt)
+{
+	int	i;
+
+	options_init(opt);
+	i = 1;
+	while (++i < argc && opt->accel_mode >= 0 && opt->pixel_order >= 0
+		&& opt->budget_ms >= 0)
+	{
+		if (flag_field(opt, argv[i]))
+			*flag_field(opt, argv[i]) = 1;
+		else if (i + 1 < argc && !ft_strcmp(argv[i], "--accel"))
+			opt->accel_mode = accel_mode_from_name(argv[++i]);
+		else if (i + 1 < argc && !ft_strcmp(argv[i], "--order"))
+			opt->pixel_order = pixel_order_from_name(argv[++i]);
+		else if (i + 1 < argc && !ft_strcmp(argv[i], "--time-budget"))
+			opt->budget_ms = budget_from_name(argv[++i]);
+		else
+			opt->accel_mode = -1;
+	}
+	return (print_usage(argc, opt));
+}
@@ -0,0 +1,87 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   free_scene.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+#include "accel.h"
+
+/*
+ * free_objects - 물체 연결 리스트 해제
+ * @obj: 리스트의 첫 물체
+ *
+ * 각 노드가 가리키는 도형 데이터(t_sphere 등)와 노드 자체를 해제합니다.
+ */
+static void	free_objects(t_object *obj)
+{
+	t_object	*next;
+
+	while (obj)
+	{
+		next = obj->next;
+		free(obj->object);
+		free(obj);
+		obj = next;
+	}
+}
+
+/*
+ * free_lights - 광원 연결 리스트 해제
+ * @light: 리스트의 첫 광원
+ */
+static void	free_lights(t_light *light)
+{
+	t_light	*next;
+
+	while (light)
+	{
+		next = light->next;
+		free(light);
+		light = next;
+	}
+}
+
+/*
+ * free_groups - 그룹 연결 리스트 해제
+ * @group: 리스트의 첫 그룹
+ *
+ * 그룹의 이름, 로컬 물체 목록, 그룹의 가속 구조를 해제합니다.
+ * 배치(t_instance)는 그룹을 가리키기만 하므로 물체 목록에서 해제됩니다.
+ */
+static void	free_groups(t_group *group)
+{
+	t_group	*next;
+
+	while (group)
+	{
+		next = group->next;
+		free(group->name);
+		free_objects(group->objects);
+		free_accel(group->accel);
+		free(group);
+		group = next;
+	}
+}
+
+/*
+ * free_scene - 장면과 장면이 소유한 모든 메모리 해제
+ * @scene: parse_scene으로 만든 장면 (NULL 허용)
+ */
+void	free_scene(t_scene *scene)
+{
+	if (!scene)
+		return ;
+	free_objects(scene->objects);
+	free_lights(scene->lights);
+	free_accel(scene->accel);
+	free_groups(scene->groups);
+	free(scene->ambient_light);
+	free(scene);
+}
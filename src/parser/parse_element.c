@@ -0,0 +1,78 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   parse_element.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+#include "libft.h"
+
+/*
+ * fields_needed - 식별자별 최소 토큰 수 (식별자 포함)
+ * @id: 줄의 첫 토큰
+ *
+ * Return: 필요한 토큰 수, 모르는 식별자는 1 (parse_group_line이 무시)
+ */
+static int	fields_needed(char *id)
+{
+	if (!ft_strcmp(id, "A"))
+		return (3);
+	if (!ft_strcmp(id, "C") || !ft_strcmp(id, "L")
+		|| !ft_strcmp(id, "sp") || !ft_strcmp(id, "pl"))
+		return (4);
+	if (!ft_strcmp(id, "inst"))
+		return (5);
+	if (!ft_strcmp(id, "cy"))
+		return (6);
+	if (!ft_strcmp(id, "group"))
+		return (2);
+	return (1);
+}
+
+/*
+ * parse_fields - 줄에 식별자가 요구하는 토큰이 모두 있는지 확인
+ * @parts: 토큰 배열 (parts[0]이 식별자)
+ *
+ * 요소 파서들은 parts[1..]을 그대로 읽으므로 반쯤 쓴 줄
+ * ("sp 0,0,0")이 그 파서에 닿으면 NULL을 역참조합니다.
+ *
+ * Return: 토큰이 충분하면 1, 모자라면 0
+ */
+int	parse_fields(char **parts)
+{
+	int	count;
+
+	count = 0;
+	while (parts[count])
+		count++;
+	return (count >= fields_needed(parts[0]));
+}
+
+/*
+ * parse_element - 식별자에 맞는 요소 파서 호출
+ * @parts: 토큰 배열 (parse_fields를 통과한 줄)
+ * @scene: 장면
+ */
+void	parse_element(char **parts, t_scene *scene)
+{
+	if (!ft_strcmp(parts[0], "A"))
+		parse_ambient(parts, scene);
+	else if (!ft_strcmp(parts[0], "C"))
+		parse_camera(parts, scene);
+	else if (!ft_strcmp(parts[0], "L"))
+		parse_light(parts, scene);
+	else if (!ft_strcmp(parts[0], "sp"))
+		parse_sphere(parts, scene);
+	else if (!ft_strcmp(parts[0], "pl"))
+		parse_plane(parts, scene);
+	else if (!ft_strcmp(parts[0], "cy"))
+		parse_cylinder(parts, scene);
+	else
+		parse_group_line(parts, scene);
+}
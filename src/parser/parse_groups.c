@@ -0,0 +1,149 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   parse_groups.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+#include "libft.h"
+#include "vec3.h"
+
+/*
+ * find_group - 이름으로 정의된 그룹 찾기
+ * @scene: 장면
+ * @name: 그룹 이름
+ *
+ * Return: 그룹, 없으면 NULL
+ */
+static t_group	*find_group(t_scene *scene, char *name)
+{
+	t_group	*group;
+
+	group = scene->groups;
+	while (group && ft_strcmp(group->name, name))
+		group = group->next;
+	return (group);
+}
+
+/*
+ * open_group - group NAME 줄: 새 그룹 정의 시작
+ * @parts: 토큰 배열
+ * @scene: 장면
+ *
+ * 그룹이 열려 있는 동안에는 sp, cy 줄이 그룹의 물체 목록에 추가되도록
+ * 장면의 물체 목록을 그룹의 목록과 바꿔 둡니다 (end에서 되돌림).
+ * 그룹 안의 그룹과 같은 이름의 두 번째 정의는 잘못된 줄로 셉니다.
+ */
+static void	open_group(char **parts, t_scene *scene)
+{
+	t_group	*group;
+
+	if (scene->open_group || find_group(scene, parts[1]))
+	{
+		scene->invalid++;
+		return ;
+	}
+	group = malloc(sizeof(t_group));
+	if (!group)
+		return ;
+	group->name = ft_strdup(parts[1]);
+	if (!group->name)
+	{
+		free(group);
+		return ;
+	}
+	group->objects = scene->objects;
+	scene->objects = NULL;
+	group->accel = NULL;
+	group->next = scene->groups;
+	scene->groups = group;
+	scene->open_group = group;
+}
+
+/*
+ * parse_group_end - 열린 그룹 닫기 (end 줄, 또는 파일 끝)
+ * @scene: 장면
+ *
+ * 그룹에 쌓인 물체를 그룹으로 옮기고 장면의 물체 목록을 되돌립니다.
+ */
+void	parse_group_end(t_scene *scene)
+{
+	t_object	*outer;
+	t_group		*group;
+
+	group = scene->open_group;
+	if (!group)
+		return ;
+	outer = group->objects;
+	group->objects = scene->objects;
+	scene->objects = outer;
+	scene->open_group = NULL;
+}
+
+/*
+ * parse_instance - inst NAME position axis scale 줄 파싱
+ * @parts: 토큰 배열
+ * @scene: 장면
+ *
+ * 그룹의 물체를 복사하지 않고 그룹을 가리키는 배치 물체 하나만
+ * 추가합니다. 잘못된 배치는 parse_group_line이 먼저 걸러냅니다.
+ */
+static void	parse_instance(char **parts, t_scene *scene)
+{
+	t_object	*obj;
+	t_instance	*inst;
+	t_group		*group;
+
+	group = find_group(scene, parts[1]);
+	inst = malloc(sizeof(t_instance));
+	obj = malloc(sizeof(t_object));
+	if (!group || !inst || !obj)
+	{
+		free(inst);
+		free(obj);
+		return ;
+	}
+	inst->group = group;
+	inst->position = parse_vec3(parts[2]);
+	inst->axis = parse_vec3(parts[3]);
+	inst->scale = atof(parts[4]);
+	obj->color = vec3_new(0, 0, 0);
+	obj->type = OBJ_INSTANCE;
+	obj->object = inst;
+	obj->next = scene->objects;
+	scene->objects = obj;
+}
+
+/*
+ * parse_group_line - group, end, inst 줄 처리
+ * @parts: 토큰 배열 (parts[0]이 식별자)
+ * @scene: 장면
+ *
+ * 형식 예:
+ * group column
+ * cy 0,1,0 0,1,0 1 2 200,200,200
+ * sp 0,2,0 1.2 255,255,255
+ * end
+ * inst column 0,0,10 0,1,0 1.5
+ *
+ * 그룹 안의 inst와 정의되지 않은 그룹을 가리키는 inst는 잘못된 줄로
+ * 셉니다 (parse_scene_buffer가 장면 전체를 버림).
+ */
+void	parse_group_line(char **parts, t_scene *scene)
+{
+	if (!ft_strcmp(parts[0], "group"))
+		open_group(parts, scene);
+	else if (!ft_strcmp(parts[0], "end"))
+		parse_group_end(scene);
+	else if (!ft_strcmp(parts[0], "inst")
+		&& (scene->open_group || !find_group(scene, parts[1])))
+		scene->invalid++;
+	else if (!ft_strcmp(parts[0], "inst"))
+		parse_instance(parts, scene);
+}
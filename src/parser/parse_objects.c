@@ -39,6 +39,11 @@ void	parse_plane(char **parts, t_scene *scene)
 	t_object	*obj;
 	t_plane		*pl;
 
+	if (scene->open_group)
+	{
+		scene->invalid++;
+		return ;
+	}
 	pl = malloc(sizeof(t_plane));
 	obj = malloc(sizeof(t_object));
 	if (!pl || !obj)
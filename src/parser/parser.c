@@ -47,7 +47,9 @@ static void	free_parts(char **parts)
  * @scene: 파싱 결과를 저장할 장면 구조체
  *
  * 장면 파일의 각 줄은 공백으로 구분된 토큰들로 이루어져 있습니다.
- * 첫 번째 토큰(식별자)에 따라 적절한 파서 함수를 호출합니다.
+ * 첫 번째 토큰(식별자)에 따라 적절한 파서 함수를 호출합니다
+ * (parse_element.c). 토큰이 모자란 줄은 파서에 넘기지 않고
+ * scene->invalid를 올리며, 장면의 첫 잘못된 줄만 출력합니다.
  *
  * 지원하는 요소:
  * - A: 환경광 (Ambient light) - 1개만
@@ -56,6 +58,7 @@ static void	free_parts(char **parts)
  * - sp: 구 (Sphere)
  * - pl: 평면 (Plane)
  * - cy: 원기둥 (Cylinder)
+ * - group, end, inst: 그룹 정의와 배치 (parse_groups.c)
  *
  * 형식 예:
  * A 0.2 255,255,255
@@ -67,25 +70,16 @@ static void	free_parts(char **parts)
 void	parse_line(char *line, t_scene *scene)
 {
 	char	**parts;
+	int		bad;
 
 	parts = ft_split(line, ' ');
-	if (!parts || !parts[0])
-	{
-		free_parts(parts);
-		return ;
-	}
-	if (parts[0][0] == 'A' && !parts[0][1])
-		parse_ambient(parts, scene);
-	else if (parts[0][0] == 'C' && !parts[0][1])
-		parse_camera(parts, scene);
-	else if (parts[0][0] == 'L' && !parts[0][1])
-		parse_light(parts, scene);
-	else if (parts[0][0] == 's' && parts[0][1] == 'p' && !parts[0][2])
-		parse_sphere(parts, scene);
-	else if (parts[0][0] == 'p' && parts[0][1] == 'l' && !parts[0][2])
-		parse_plane(parts, scene);
-	else if (parts[0][0] == 'c' && parts[0][1] == 'y' && !parts[0][2])
-		parse_cylinder(parts, scene);
+	bad = scene->invalid;
+	if (parts && parts[0] && !parse_fields(parts))
+		scene->invalid++;
+	else if (parts && parts[0])
+		parse_element(parts, scene);
+	if (!bad && scene->invalid)
+		printf("Error\nInvalid scene line: %s\n", line);
 	free_parts(parts);
 }
 
@@ -99,6 +93,9 @@ void	parse_line(char *line, t_scene *scene)
  * - objects: NULL (물체 목록 비어있음)
  * - lights: NULL (광원 목록 비어있음)
  * - ambient_light: NULL (아직 파싱 안됨)
+ * - accel: NULL (prepare_scene이 만듦), accel_mode: ACCEL_AUTO
+ * - refit_limit: REFIT_DEFAULT_LIMIT, pixel_order: ORDER_TILE
+ * - groups, open_group: NULL (정의된 그룹 없음), invalid: 0
  * - camera: 파싱될 때까지 정의되지 않음
  *
  * Return: 할당된 장면 구조체, 실패 시 NULL
@@ -113,14 +110,21 @@ static t_scene	*init_scene(void)
 	scene->objects = NULL;
 	scene->lights = NULL;
 	scene->ambient_light = NULL;
+	scene->accel = NULL;
+	scene->accel_mode = ACCEL_AUTO;
+	scene->refit_limit = REFIT_DEFAULT_LIMIT;
+	scene->pixel_order = ORDER_TILE;
+	scene->antialias = 0;
+	scene->groups = NULL;
+	scene->open_group = NULL;
+	scene->invalid = 0;
 	return (scene);
 }
 
 /*
- * parse_buffer_lines - 버퍼를 줄 단위로 파싱
- * @buffer: 파일에서 읽은 전체 내용
+ * parse_scene_buffer - 메모리에 있는 장면 파일 내용을 파싱
+ * @buffer: 장면 파일 내용 (개행 문자를 '\0'으로 바꿈)
  * @bytes: 버퍼의 유효한 바이트 수
- * @scene: 파싱 결과를 저장할 장면 구조체
  *
  * 버퍼를 개행 문자('\n')로 구분하여 각 줄을 파싱합니다.
  *
@@ -128,18 +132,30 @@ static t_scene	*init_scene(void)
  * 1. 개행 문자를 찾으면 NULL 문자로 대체
  * 2. 줄이 비어있지 않고 주석('#')이 아니면 파싱
  * 3. 다음 줄로 이동
+ * 4. 끝나면 end 없이 끝난 그룹 닫기
  *
  * 주석 처리:
  * - '#'로 시작하는 줄은 무시됨
  * - 빈 줄도 무시됨
  *
- * 줄바꿈 없이 끝나는 파일도 처리합니다 (i == bytes 조건).
+ * 줄바꿈 없이 끝나는 내용도 처리합니다 (i == bytes 조건). 렌더 서버는
+ * 요청에 담긴 장면을 파일 없이 이 함수로 파싱합니다.
+ *
+ * 잘못된 줄이 하나라도 있으면 일부만 채워진 장면을 돌려주지 않고
+ * 버립니다. 서버는 "error cannot read scene"으로 답하고, --watch는
+ * 지금 장면을 그대로 둡니다.
+ *
+ * Return: 파싱된 장면 구조체, 잘못된 줄이 있거나 메모리 부족 시 NULL
  */
-static void	parse_buffer_lines(char *buffer, ssize_t bytes, t_scene *scene)
+t_scene	*parse_scene_buffer(char *buffer, ssize_t bytes)
 {
-	int	start;
-	int	i;
+	t_scene	*scene;
+	ssize_t	start;
+	ssize_t	i;
 
+	scene = init_scene();
+	if (!scene)
+		return (NULL);
 	start = 0;
 	i = 0;
 	while (i <= bytes)
@@ -153,6 +169,11 @@ static void	parse_buffer_lines(char *buffer, ssize_t bytes, t_scene *scene)
 		}
 		i++;
 	}
+	parse_group_end(scene);
+	if (!scene->invalid)
+		return (scene);
+	free_scene(scene);
+	return (NULL);
 }
 
 /*
@@ -163,26 +184,22 @@ static void	parse_buffer_lines(char *buffer, ssize_t bytes, t_scene *scene)
  *
  * 동작 과정:
  * 1. 파일 열기 (읽기 전용)
- * 2. 빈 장면 구조체 초기화
- * 3. 파일 내용을 버퍼로 읽기 (최대 1023바이트)
- * 4. 버퍼를 줄 단위로 파싱
- * 5. 파일 닫기
+ * 2. 파일 전체 내용을 버퍼로 읽기 (read_file)
+ * 3. 파일 닫기
+ * 4. 버퍼를 줄 단위로 파싱 (parse_scene_buffer)
  *
- * 제한사항:
- * - 파일 크기는 1KB 미만이어야 함
- * - 더 큰 파일은 잘림
+ * 파일 크기 제한은 없습니다. 벤치마크용으로 생성된 대형 장면도
+ * 잘리지 않고 모두 파싱됩니다.
  *
- * 개선 가능성:
- * - 동적 버퍼 크기 조정
- * - 여러 번 읽기로 큰 파일 지원
- * - 더 상세한 에러 메시지
+ * 잘못된 줄은 parse_line이 "Error"와 함께 출력하므로 여기서는
+ * 파일을 열거나 읽지 못한 경우에만 "Error"를 출력합니다.
  *
  * Return: 파싱된 장면 구조체, 실패 시 NULL
  */
 t_scene	*parse_scene(char *filename)
 {
 	int			fd;
-	char		buffer[1024];
+	char		*buffer;
 	t_scene		*scene;
 	ssize_t		bytes_read;
 
@@ -192,19 +209,14 @@ t_scene	*parse_scene(char *filename)
 		printf("Error\n");
 		return (NULL);
 	}
-	scene = init_scene();
-	if (!scene)
+	buffer = read_file(fd, &bytes_read);
+	close(fd);
+	if (!buffer)
 	{
 		printf("Error\n");
-		close(fd);
 		return (NULL);
 	}
-	bytes_read = read(fd, buffer, sizeof(buffer) - 1);
-	if (bytes_read > 0)
-	{
-		buffer[bytes_read] = '\0';
-		parse_buffer_lines(buffer, bytes_read, scene);
-	}
-	close(fd);
+	scene = parse_scene_buffer(buffer, bytes_read);
+	free(buffer);
 	return (scene);
 }
@@ -0,0 +1,78 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   read_file.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+#include "libft.h"
+#include <unistd.h>
+
+#define READ_CHUNK 65536
+
+/*
+ * grow_buffer - 버퍼 용량을 두 배로 확장
+ * @buf: 기존 버퍼 (해제됨)
+ * @len: 버퍼에 담긴 유효 바이트 수
+ * @cap: 현재 용량 (갱신됨)
+ *
+ * Return: 확장된 버퍼, 실패 시 NULL (기존 버퍼도 해제됨)
+ */
+static char	*grow_buffer(char *buf, ssize_t len, ssize_t *cap)
+{
+	char	*grown;
+
+	*cap *= 2;
+	grown = malloc(*cap + 1);
+	if (grown && len > 0)
+		ft_memcpy(grown, buf, len);
+	free(buf);
+	return (grown);
+}
+
+/*
+ * read_file - 파일 디스크립터의 전체 내용을 읽기
+ * @fd: 읽을 파일 디스크립터
+ * @len: 읽은 바이트 수 (출력)
+ *
+ * 파일 크기에 제한 없이 READ_CHUNK 단위로 읽어 버퍼를 키워 나갑니다.
+ * 자동 생성된 대형 장면 파일(수백만 개의 물체)도 한 번에 파싱할 수
+ * 있도록 고정 크기 버퍼를 대체합니다.
+ * 반환된 버퍼는 항상 NULL 문자로 끝납니다.
+ *
+ * Return: 파일 내용을 담은 버퍼, 실패 시 NULL
+ */
+char	*read_file(int fd, ssize_t *len)
+{
+	char	*buf;
+	ssize_t	cap;
+	ssize_t	bytes;
+
+	cap = READ_CHUNK;
+	buf = malloc(cap + 1);
+	*len = 0;
+	bytes = 1;
+	while (buf && bytes > 0)
+	{
+		if (*len + READ_CHUNK > cap)
+			buf = grow_buffer(buf, *len, &cap);
+		if (!buf)
+			return (NULL);
+		bytes = read(fd, buf + *len, READ_CHUNK);
+		if (bytes > 0)
+			*len += bytes;
+	}
+	if (!buf || bytes < 0)
+	{
+		free(buf);
+		return (NULL);
+	}
+	buf[*len] = '\0';
+	return (buf);
+}
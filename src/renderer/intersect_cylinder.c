@@ -11,25 +11,150 @@
 /* ************************************************************************** */
 
 #include "minirt.h"
+#include "vec3_inline.h"
+#include <math.h>
 
 /*
- * intersect_cylinder - 광선과 원기둥의 교점 계산
- * @ray: 검사할 광선 (origin, direction)
- * @cylinder: 원기둥 객체 (center, axis, radius, height)
- *
- * 현재 미구현 상태입니다.
- * 
- * 원기둥 교점 계산은 복잡합니다:
- * 1. 무한 원기둥의 측면과 광선의 교점 계산 (2차 방정식)
- * 2. 교점이 원기둥의 높이 범위 내에 있는지 확인
- * 3. 원기둥의 양쪽 캡(원형 뚜껑)과의 교점도 확인
- * 4. 가장 가까운 유효한 교점 반환
- *
- * Return: 항상 -1 (교점 없음)
+ * to_local - 광선을 원기둥의 로컬 좌표계로 변환
+ * @ray: 세계 좌표계의 광선
+ * @oc: ray.origin - center
+ * @cy: prepare_cylinder가 준비한 원기둥 (u, v, axis)
+ *
+ * (u, v, axis)는 직교 정규 기저이므로 역변환은 각 축과의 내적입니다.
+ * 로컬 좌표계에서 원기둥은 z축을 따라 -half_height ~ half_height에
+ * 놓인 반지름 radius의 원기둥이 됩니다.
+ *
+ * Return: 로컬 좌표계의 광선
+ */
+static t_ray	to_local(t_ray ray, t_vec3 oc, t_cylinder *cy)
+{
+	t_ray	local;
+
+	local.origin = v3_new(v3_dot(oc, cy->u), v3_dot(oc, cy->v),
+			v3_dot(oc, cy->axis));
+	local.direction = v3_new(v3_dot(ray.direction, cy->u),
+			v3_dot(ray.direction, cy->v), v3_dot(ray.direction, cy->axis));
+	return (local);
+}
+
+/*
+ * side_root - 측면 2차 방정식의 한 근이 유효한지 확인
+ * @l: 로컬 좌표계의 광선
+ * @cy: 원기둥 (half_height)
+ * @t: 근
+ *
+ * Return: t가 광선 앞쪽이고 높이 범위 안이면 1
  */
-double	intersect_cylinder(t_ray ray, t_cylinder *cylinder)
+static int	side_root(t_ray *l, t_cylinder *cy, t_real t)
 {
-	(void)ray;
-	(void)cylinder;
+	return (t > RT_EPSILON
+		&& RT_FABS(l->origin.z + t * l->direction.z) <= cy->half_height);
+}
+
+/*
+ * hit_side - 로컬 좌표계에서 원기둥 측면과의 교점
+ * @l: 로컬 좌표계의 광선
+ * @cy: 원기둥 (radius2, half_height)
+ *
+ * z축을 빼면 원과 직선의 교점 문제입니다.
+ * a = Dx² + Dy², h = Ox*Dx + Oy*Dy, c = Ox² + Oy² - radius²
+ * 구와 같이 q = -(h + sign(h) * sqrt(h² - ac))로 두 근
+ * q / a, c / q를 구해 상쇄 오차를 피합니다.
+ * 광선이 축과 평행하면(a ≈ 0) 측면과 만나지 않습니다.
+ *
+ * Return: 높이 범위 안의 가장 가까운 교점 거리, 없으면 -1
+ */
+static t_real	hit_side(t_ray *l, t_cylinder *cy)
+{
+	t_real	abc[3];
+	t_real	q;
+	t_real	t[2];
+
+	abc[0] = l->direction.x * l->direction.x + l->direction.y * l->direction.y;
+	if (abc[0] < RT_EPSILON)
+		return (-1.0);
+	abc[1] = l->origin.x * l->direction.x + l->origin.y * l->direction.y;
+	abc[2] = l->origin.x * l->origin.x + l->origin.y * l->origin.y
+		- cy->radius2;
+	q = abc[1] * abc[1] - abc[0] * abc[2];
+	if (q < 0)
+		return (-1.0);
+	q = -(abc[1] + copysign(RT_SQRT(q), abc[1]));
+	if (q == 0)
+		return (-1.0);
+	t[0] = fmin(q / abc[0], abc[2] / q);
+	t[1] = fmax(q / abc[0], abc[2] / q);
+	if (side_root(l, cy, t[0]))
+		return (t[0]);
+	if (side_root(l, cy, t[1]))
+		return (t[1]);
 	return (-1.0);
 }
+
+/*
+ * hit_caps - 로컬 좌표계에서 위/아래 뚜껑(원판)과의 교점
+ * @l: 로컬 좌표계의 광선
+ * @cy: 원기둥 (radius2, half_height)
+ *
+ * 각 뚜껑은 z = ±half_height 평면 위의 반지름 radius인 원판입니다.
+ * 평면과의 교점이 원판 안에 있는지 확인하고 더 가까운 쪽을 고릅니다.
+ *
+ * Return: 가장 가까운 뚜껑 교점 거리, 없으면 -1
+ */
+static t_real	hit_caps(t_ray *l, t_cylinder *cy)
+{
+	t_real	best;
+	t_real	t;
+	t_real	x;
+	t_real	y;
+	int		side;
+
+	best = -1.0;
+	if (RT_FABS(l->direction.z) < RT_EPSILON)
+		return (best);
+	side = -1;
+	while (side <= 1)
+	{
+		t = (side * cy->half_height - l->origin.z) / l->direction.z;
+		x = l->origin.x + t * l->direction.x;
+		y = l->origin.y + t * l->direction.y;
+		if (t > RT_EPSILON && x * x + y * y <= cy->radius2
+			&& (best < 0 || t < best))
+			best = t;
+		side += 2;
+	}
+	return (best);
+}
+
+/*
+ * intersect_cylinder - 광선과 뚜껑이 있는 원기둥의 교점 계산
+ * @ray: 검사할 광선 (origin, 단위 벡터 direction)
+ * @cylinder: prepare_cylinder가 준비한 원기둥
+ *
+ * 1. 원기둥을 감싸는 구(bound2)와 먼저 비교하여 빗나가는 광선을
+ *    2차 방정식 없이 배제 (구 교점과 같은 판정)
+ * 2. 광선을 원기둥의 로컬 좌표계로 변환
+ * 3. 측면(hit_side)과 뚜껑(hit_caps)의 교점 중 가까운 것을 선택
+ *
+ * Return: 교점까지의 거리 t (교점 없으면 -1)
+ */
+t_real	intersect_cylinder(t_ray ray, t_cylinder *cylinder)
+{
+	t_vec3	oc;
+	t_ray	local;
+	t_real	h;
+	t_real	c;
+	t_real	t[2];
+
+	oc = v3_sub(ray.origin, cylinder->center);
+	h = v3_dot(oc, ray.direction);
+	c = v3_dot(oc, oc) - cylinder->bound2;
+	if ((c > 0 && h > 0) || h * h - c < 0)
+		return (-1.0);
+	local = to_local(ray, oc, cylinder);
+	t[0] = hit_side(&local, cylinder);
+	t[1] = hit_caps(&local, cylinder);
+	if (t[0] < 0 || (t[1] > 0 && t[1] < t[0]))
+		return (t[1]);
+	return (t[0]);
+}
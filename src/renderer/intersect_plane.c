@@ -11,7 +11,7 @@
 /* ************************************************************************** */
 
 #include "minirt.h"
-#include "vec3.h"
+#include "vec3_inline.h"
 #include <math.h>
 
 /*
@@ -31,20 +31,20 @@
  * t = (point - origin) · normal / (direction · normal)
  *
  * denom = direction · normal이 0에 가까우면 광선이 평면과 평행합니다.
- * t > 0이어야 카메라 앞쪽에 있는 교점입니다.
+ * t > RT_EPSILON이어야 카메라 앞쪽에 있는 교점입니다.
  *
  * Return: 교점까지의 거리 t (교점 없으면 -1)
  */
-double	intersect_plane(t_ray ray, t_plane *plane)
+t_real	intersect_plane(t_ray ray, t_plane *plane)
 {
-	double	denom;
-	double	t;
+	t_real	denom;
+	t_real	t;
 
-	denom = vec3_dot(ray.direction, plane->normal);
-	if (fabs(denom) > 1e-6)
+	denom = v3_dot(ray.direction, plane->normal);
+	if (RT_FABS(denom) > RT_EPSILON)
 	{
-		t = vec3_dot(vec3_sub(plane->point, ray.origin), plane->normal) / denom;
-		if (t > 1e-6)
+		t = v3_dot(v3_sub(plane->point, ray.origin), plane->normal) / denom;
+		if (t > RT_EPSILON)
 			return (t);
 	}
 	return (-1.0);
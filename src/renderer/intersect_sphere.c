@@ -11,78 +11,104 @@
 /* ************************************************************************** */
 
 #include "minirt.h"
-#include "vec3.h"
+#include "vec3_inline.h"
 #include <math.h>
 
 /*
- * solve_quadratic - 2차 방정식 풀이
- * @abc: 계수 배열 [a, b, c] (ax² + bx + c = 0)
+ * solve_quadratic - 2차 방정식 풀이 (수치적으로 안정된 형태)
+ * @abc: 계수 배열 [a, h, c] (a*t² + 2h*t + c = 0, h는 b의 절반)
+ * @disc: 판별식 h² - ac (호출자가 상쇄 오차 없이 계산한 값)
  *
- * 2차 방정식의 해를 판별식(discriminant)을 이용하여 구합니다.
- * 판별식 = b² - 4ac
+ * 일반 근의 공식 (-h ± sqrt(disc)) / a는 h와 sqrt(disc)의 크기가
+ * 비슷할 때 뺄셈에서 유효 자릿수를 잃습니다(catastrophic cancellation).
+ * 부호가 같은 두 수만 더하도록
+ *   q = -(h + sign(h) * sqrt(disc))
+ *   t1 = q / a, t2 = c / q
+ * 로 두 근을 구합니다. float 빌드에서도 정밀도가 유지됩니다.
  *
- * 판별식에 따른 해의 개수:
- * - 음수: 실근 없음 (광선이 구와 만나지 않음)
- * - 0: 중근 (광선이 구에 접함)
- * - 양수: 서로 다른 두 실근 (광선이 구를 관통)
- *
- * 두 해(t1, t2) 중 양수이면서 더 작은 값을 반환합니다.
+ * 두 해 중 RT_EPSILON보다 크면서 더 작은 값을 반환합니다.
  * (카메라에 더 가까운 교점을 선택)
  *
  * Return: 가장 가까운 교점의 t 값, 교점 없으면 -1
  */
-static double	solve_quadratic(double abc[3])
+static t_real	solve_quadratic(t_real abc[3], t_real disc)
 {
-	double	discriminant;
-	double	t1;
-	double	t2;
+	t_real	q;
+	t_real	t1;
+	t_real	t2;
 
-	discriminant = abc[1] * abc[1] - 4 * abc[0] * abc[2];
-	if (discriminant < 0)
+	if (abc[1] < 0)
+		q = -abc[1] + RT_SQRT(disc);
+	else
+		q = -abc[1] - RT_SQRT(disc);
+	if (q == 0)
 		return (-1.0);
-	t1 = (-abc[1] - sqrt(discriminant)) / (2.0 * abc[0]);
-	t2 = (-abc[1] + sqrt(discriminant)) / (2.0 * abc[0]);
-	if (t1 > 0 && (t2 < 0 || t1 < t2))
+	t1 = q / abc[0];
+	t2 = abc[2] / q;
+	if (t1 > t2)
+	{
+		q = t1;
+		t1 = t2;
+		t2 = q;
+	}
+	if (t1 > RT_EPSILON)
 		return (t1);
-	if (t2 > 0)
+	if (t2 > RT_EPSILON)
 		return (t2);
 	return (-1.0);
 }
 
 /*
  * intersect_sphere - 광선과 구의 교점 계산
- * @ray: 검사할 광선 (origin, direction)
- * @sphere: 구 객체 (center, radius)
+ * @ray: 검사할 광선 (origin, 단위 벡터 direction)
+ * @sphere: prepare_sphere가 준비한 구 객체 (center, radius2)
  *
  * 광선-구 교점 계산은 2차 방정식을 풀어서 수행합니다.
  *
  * 광선 방정식: P(t) = origin + t * direction
  * 구 방정식: |P - center|² = radius²
  *
- * 광선 방정식을 구 방정식에 대입하면:
- * |origin + t*direction - center|² = radius²
- * 
  * oc = origin - center라 하면:
  * |oc + t*direction|² = radius²
- * (oc + t*dir)·(oc + t*dir) = radius²
- * 
- * 전개하면 2차 방정식:
- * a*t² + b*t + c = 0
+ *
+ * 전개하면 2차 방정식 a*t² + 2h*t + c = 0
  * 여기서:
- * a = direction · direction (항상 1, direction이 정규화되어 있으므로)
- * b = 2 * (oc · direction)
- * c = oc · oc - radius²
+ * a = direction · direction = 1 (모든 광선의 방향은 단위 벡터)
+ * h = oc · direction
+ * c = oc · oc - radius² (radius²는 prepare_scene에서 계산)
+ *
+ * 판별식 h² - ac를 그대로 계산하면 구가 멀리 있을 때
+ * (|oc|가 반지름보다 훨씬 클 때) 큰 두 수의 차가 되어 정밀도를
+ * 잃습니다. 대신 광선 위에서 구 중심에 가장 가까운 점까지의 벡터
+ * perp = oc - h * direction을 이용해
+ *   h² - c = radius² - |perp|²
+ * 로 계산합니다. 이 계산은 비싸므로 대부분의 광선(빗나가는 광선)은
+ * 먼저 값싼 판정으로 걸러냅니다.
+ * - 원점이 구 밖에 있고(c > 0) 광선이 구에서 멀어지면(h > 0)
+ *   두 근이 모두 음수
+ * - h² - c가 반올림 오차(h²의 몇 ulp)보다 확실히 음수이면 빗나감
  *
  * Return: 교점까지의 거리 t (교점 없으면 -1)
  */
-double	intersect_sphere(t_ray ray, t_sphere *sphere)
+t_real	intersect_sphere(t_ray ray, t_sphere *sphere)
 {
 	t_vec3	oc;
-	double	abc[3];
+	t_vec3	perp;
+	t_real	abc[3];
+	t_real	disc;
 
-	oc = vec3_sub(ray.origin, sphere->center);
-	abc[0] = vec3_dot(ray.direction, ray.direction);
-	abc[1] = 2.0 * vec3_dot(oc, ray.direction);
-	abc[2] = vec3_dot(oc, oc) - sphere->radius * sphere->radius;
-	return (solve_quadratic(abc));
+	oc = v3_sub(ray.origin, sphere->center);
+	abc[0] = 1.0;
+	abc[1] = v3_dot(oc, ray.direction);
+	abc[2] = v3_dot(oc, oc) - sphere->radius2;
+	if (abc[2] > 0 && abc[1] > 0)
+		return (-1.0);
+	disc = abc[1] * abc[1] - abc[2];
+	if (disc < -16 * RT_REL_EPS * abc[1] * abc[1])
+		return (-1.0);
+	perp = v3_sub(oc, v3_mul(ray.direction, abc[1]));
+	disc = sphere->radius2 - v3_dot(perp, perp);
+	if (disc < 0)
+		return (-1.0);
+	return (solve_quadratic(abc, disc));
 }
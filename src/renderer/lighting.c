@@ -11,7 +11,7 @@
 /* ************************************************************************** */
 
 #include "minirt.h"
-#include "vec3.h"
+#include "vec3_inline.h"
 
 /*
  * clamp_color - 색상 값을 0.0 ~ 1.0 범위로 제한
@@ -52,11 +52,10 @@ static t_vec3	clamp_color(t_vec3 color)
  * 단순히 모든 물체에 일정한 밝기를 더합니다.
  *
  * 계산 공식:
- * ambient = obj_color * ambient_light_color * ambient_ratio
+ * ambient = obj_color * ambient_term
  *
  * - obj_color: 물체 고유의 색상
- * - ambient_light_color: 환경광의 색상
- * - ambient_ratio: 환경광의 강도 (0.0 ~ 1.0)
+ * - ambient_term: 환경광의 색상 * 강도 (prepare_scene에서 계산)
  *
  * 각 RGB 채널을 독립적으로 곱합니다.
  *
@@ -68,12 +67,9 @@ static t_vec3	get_ambient_light(t_scene *scene, t_vec3 obj_color)
 
 	if (scene->ambient_light)
 	{
-		ambient.x = obj_color.x * scene->ambient_light->color.x
-			* scene->ambient_light->ratio;
-		ambient.y = obj_color.y * scene->ambient_light->color.y
-			* scene->ambient_light->ratio;
-		ambient.z = obj_color.z * scene->ambient_light->color.z
-			* scene->ambient_light->ratio;
+		ambient.x = obj_color.x * scene->ambient_light->term.x;
+		ambient.y = obj_color.y * scene->ambient_light->term.y;
+		ambient.z = obj_color.z * scene->ambient_light->term.z;
 	}
 	else
 	{
@@ -87,7 +83,7 @@ static t_vec3	get_ambient_light(t_scene *scene, t_vec3 obj_color)
 /*
  * is_in_shadow - 그림자 판정 (Shadow Ray 테스트)
  * @scene: 장면 정보 (물체 목록)
- * @point: 검사할 점의 위치
+ * @hit: 검사할 교점 (위치, 법선)
  * @light: 광원 정보
  *
  * 특정 점이 광원으로부터 그림자 안에 있는지 판단합니다.
@@ -96,27 +92,24 @@ static t_vec3	get_ambient_light(t_scene *scene, t_vec3 obj_color)
  * 1. 점에서 광원으로 향하는 방향 벡터 계산
  * 2. 광원까지의 거리 계산
  * 3. Shadow Ray 생성 (점에서 광원 방향으로)
- *    - origin에 0.001을 더해 자기 자신과의 교점을 방지 (shadow acne 방지)
- * 4. Shadow Ray와 장면의 모든 물체의 교점 검사
- * 5. 교점이 광원보다 가까우면 그림자 안
+ *    - offset_ray_origin으로 원점을 표면에서 띄워 자기 자신과의
+ *      교점을 방지 (shadow acne 방지)
+ * 4. 점과 광원 사이를 가리는 물체가 있는지 검사 (scene_occluded)
+ *    - 가장 가까운 교점이 아니라 아무 교점이나 찾으면 멈춤
  *
  * Return: 1 (그림자 안), 0 (직접 조명 받음)
  */
-static int	is_in_shadow(t_scene *scene, t_vec3 point, t_light *light)
+static int	is_in_shadow(t_scene *scene, t_hit *hit, t_light *light)
 {
 	t_ray	shadow_ray;
-	t_hit	shadow_hit;
 	t_vec3	light_dir;
-	double	light_distance;
+	t_real	light_distance;
 
-	light_dir = vec3_sub(light->position, point);
-	light_distance = vec3_length(light_dir);
-	shadow_ray.origin = vec3_add(point, vec3_mul(light_dir, 0.001));
-	shadow_ray.direction = vec3_normalize(light_dir);
-	shadow_hit = find_closest_intersection(scene, shadow_ray);
-	if (shadow_hit.object && shadow_hit.t < light_distance)
-		return (1);
-	return (0);
+	light_dir = v3_sub(light->position, hit->point);
+	light_distance = v3_length(light_dir);
+	shadow_ray.origin = offset_ray_origin(hit->point, hit->normal, light_dir);
+	shadow_ray.direction = v3_normalize(light_dir);
+	return (scene_occluded(scene, shadow_ray, light_distance));
 }
 
 /*
@@ -134,7 +127,8 @@ static int	is_in_shadow(t_scene *scene, t_vec3 point, t_light *light)
  *    - light_dir: 교점에서 광원으로의 정규화된 방향
  *    - diff = normal · light_dir (코사인 값)
  *    - diff < 0이면 0으로 클램핑 (뒷면 조명 무시)
- * 3. 확산광 = obj_color * light_color * light_ratio * diff
+ * 3. 확산광 = obj_color * light_radiance * diff
+ *    - light_radiance = light_color * light_ratio (prepare_scene에서 계산)
  *    - diff가 클수록 (법선과 광원 방향이 평행할수록) 밝아짐
  * 4. 모든 광원의 기여도를 누적
  *
@@ -146,25 +140,22 @@ static t_vec3	add_diffuse_light(t_scene *scene, t_hit hit, t_vec3 color)
 {
 	t_light	*light;
 	t_vec3	light_dir;
-	double	diff;
+	t_real	diff;
 	t_vec3	diffuse;
 
 	light = scene->lights;
 	while (light)
 	{
-		if (!is_in_shadow(scene, hit.point, light))
+		if (!is_in_shadow(scene, &hit, light))
 		{
-			light_dir = vec3_normalize(vec3_sub(light->position, hit.point));
-			diff = vec3_dot(hit.normal, light_dir);
+			light_dir = v3_normalize(v3_sub(light->position, hit.point));
+			diff = v3_dot(hit.normal, light_dir);
 			if (diff < 0)
 				diff = 0;
-			diffuse.x = hit.object->color.x * light->color.x
-				* light->ratio * diff;
-			diffuse.y = hit.object->color.y * light->color.y
-				* light->ratio * diff;
-			diffuse.z = hit.object->color.z * light->color.z
-				* light->ratio * diff;
-			color = vec3_add(color, diffuse);
+			diffuse.x = hit.object->color.x * light->radiance.x * diff;
+			diffuse.y = hit.object->color.y * light->radiance.y * diff;
+			diffuse.z = hit.object->color.z * light->radiance.z * diff;
+			color = v3_add(color, diffuse);
 		}
 		light = light->next;
 	}
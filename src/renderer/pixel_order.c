@@ -0,0 +1,135 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   pixel_order.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "render.h"
+#include "libft.h"
+
+/*
+ * morton_decode - 타일 안 순번을 Z-곡선(Morton) 좌표로 바꾸기
+ * @k: 타일 안 순번 (0 ~ TILE_SIZE² - 1)
+ * @xy: 타일 안 좌표 (출력)
+ *
+ * 순번의 짝수 번째 비트가 x, 홀수 번째 비트가 y입니다. 2 × 2,
+ * 4 × 4, ... 블록을 차례로 채우므로 연속한 픽셀이 가까이 모입니다.
+ */
+static void	morton_decode(int k, int *xy)
+{
+	int	bit;
+
+	xy[0] = 0;
+	xy[1] = 0;
+	bit = 0;
+	while ((1 << bit) < TILE_SIZE)
+	{
+		xy[0] |= ((k >> (2 * bit)) & 1) << bit;
+		xy[1] |= ((k >> (2 * bit + 1)) & 1) << bit;
+		bit++;
+	}
+}
+
+/*
+ * hilbert_rotate - Hilbert 곡선의 하위 사분면 방향 맞추기
+ * @s: 지금까지 채운 사분면의 한 변 길이
+ * @xy: 사분면 안 좌표 (갱신됨)
+ * @rx: 고른 사분면의 x 비트
+ */
+static void	hilbert_rotate(int s, int *xy, int rx)
+{
+	int	t;
+
+	if (rx == 1)
+	{
+		xy[0] = s - 1 - xy[0];
+		xy[1] = s - 1 - xy[1];
+	}
+	t = xy[0];
+	xy[0] = xy[1];
+	xy[1] = t;
+}
+
+/*
+ * hilbert_decode - 타일 안 순번을 Hilbert 곡선 좌표로 바꾸기
+ * @k: 타일 안 순번 (0 ~ TILE_SIZE² - 1)
+ * @xy: 타일 안 좌표 (출력)
+ *
+ * 작은 사분면부터 2비트씩 읽어 사분면을 고르고, 방향이 이어지도록
+ * 지금까지의 좌표를 돌리거나 뒤집습니다. Z-곡선과 달리 연속한 두
+ * 픽셀은 항상 이웃합니다.
+ */
+static void	hilbert_decode(int k, int *xy)
+{
+	int	s;
+	int	rx;
+	int	ry;
+
+	xy[0] = 0;
+	xy[1] = 0;
+	s = 1;
+	while (s < TILE_SIZE)
+	{
+		rx = 1 & (k / 2);
+		ry = 1 & (k ^ rx);
+		if (ry == 0)
+			hilbert_rotate(s, xy, rx);
+		xy[0] += s * rx;
+		xy[1] += s * ry;
+		k /= 4;
+		s *= 2;
+	}
+}
+
+/*
+ * pixel_order_table - 타일 안 픽셀 순서표 만들기
+ * @order: ORDER_* (ORDER_SCANLINE은 타일을 쓰지 않으므로 행 순서)
+ * @lut: TILE_SIZE² 칸 (출력, k번째로 렌더링할 픽셀의
+ *       y × TILE_SIZE + x)
+ *
+ * 곡선 좌표를 픽셀마다 다시 풀지 않도록 프레임마다 한 번 만듭니다.
+ * Morton과 Hilbert 곡선은 TILE_SIZE가 2의 거듭제곱이어야 합니다.
+ */
+void	pixel_order_table(int order, int *lut)
+{
+	int	xy[2];
+	int	k;
+
+	k = 0;
+	while (k < TILE_SIZE * TILE_SIZE)
+	{
+		xy[0] = k % TILE_SIZE;
+		xy[1] = k / TILE_SIZE;
+		if (order == ORDER_MORTON)
+			morton_decode(k, xy);
+		else if (order == ORDER_HILBERT)
+			hilbert_decode(k, xy);
+		lut[k] = xy[1] * TILE_SIZE + xy[0];
+		k++;
+	}
+}
+
+/*
+ * pixel_order_from_name - --order 인자를 ORDER_*로 바꾸기
+ * @name: tile, scanline, morton, hilbert 중 하나
+ *
+ * Return: ORDER_* 값, 알 수 없는 이름이면 -1
+ */
+int	pixel_order_from_name(char *name)
+{
+	if (!ft_strcmp(name, "tile"))
+		return (ORDER_TILE);
+	if (!ft_strcmp(name, "scanline"))
+		return (ORDER_SCANLINE);
+	if (!ft_strcmp(name, "morton"))
+		return (ORDER_MORTON);
+	if (!ft_strcmp(name, "hilbert"))
+		return (ORDER_HILBERT);
+	return (-1);
+}
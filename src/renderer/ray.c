@@ -11,91 +11,50 @@
 /* ************************************************************************** */
 
 #include "minirt.h"
-#include "vec3.h"
+#include "vec3_inline.h"
 #include <math.h>
 
-/*
- * create_camera_basis - 카메라의 로컬 좌표계 생성
- * @orientation: 카메라가 바라보는 방향 벡터
- * @right: 카메라의 오른쪽 방향 벡터 (출력)
- * @up: 카메라의 위쪽 방향 벡터 (출력)
- * @forward: 카메라의 정면 방향 벡터 (출력)
- *
- * 카메라의 방향(orientation)으로부터 세 개의 직교하는 단위 벡터를 생성합니다.
- * 이 벡터들은 카메라만의 로컬 좌표계를 형성합니다.
- *
- * 동작 과정:
- * 1. forward: 카메라가 바라보는 방향 (정규화된 orientation)
- * 2. world_up: 세계 좌표계의 위 방향
- *    - forward가 거의 수직(y > 0.999)이면 x축 사용
- *    - 그 외에는 y축(0,1,0) 사용
- * 3. right: world_up과 forward의 외적으로 계산 (카메라의 오른쪽)
- * 4. up: forward와 right의 외적으로 계산 (카메라의 위쪽)
- *
- * 외적의 순서가 중요합니다: 오른손 좌표계를 유지하기 위해
- * right = world_up × forward
- * up = forward × right
- */
-static void	create_camera_basis(t_vec3 orientation, t_vec3 *right,
-	t_vec3 *up, t_vec3 *forward)
-{
-	t_vec3	world_up;
-
-	*forward = vec3_normalize(orientation);
-	if (fabs(forward->y) > 0.999)
-		world_up = vec3_new(1, 0, 0);
-	else
-		world_up = vec3_new(0, 1, 0);
-	*right = vec3_normalize(vec3_cross(world_up, *forward));
-	*up = vec3_normalize(vec3_cross(*forward, *right));
-}
-
 /*
  * calculate_ray_direction - 특정 픽셀로 향하는 광선의 방향 계산
- * @camera: 카메라 정보 (위치, 방향, FOV)
- * @i: 픽셀의 x 좌표
- * @j: 픽셀의 y 좌표
+ * @camera: prepare_scene이 준비한 카메라 (좌표계, tan(fov/2))
+ * @px: 광선이 지나는 화면 위 점의 x 좌표 (픽셀 중앙이면 i + 0.5)
+ * @py: 같은 점의 y 좌표 (픽셀 중앙이면 j + 0.5)
  * @wh: 화면 크기 배열 [width, height]
  *
  * 레이트레이싱의 핵심: 각 픽셀마다 카메라에서 출발하는 광선을 생성합니다.
  *
  * 동작 과정:
- * 1. FOV를 라디안으로 변환
- * 2. 화면 비율(aspect ratio) 계산
- * 3. 픽셀 좌표를 카메라 공간의 NDC(Normalized Device Coordinates)로 변환
+ * 1. 화면 비율(aspect ratio) 계산
+ * 2. 픽셀 좌표를 카메라 공간의 NDC(Normalized Device Coordinates)로 변환
  *    - x_cam, y_cam은 -1 ~ 1 범위로 정규화
- *    - (i+0.5, j+0.5)는 픽셀 중앙을 샘플링 (안티앨리어싱 기본)
+ *    - get_ray는 픽셀 중앙 (i+0.5, j+0.5)을, 안티앨리어싱은 픽셀
+ *      안의 다른 점을 샘플링 (get_ray_at)
  *    - tan(fov/2)로 시야각에 따른 스케일 조정
  *    - y_cam의 1-2*...는 화면 좌표와 카메라 좌표의 y축 반전 처리
- * 4. 카메라 로컬 좌표계 생성 (right, up, forward)
- * 5. 최종 광선 방향 = forward + x_cam*right + y_cam*up
+ * 3. 최종 광선 방향 = forward + x_cam*right + y_cam*up
  *    - 가상 스크린의 해당 픽셀 위치를 관통하는 방향
- * 6. 정규화하여 단위 벡터로 변환
+ *    - right, up, forward는 prepare_scene에서 미리 계산한 좌표계
+ * 4. 정규화하여 단위 벡터로 변환
  *
  * 핀홀 카메라 모델(Pinhole Camera Model)을 구현합니다.
  *
  * Return: 정규화된 광선 방향 벡터
  */
-static t_vec3	calculate_ray_direction(t_camera camera, int i, int j, int *wh)
+static t_vec3	calculate_ray_direction(t_camera *camera, double px,
+	double py, int *wh)
 {
-	double	fov_rad;
-	double	aspect_ratio;
-	double	x_cam;
-	double	y_cam;
-	t_vec3	right;
-	t_vec3	up;
-	t_vec3	forward;
+	t_real	aspect_ratio;
+	t_real	x_cam;
+	t_real	y_cam;
 	t_vec3	dir;
 
-	fov_rad = camera.fov * M_PI / 180.0;
-	aspect_ratio = (double)wh[0] / (double)wh[1];
-	x_cam = (2 * (i + 0.5) / (double)wh[0] - 1) * tan(fov_rad / 2);
+	aspect_ratio = (t_real)wh[0] / (t_real)wh[1];
+	x_cam = (2 * px / (t_real)wh[0] - 1) * camera->tan_half_fov;
 	x_cam *= aspect_ratio;
-	y_cam = (1 - 2 * (j + 0.5) / (double)wh[1]) * tan(fov_rad / 2);
-	create_camera_basis(camera.orientation, &right, &up, &forward);
-	dir = vec3_add(vec3_add(vec3_mul(right, x_cam), vec3_mul(up, y_cam)),
-			forward);
-	dir = vec3_normalize(dir);
+	y_cam = (1 - 2 * py / (t_real)wh[1]) * camera->tan_half_fov;
+	dir = v3_add(v3_add(v3_mul(camera->right, x_cam),
+				v3_mul(camera->up, y_cam)), camera->forward);
+	dir = v3_normalize(dir);
 	return (dir);
 }
 
@@ -115,14 +74,72 @@ static t_vec3	calculate_ray_direction(t_camera camera, int i, int j, int *wh)
  *
  * Return: 초기화된 광선 구조체 (origin, direction)
  */
-t_ray	get_ray(t_camera camera, int i, int j, int w)
+t_ray	get_ray(t_camera *camera, int i, int j, int w)
 {
 	t_ray	ray;
 	int		wh[2];
 
 	wh[0] = w;
 	wh[1] = HEIGHT;
-	ray.origin = camera.position;
-	ray.direction = calculate_ray_direction(camera, i, j, wh);
+	ray.origin = camera->position;
+	ray.direction = calculate_ray_direction(camera, i + 0.5, j + 0.5, wh);
+	return (ray);
+}
+
+/*
+ * get_ray_at - 픽셀 안의 임의의 점을 지나는 광선 생성
+ * @camera: 카메라 정보
+ * @px: 화면 위 점의 x 좌표 (픽셀 (i, j)는 [i, i + 1) × [j, j + 1))
+ * @py: 화면 위 점의 y 좌표
+ *
+ * 가장자리 픽셀의 추가 샘플을 픽셀 중앙이 아닌 곳에서 쏠 때 씁니다
+ * (render_aa.c). get_ray(camera, i, j, WIDTH)는
+ * get_ray_at(camera, i + 0.5, j + 0.5)와 같습니다.
+ *
+ * Return: 초기화된 광선 구조체 (origin, direction)
+ */
+t_ray	get_ray_at(t_camera *camera, double px, double py)
+{
+	t_ray	ray;
+	int		wh[2];
+
+	wh[0] = WIDTH;
+	wh[1] = HEIGHT;
+	ray.origin = camera->position;
+	ray.direction = calculate_ray_direction(camera, px, py, wh);
 	return (ray);
 }
+
+/*
+ * offset_ray_origin - 표면에서 출발하는 광선의 원점 보정
+ * @point: 표면 위의 교점
+ * @normal: 교점의 법선
+ * @dir: 새 광선이 향할 방향 (정규화되지 않아도 됨)
+ *
+ * 교점 좌표에는 부동소수점 오차가 있어서 그대로 광선을 쏘면
+ * 자기 자신과 다시 만나는 그림자 여드름(shadow acne)이 생깁니다.
+ *
+ * 1. dir 방향으로 0.001 * |dir|만큼 이동 (기존 방식)
+ * 2. RT_ORIGIN_BIAS > 0이면(float 빌드) dir 쪽 면의 법선 방향으로
+ *    RT_ORIGIN_BIAS * max(1, 좌표의 최대 절댓값)만큼 추가 이동
+ *
+ * float의 절대 오차는 좌표의 크기에 비례하므로 2번의 거리도
+ * 좌표 크기에 비례시켜 원점에서 먼 장면에서도 여드름이 생기지 않게
+ * 합니다. double 빌드에서는 RT_ORIGIN_BIAS가 0이라 1번만 적용됩니다.
+ *
+ * Return: 보정된 광선 원점
+ */
+t_vec3	offset_ray_origin(t_vec3 point, t_vec3 normal, t_vec3 dir)
+{
+	t_vec3	origin;
+	t_real	scale;
+
+	origin = v3_add(point, v3_mul(dir, 0.001));
+	if (RT_ORIGIN_BIAS <= 0)
+		return (origin);
+	scale = fmax(1.0, fmax(RT_FABS(point.x), fmax(RT_FABS(point.y),
+					RT_FABS(point.z))));
+	if (v3_dot(normal, dir) < 0)
+		scale = -scale;
+	return (v3_add(origin, v3_mul(normal, RT_ORIGIN_BIAS * scale)));
+}
@@ -10,95 +10,8 @@
 /*                                                                            */
 /* ************************************************************************** */
 
-#include "minirt.h"
-#include "vec3.h"
-
-/*
- * find_closest_intersection - 광선과 가장 가까운 물체의 교점 찾기
- * @scene: 장면 정보 (물체 목록)
- * @ray: 검사할 광선
- *
- * 장면의 모든 물체에 대해 광선과의 교점을 계산하고,
- * 카메라에 가장 가까운 교점을 찾습니다.
- *
- * 동작 과정:
- * 1. 모든 물체를 순회
- * 2. 물체 타입에 따라 적절한 교점 계산 함수 호출
- *    - 구(Sphere): intersect_sphere
- *    - 평면(Plane): intersect_plane
- *    - 원기둥(Cylinder): intersect_cylinder
- * 3. t > 0 (카메라 앞쪽)이고 현재까지의 최소값보다 작으면 갱신
- * 4. 가장 가까운 교점 정보 반환
- *
- * Return: 교점 정보 (t, object), 교점 없으면 t = -1
- */
-t_hit	find_closest_intersection(t_scene *scene, t_ray ray)
-{
-	t_hit		closest;
-	t_object	*obj;
-	double		t;
-
-	closest.t = -1;
-	closest.object = NULL;
-	obj = scene->objects;
-	while (obj)
-	{
-		if (obj->type == OBJ_SPHERE)
-			t = intersect_sphere(ray, (t_sphere *)obj->object);
-		else if (obj->type == OBJ_PLANE)
-			t = intersect_plane(ray, (t_plane *)obj->object);
-		else if (obj->type == OBJ_CYLINDER)
-			t = intersect_cylinder(ray, (t_cylinder *)obj->object);
-		else
-			t = -1;
-		if (t > 0 && (closest.t < 0 || t < closest.t))
-		{
-			closest.t = t;
-			closest.object = obj;
-		}
-		obj = obj->next;
-	}
-	return (closest);
-}
-
-/*
- * calculate_normal - 교점에서의 법선 벡터 계산
- * @hit: 교점 정보 (수정됨: normal 필드가 채워짐)
- *
- * 법선 벡터는 표면에 수직인 벡터로, 조명 계산에 필수적입니다.
- * 물체 타입에 따라 계산 방법이 다릅니다:
- *
- * 1. 구(Sphere):
- *    - normal = normalize(hit_point - center)
- *    - 구의 중심에서 표면의 점으로 향하는 벡터
- *    - 항상 바깥쪽을 향함
- *
- * 2. 평면(Plane):
- *    - normal = normalize(plane.normal)
- *    - 평면의 법선은 이미 정의되어 있음
- *    - 평면의 모든 점에서 동일
- *
- * 3. 원기둥(Cylinder):
- *    - 미구현 (복잡함: 측면과 캡의 법선이 다름)
- *
- * 법선은 항상 단위 벡터(길이 1)로 정규화됩니다.
- */
-static void	calculate_normal(t_hit *hit)
-{
-	t_sphere	*sp;
-	t_plane		*pl;
-
-	if (hit->object->type == OBJ_SPHERE)
-	{
-		sp = (t_sphere *)hit->object->object;
-		hit->normal = vec3_normalize(vec3_sub(hit->point, sp->center));
-	}
-	else if (hit->object->type == OBJ_PLANE)
-	{
-		pl = (t_plane *)hit->object->object;
-		hit->normal = vec3_normalize(pl->normal);
-	}
-}
+#include "render.h"
+#include "vec3_inline.h"
 
 /*
  * vec3_to_color - 벡터 색상(0.0~1.0)을 정수 RGB(0~255)로 변환
@@ -142,49 +55,108 @@ int	vec3_to_color(t_vec3 color)
 }
 
 /*
- * render_pixel - 단일 픽셀의 색상 계산 및 렌더링
- * @scene: 장면 정보
- * @data: MLX 이미지 데이터
- * @ij: 픽셀 좌표 배열 [x, y]
+ * render_sample - 단일 픽셀의 색상 계산
+ * @f: 프레임 상태 (장면, 타일 후보 목록)
+ * @x: 픽셀의 x 좌표
+ * @y: 픽셀의 y 좌표
  *
  * 레이트레이싱의 핵심 프로세스:
  *
  * 1. 광선 생성 (get_ray)
  *    - 카메라에서 현재 픽셀로 향하는 광선 생성
  *
- * 2. 교점 찾기 (find_closest_intersection)
- *    - 광선과 장면의 모든 물체와의 교점 계산
- *    - 가장 가까운 교점 선택
+ * 2. 교점 찾기 (tile_closest)
+ *    - 픽셀이 속한 타일의 후보 물체만 검사
  *
- * 3. 교점이 있으면:
- *    a. 교점 위치 계산: origin + t * direction
- *    b. 법선 벡터 계산 (calculate_normal)
- *    c. 조명 계산 (calculate_lighting)
- *       - 환경광, 확산광, 그림자 등
- *    d. 색상을 정수로 변환하여 이미지 버퍼에 저장
+ * 3. 색상 계산 (shade_hit)
+ *    - 법선 계산, 조명 계산
+ *    - 교점이 없으면 검은색(0) 배경
  *
- * 4. 교점이 없으면:
- *    - 검은색(0) 배경 설정
+ * 4. 색상을 정수로 변환
  *
- * 이미지 버퍼 인덱스: y * WIDTH + x (1차원 배열)
+ * 1~3은 sample_hit이 하고, f->relight이면 G-버퍼의 교점으로 3만
+ * 합니다. 재투영 기록이 있으면 (f->history) 지난 프레임의 샘플을 다시
+ * 쓸 수 있는지 먼저 보고 (history_sample), 계산한 샘플은 기록합니다.
+ *
+ * 저장은 호출한 쪽이 합니다 (이미지 버퍼 인덱스: y * WIDTH + x).
+ *
+ * Return: 0xRRGGBB 색상
  */
-static void	render_pixel(t_scene *scene, t_mlx_data *data, int *ij)
+int	render_sample(t_frame *f, int x, int y)
 {
-	t_ray	ray;
 	t_hit	hit;
-	t_vec3	color;
+	int		rgb;
+
+	if (f->history && !f->relight && history_sample(f, x, y, &rgb))
+		return (rgb);
+	rgb = vec3_to_color(sample_hit(f, x, y, &hit));
+	if (f->history)
+		history_store(f->history, y * WIDTH + x, &hit, rgb);
+	return (rgb);
+}
+
+/*
+ * render_tile - TILE_SIZE × TILE_SIZE 픽셀 타일 하나 렌더링
+ * @f: 프레임 상태
+ * @tile: 타일 번호 (가로 타일 수 × 타일 행 + 타일 열)
+ *
+ * 타일 안은 f->order의 순서로 돌고, 화면 끝의 타일은 화면 안의
+ * 픽셀만 렌더링합니다. 다른 타일의 픽셀은 건드리지 않으므로 여러
+ * 스레드가 서로 다른 타일을 함께 렌더링해도 됩니다 (render_pool.c).
+ * f->scale이 2 이상이면 render_coarse로 낮은 해상도로 렌더링하고,
+ * 안티앨리어싱 단계이면 가장자리 픽셀만 다시 샘플링합니다 (aa_tile).
+ */
+void	render_tile(t_frame *f, int tile)
+{
+	int	x0;
+	int	y0;
+	int	k;
+	int	x;
+	int	y;
 
-	ray = get_ray(scene->camera, ij[0], ij[1], WIDTH);
-	hit = find_closest_intersection(scene, ray);
-	if (hit.object)
+	if (f->scale > 1 || f->edges)
 	{
-		hit.point = vec3_add(ray.origin, vec3_mul(ray.direction, hit.t));
-		calculate_normal(&hit);
-		color = calculate_lighting(scene, hit);
-		data->img_data[ij[1] * WIDTH + ij[0]] = vec3_to_color(color);
+		if (f->edges)
+			aa_tile(f, tile);
+		else
+			render_coarse(f, tile);
+		return ;
+	}
+	x0 = tile % TILE_COLS * TILE_SIZE;
+	y0 = tile / TILE_COLS * TILE_SIZE;
+	k = 0;
+	while (k < TILE_SIZE * TILE_SIZE)
+	{
+		x = x0 + f->order[k] % TILE_SIZE;
+		y = y0 + f->order[k] / TILE_SIZE;
+		if (x < WIDTH && y < HEIGHT)
+			f->pixels[y * WIDTH + x] = render_sample(f, x, y);
+		k++;
+	}
+}
+
+/*
+ * render_rows - 화면 전체를 행 순서로 렌더링 (ORDER_SCANLINE)
+ * @f: 프레임 상태
+ *
+ * 비교용 순서입니다. 타일 후보 목록은 그대로 씁니다.
+ */
+static void	render_rows(t_frame *f)
+{
+	int	x;
+	int	y;
+
+	y = 0;
+	while (y < HEIGHT)
+	{
+		x = 0;
+		while (x < WIDTH)
+		{
+			f->pixels[y * WIDTH + x] = render_sample(f, x, y);
+			x++;
+		}
+		y++;
 	}
-	else
-		data->img_data[ij[1] * WIDTH + ij[0]] = 0;
 }
 
 /*
@@ -195,36 +167,39 @@ static void	render_pixel(t_scene *scene, t_mlx_data *data, int *ij)
  * 화면의 모든 픽셀에 대해 레이트레이싱을 수행합니다.
  *
  * 동작 과정:
- * 1. 화면을 위에서 아래로 (j: 0 → HEIGHT-1)
- * 2. 각 행을 왼쪽에서 오른쪽으로 (i: 0 → WIDTH-1) 순회
- * 3. 각 픽셀마다 render_pixel 호출
- *    - 광선 생성
- *    - 교점 계산
- *    - 조명 계산
- *    - 색상 저장
- *
- * 이중 루프 구조:
- * - 외부 루프: 행(j, y 좌표)
- * - 내부 루프: 열(i, x 좌표)
- *
- * 최적화 가능성:
- * - 멀티스레딩: 여러 픽셀을 병렬로 처리
- * - 타일 기반 렌더링: 화면을 작은 영역으로 나눠서 처리
- * - 적응형 샘플링: 복잡한 영역은 더 많이 샘플링
+ * 1. 현재 카메라로 화면 타일별 후보 목록을 만듦 (frame_begin)
+ *    - 카메라 광선은 모두 카메라에서 출발하므로 물체의 경계 상자를
+ *      화면에 투영하면 광선이 만날 수 있는 물체를 미리 알 수 있음
+ * 2. 화면을 TILE_SIZE 픽셀 타일로 나눠 왼쪽 위부터 차례로 렌더링
+ *    - 한 타일의 픽셀은 같은 후보 목록을 연달아 씀
+ *    - 타일 안은 scene->pixel_order 순서 (행, Z-곡선, Hilbert 곡선)
+ *    - 곡선 순서는 연속한 광선이 더 가까이 모여 같은 노드를 다시 씀
+ * 3. scene->antialias이면 G-버퍼로 가장자리를 찾아 그 픽셀만 여러 번
+ *    샘플링 (render_antialias)
+ * 4. 후보 목록 해제 (frame_end)
+ *
+ * 가속 구조가 없거나(메모리 부족) 목록을 만들 수 없으면 모든 픽셀이
+ * find_closest_intersection을 씁니다.
+ *
+ * 창이 있는 miniRT는 작업 스레드로 렌더링합니다 (pool_start). 이
+ * 함수는 호출한 스레드에서 끝까지 렌더링합니다.
  */
 void	render_scene(t_scene *scene, t_mlx_data *data)
 {
-	int	ij[2];
+	t_frame	f;
+	int		tile;
 
-	ij[1] = 0;
-	while (ij[1] < HEIGHT)
-	{
-		ij[0] = 0;
-		while (ij[0] < WIDTH)
-		{
-			render_pixel(scene, data, ij);
-			ij[0]++;
-		}
-		ij[1]++;
-	}
+	frame_begin(&f, scene, data->img_data);
+	if (scene->antialias)
+		f.gbuf = malloc(sizeof(t_hit) * WIDTH * HEIGHT);
+	tile = 0;
+	if (scene->pixel_order == ORDER_SCANLINE)
+		render_rows(&f);
+	else
+		while (tile < TILE_COUNT)
+			render_tile(&f, tile++);
+	if (f.gbuf)
+		render_antialias(&f);
+	free(f.gbuf);
+	frame_end(&f);
 }
@@ -0,0 +1,197 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   render_aa.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "render.h"
+#include "vec3_inline.h"
+
+/*
+ * mark_edge - 이웃한 두 픽셀이 다르면 둘 다 가장자리로 표시
+ * @f: 프레임 상태 (gbuf가 전체 해상도 프레임으로 채워짐)
+ * @edges: 픽셀별 가장자리 표시
+ * @a: 픽셀 번호
+ * @b: a의 오른쪽이나 아래 픽셀 번호
+ *
+ * 색은 재투영 기록이 있으면 기록한 한 샘플의 색을 씁니다. 이미지에는
+ * 앞 안티앨리어싱 단계의 평균 색이 남아 있을 수 있기 때문입니다.
+ */
+static void	mark_edge(t_frame *f, char *edges, int a, int b)
+{
+	int	ca;
+	int	cb;
+	int	ch;
+
+	ca = f->pixels[a];
+	cb = f->pixels[b];
+	if (f->history)
+	{
+		ca = f->history->last[a].color;
+		cb = f->history->last[b].color;
+	}
+	ch = 0;
+	while (ch < 24 && abs(((ca >> ch) & 255) - ((cb >> ch) & 255))
+		<= AA_COLOR_DIFF)
+		ch += 8;
+	if (ch < 24 || f->gbuf[a].object != f->gbuf[b].object
+		|| f->gbuf[a].instance != f->gbuf[b].instance
+		|| (f->gbuf[a].object
+			&& v3_dot(f->gbuf[a].normal, f->gbuf[b].normal) < AA_NORMAL_COS))
+	{
+		edges[a] = 1;
+		edges[b] = 1;
+	}
+}
+
+/*
+ * aa_edges - 다시 샘플링할 가장자리 픽셀과 타일 고르기
+ * @f: 한 샘플씩 끝난 전체 해상도 프레임 (gbuf가 있어야 함)
+ * @edges: 픽셀별 가장자리 표시 (앞 단계의 표시, 처음이면 모두 0)
+ * @tiles: 안티앨리어싱할 타일을 1로 표시 (0으로 두고 부름)
+ *
+ * 앞 단계의 가장자리가 있던 타일도 표시합니다. 그 픽셀에 남은 평균
+ * 색을 이번 표시에 맞게 다시 쓰기 위해서입니다 (aa_tile).
+ *
+ * Return: 가장자리 픽셀 수 (추가 샘플은 AA_SAMPLES배)
+ */
+int	aa_edges(t_frame *f, char *edges, char *tiles)
+{
+	int	p;
+	int	count;
+
+	p = -1;
+	while (++p < WIDTH * HEIGHT)
+	{
+		if (edges[p])
+			tiles[p / (WIDTH * TILE_SIZE) * TILE_COLS
+				+ p % WIDTH / TILE_SIZE] = 1;
+		edges[p] = 0;
+	}
+	while (--p >= 0)
+	{
+		if (p % WIDTH + 1 < WIDTH)
+			mark_edge(f, edges, p, p + 1);
+		if (p + WIDTH < WIDTH * HEIGHT)
+			mark_edge(f, edges, p, p + WIDTH);
+	}
+	count = 0;
+	while (++p < WIDTH * HEIGHT)
+		if (edges[p] && ++count)
+			tiles[p / (WIDTH * TILE_SIZE) * TILE_COLS
+				+ p % WIDTH / TILE_SIZE] = 1;
+	return (count);
+}
+
+/*
+ * aa_pixel - 픽셀 안 여러 곳의 샘플 평균
+ * @f: 프레임 상태
+ * @x: 픽셀의 x 좌표
+ * @y: 픽셀의 y 좌표
+ *
+ * 회전 격자(RGSS) 네 곳은 가로, 세로로 모두 다른 위치라 수평, 수직에
+ * 가까운 가장자리도 네 단계로 나눕니다. 모두 픽셀 안이므로 타일의
+ * 후보 목록을 그대로 씁니다 (tile_px_rect가 한 픽셀 넓힘). 재투영
+ * 기록과 G-버퍼에는 남기지 않습니다.
+ *
+ * Return: 0xRRGGBB 색상
+ */
+static int	aa_pixel(t_frame *f, int x, int y)
+{
+	static const double	g_rgss[8] = {-0.125, -0.375, 0.375, -0.125,
+		0.125, 0.375, -0.375, 0.125};
+	t_ray				ray;
+	t_hit				hit;
+	t_vec3				color[2];
+	int					k;
+
+	color[0] = v3_new(0, 0, 0);
+	k = 0;
+	while (k < AA_SAMPLES)
+	{
+		ray = get_ray_at(&f->scene->camera, x + 0.5 + g_rgss[k * 2],
+				y + 0.5 + g_rgss[k * 2 + 1]);
+		hit = tile_closest(f->scene, &f->bins,
+				y / TILE_SIZE * TILE_COLS + x / TILE_SIZE, ray);
+		shade_hit(f->scene, ray, &hit, &color[1]);
+		color[0] = v3_add(color[0], color[1]);
+		k++;
+	}
+	return (vec3_to_color(v3_mul(color[0], 1.0 / AA_SAMPLES)));
+}
+
+/*
+ * aa_tile - 타일 하나의 가장자리 픽셀 다시 샘플링 (f->edges가 있을 때)
+ * @f: 프레임 상태
+ * @tile: 타일 번호
+ *
+ * 가장자리가 아닌 픽셀은 재투영 기록이 있으면 기록한 한 샘플의 색으로
+ * 되돌리고, 없으면 그대로 둡니다.
+ */
+void	aa_tile(t_frame *f, int tile)
+{
+	int	x0;
+	int	x;
+	int	y;
+	int	p;
+
+	x0 = tile % TILE_COLS * TILE_SIZE;
+	y = tile / TILE_COLS * TILE_SIZE;
+	while (y < (tile / TILE_COLS + 1) * TILE_SIZE && y < HEIGHT)
+	{
+		x = x0;
+		while (x < x0 + TILE_SIZE && x < WIDTH)
+		{
+			p = y * WIDTH + x;
+			if (f->edges[p])
+				f->pixels[p] = aa_pixel(f, x, y);
+			else if (f->history)
+				f->pixels[p] = f->history->last[p].color;
+			x++;
+		}
+		y++;
+	}
+}
+
+/*
+ * render_antialias - 끝난 프레임의 가장자리를 이 스레드에서 다시 샘플링
+ * @f: 모든 타일을 렌더링한 전체 해상도 프레임 (gbuf가 있어야 함)
+ *
+ * render_scene이 씁니다. 작업 스레드는 pool_antialias가 가장자리가
+ * 있는 타일만 다시 렌더링합니다.
+ *
+ * Return: 가장자리 픽셀 수, 메모리가 없으면 -1 (이미지는 그대로)
+ */
+int	render_antialias(t_frame *f)
+{
+	char	tiles[TILE_COUNT];
+	int		count;
+	int		tile;
+
+	f->edges = malloc(WIDTH * HEIGHT);
+	if (!f->edges || !f->gbuf)
+	{
+		free(f->edges);
+		f->edges = NULL;
+		return (-1);
+	}
+	tile = 0;
+	while (tile < WIDTH * HEIGHT)
+		f->edges[tile++] = 0;
+	tile = 0;
+	while (tile < TILE_COUNT)
+		tiles[tile++] = 0;
+	count = aa_edges(f, f->edges, tiles);
+	while (--tile >= 0)
+		if (tiles[tile])
+			aa_tile(f, tile);
+	free(f->edges);
+	f->edges = NULL;
+	return (count);
+}
@@ -0,0 +1,156 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   render_budget.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "render.h"
+#include "libft.h"
+#include <limits.h>
+
+/*
+ * budget_from_name - --time-budget 인자를 밀리초로 바꾸기
+ * @arg: 숫자 뒤에 단위 s나 ms (단위가 없으면 초), 예: 2s, 1.5, 500ms
+ *
+ * Return: 밀리초 (1 이상), 읽을 수 없는 값이면 -1
+ */
+int	budget_from_name(char *arg)
+{
+	char	*end;
+	double	ms;
+
+	ms = strtod(arg, &end);
+	if (end == arg)
+		return (-1);
+	if (!*end || !ft_strcmp(end, "s"))
+		ms *= 1000;
+	else if (ft_strcmp(end, "ms"))
+		return (-1);
+	if (ms < 1 || ms > INT_MAX)
+		return (-1);
+	return ((int)ms);
+}
+
+/*
+ * tile_variance - 앞 프레임에서 타일 하나의 밝기 분산
+ * @pixels: 앞 프레임의 이미지 (WIDTH × HEIGHT)
+ * @tile: 타일 번호
+ * @step: 앞 프레임의 frame.scale (샘플을 계산한 픽셀만 봄)
+ *
+ * 밝기는 세 채널의 합 (0 ~ 765)입니다.
+ *
+ * Return: 샘플 밝기의 분산
+ */
+static double	tile_variance(int *pixels, int tile, int step)
+{
+	double	sum[2];
+	int		x;
+	int		y;
+	int		n;
+	int		l;
+
+	sum[0] = 0;
+	sum[1] = 0;
+	n = 0;
+	y = tile / TILE_COLS * TILE_SIZE;
+	while (y < (tile / TILE_COLS + 1) * TILE_SIZE && y < HEIGHT)
+	{
+		x = tile % TILE_COLS * TILE_SIZE;
+		while (x < (tile % TILE_COLS + 1) * TILE_SIZE && x < WIDTH)
+		{
+			l = pixels[y * WIDTH + x];
+			l = ((l >> 16) & 255) + ((l >> 8) & 255) + (l & 255);
+			sum[0] += l;
+			sum[1] += (double)l * l;
+			n++;
+			x += step;
+		}
+		y += step;
+	}
+	return (sum[1] / n - (sum[0] / n) * (sum[0] / n));
+}
+
+/*
+ * budget_order - 이번 프레임의 타일을 분산이 큰 순서로 정렬
+ * @p: 작업 스레드 묶음 (damage_apply가 queue를 채운 뒤, 잠금 안)
+ *
+ * back에는 아직 앞 프레임이 있으므로 그 분산을 씁니다. 분산이 같은
+ * 타일은 원래 순서를 지킵니다 (삽입 정렬, 타일 수가 작음).
+ */
+void	budget_order(t_pool *p)
+{
+	double	var[TILE_COUNT];
+	double	v;
+	int		tile;
+	int		i;
+	int		j;
+
+	i = -1;
+	while (++i < p->n_queue)
+	{
+		tile = p->queue[i];
+		v = tile_variance(p->back, tile, p->frame.scale);
+		j = i;
+		while (j > 0 && var[j - 1] < v)
+		{
+			var[j] = var[j - 1];
+			p->queue[j] = p->queue[j - 1];
+			j--;
+		}
+		var[j] = v;
+		p->queue[j] = tile;
+	}
+}
+
+/*
+ * pool_budget - 시간 예산 켜기 (--time-budget)
+ * @p: pool_start로 만든 묶음 (첫 pool_render 전, 장면은 antialias)
+ * @start: 예산을 재기 시작한 시각 (view_now 기준 ms, 프로그램 시작)
+ * @ms: start부터 마감까지의 시간 (밀리초)
+ *
+ * 첫 프레임을 BUDGET_FIRST_SCALE 해상도로 시작해 완성된 이미지를
+ * 먼저 만듭니다. 마감이 이미 지났어도 이 프레임은 렌더링합니다. 이후는
+ * view_refine이 남은 시간에 맞춰 해상도를 올리고 안티앨리어싱합니다.
+ */
+void	pool_budget(t_pool *p, double start, double ms)
+{
+	p->deadline = start + ms;
+	p->scale = BUDGET_FIRST_SCALE;
+}
+
+/*
+ * budget_expired - 마감이 되었으면 렌더링을 멈추기
+ * @p: 작업 스레드 묶음 (loop_hook이 매 프레임 부름)
+ *
+ * 지금 렌더링 중인 타일이 끝나기를 기다려야 하므로 그 예상 시간과
+ * BUDGET_SLACK_MS만큼 먼저 멈춥니다. 끝난 타일은 그 뒤의 pool_swap이
+ * 옮깁니다. 마감 전에 마지막 프레임이 끝났으면 이미 저장했으므로
+ * 예산만 끕니다. 첫 BUDGET_FIRST_SCALE 프레임이 끝나기 전에는
+ * 멈추지 않으므로 창 이미지는 언제나 완성된 이미지입니다.
+ *
+ * Return: 1 (멈춤, 창 이미지를 저장할 것), 0 (계속)
+ */
+int	budget_expired(t_pool *p)
+{
+	double	slack;
+
+	if (p->deadline <= 0 || !p->complete)
+		return (0);
+	slack = BUDGET_SLACK_MS
+		+ p->sample_ms * TILE_SIZE * TILE_SIZE * AA_SAMPLES;
+	if (view_now() + slack < p->deadline)
+		return (0);
+	p->deadline = 0;
+	if (p->shown == TILE_COUNT)
+		return (0);
+	pool_cancel(p);
+	printf("Time budget reached (1/%d resolution pass, %d of %d tiles)\n",
+		p->frame.scale, p->shown, TILE_COUNT);
+	return (1);
+}
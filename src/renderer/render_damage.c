@@ -0,0 +1,138 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   render_damage.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "render.h"
+#include "vec3_inline.h"
+
+/*
+ * mark_rect - 타일 범위를 다시 렌더링할 타일로 표시
+ * @dirty: 타일별 표시 (TILE_COUNT)
+ * @rect: 타일 범위 (최소 x, 최소 y, 최대 x, 최대 y, 양 끝 포함)
+ */
+static void	mark_rect(char *dirty, int *rect)
+{
+	int	tx;
+	int	ty;
+
+	ty = rect[1];
+	while (ty <= rect[3])
+	{
+		tx = rect[0];
+		while (tx <= rect[2])
+			dirty[ty * TILE_COLS + tx++] = 1;
+		ty++;
+	}
+}
+
+/*
+ * shadow_px - 상자가 광원에서 드리우는 그림자 영역의 픽셀 범위
+ * @cam: 카메라
+ * @box: 물체의 경계 상자
+ * @light: 광원 위치
+ * @px: 픽셀 범위 (출력, 빈 범위로 두고 부름)
+ *
+ * 그림자 광선이 상자와 만나는 교점은 광원에서 상자의 꼭짓점을 지나
+ * 상자 뒤로 끝없이 뻗는 반직선들의 볼록 껍질 안에 있습니다. 그 투영은
+ * 꼭짓점 8개의 투영과 반직선 방향 8개의 소실점으로 둘러싸입니다.
+ * 소실점은 카메라에서 그 방향으로 간 점의 투영입니다. 반직선이
+ * 카메라 뒤로 가거나 (광원이 상자 안이면 항상) 꼭짓점이 카메라 뒤에
+ * 있으면 투영이 화면 전체로 퍼질 수 있으므로 범위를 구하지 않습니다.
+ *
+ * Return: 1 (px를 채움), 0 (화면 전체로 봐야 함)
+ */
+static int	shadow_px(t_camera *cam, t_aabb *box, t_vec3 light, t_real *px)
+{
+	t_vec3	ends[2];
+	t_vec3	p;
+	t_real	xy[2];
+	int		k;
+
+	ends[0] = box->min;
+	ends[1] = box->max;
+	k = -1;
+	while (++k < 16)
+	{
+		p = v3_new(ends[k & 1].x, ends[(k >> 1) & 1].y, ends[(k >> 2) & 1].z);
+		if (k >= 8)
+			p = v3_add(cam->position, v3_sub(p, light));
+		if (!project_point(cam, p, xy))
+			return (0);
+		px[0] = fmin(px[0], xy[0]);
+		px[1] = fmin(px[1], xy[1]);
+		px[2] = fmax(px[2], xy[0]);
+		px[3] = fmax(px[3], xy[1]);
+	}
+	return (1);
+}
+
+/*
+ * damage_box - 경계 상자 안의 변화가 바꿀 수 있는 타일 표시
+ * @dirty: 타일별 표시 (TILE_COUNT, 표시한 타일은 1이 됨)
+ * @scene: prepare_scene이 끝난 장면 (카메라와 광원)
+ * @box: 바뀐 물체의 경계 상자 (옮겼으면 옛 상자와 새 상자 각각)
+ *
+ * 카메라 광선이 상자를 지나는 타일 (tile_rect)과, 광원마다 상자의
+ * 그림자 영역이 보이는 타일 (shadow_px)을 표시합니다. 반사가 없으므로
+ * 다른 픽셀은 이 상자 안의 물체와 만나는 광선을 쏘지 않습니다.
+ */
+void	damage_box(char *dirty, t_scene *scene, t_aabb *box)
+{
+	t_light	*light;
+	t_real	px[4];
+	int		rect[4];
+
+	if (tile_rect(&scene->camera, box, rect))
+		mark_rect(dirty, rect);
+	light = scene->lights;
+	while (light)
+	{
+		px[0] = INFINITY;
+		px[1] = INFINITY;
+		px[2] = -INFINITY;
+		px[3] = -INFINITY;
+		if (!shadow_px(&scene->camera, box, light->position, px))
+		{
+			px[0] = 0;
+			px[1] = 0;
+			px[2] = WIDTH;
+			px[3] = HEIGHT;
+		}
+		if (tile_px_rect(px, rect))
+			mark_rect(dirty, rect);
+		light = light->next;
+	}
+}
+
+/*
+ * damage_object - 물체 하나가 바꿀 수 있는 타일 표시
+ * @dirty: 타일별 표시 (TILE_COUNT)
+ * @scene: 장면
+ * @obj: 바꾸는 물체 (prepare_object 후)
+ *
+ * 물체를 바꾸기 전과 바꾼 뒤 (scene_update 후) 한 번씩 부르면 옛
+ * 자리와 새 자리가 모두 표시됩니다. 평면처럼 경계 상자가 없는 물체는
+ * 모든 타일을 표시합니다.
+ */
+void	damage_object(char *dirty, t_scene *scene, t_object *obj)
+{
+	t_aabb	box;
+	int		tile;
+
+	if (prim_bounds(obj, &box) >= 0)
+	{
+		damage_box(dirty, scene, &box);
+		return ;
+	}
+	tile = 0;
+	while (tile < TILE_COUNT)
+		dirty[tile++] = 1;
+}
@@ -0,0 +1,148 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   render_dirty.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "render.h"
+
+/*
+ * damage_begin - 물체를 바꾸기 전에 작업 스레드를 멈추고 표시 비우기
+ * @p: 작업 스레드 묶음
+ *
+ * 돌아온 뒤 damage_object로 옛 자리를 표시하고, 물체를 바꾸고
+ * (scene_update), 새 자리를 표시한 뒤 pool_damage를 부릅니다.
+ * 카메라가 움직이던 프레임은 옮겨 온 샘플이 섞여 있으므로 모든
+ * 타일을 다시 렌더링합니다.
+ */
+void	damage_begin(t_pool *p)
+{
+	int	tile;
+
+	pool_cancel(p);
+	tile = 0;
+	while (tile < TILE_COUNT)
+		p->dirty[tile++] = 0;
+	p->damaged = !p->history.moving;
+}
+
+/*
+ * damage_count - 다시 렌더링할 타일 수
+ * @p: 작업 스레드 묶음
+ *
+ * Return: 표시한 타일 수 (damaged가 0이면 TILE_COUNT)
+ */
+static int	damage_count(t_pool *p)
+{
+	int	tile;
+	int	count;
+
+	if (!p->damaged)
+		return (TILE_COUNT);
+	count = 0;
+	tile = 0;
+	while (tile < TILE_COUNT)
+		count += p->dirty[tile++];
+	return (count);
+}
+
+/*
+ * pool_damage - 표시한 타일만 다시 렌더링
+ * @p: damage_begin 후 물체를 바꾸고 타일을 표시한 묶음
+ *
+ * 표시하지 않았고 앞 프레임에서 창에 옮긴 타일은 그대로 둡니다
+ * (damage_apply). 표시한 타일의 재투영 기록과 G-버퍼는 옛 장면의
+ * 것이므로 epoch를 바꾸어 다시 추적하게 하고, 프레임이 끝날 때까지
+ * G-버퍼를 쓰지 않습니다. 일부 타일만 렌더링하므로 이 프레임으로는
+ * 샘플당 시간을 재지 않습니다.
+ */
+void	pool_damage(t_pool *p)
+{
+	if (damage_count(p) > 0)
+	{
+		p->history.epoch++;
+		p->history.moving = 0;
+		p->gbuf_valid = 0;
+	}
+	p->relight = 0;
+	pool_render(p);
+	p->started = 0;
+}
+
+/*
+ * damage_apply - 새 프레임에서 렌더링할 타일 고르기
+ * @p: 작업 스레드 묶음 (pool_render가 잠금 안에서, frame_begin 전에
+ *     부름)
+ *
+ * damage_begin 없이 시작한 프레임은 모든 타일을 렌더링합니다. 그렇지
+ * 않으면 표시하지 않았고, 앞 프레임에서 창에 옮겼고 (done이 2), 앞
+ * 프레임과 해상도가 같은 타일은 done을 2로 두고 queue에 넣지 않아
+ * 작업 스레드가 건너뛰게 합니다. 시간 예산이 있으면 분산이 큰 타일을
+ * 먼저 렌더링합니다 (budget_order).
+ *
+ * Return: 그대로 둔 타일 수 (새 프레임의 shown)
+ */
+int	damage_apply(t_pool *p)
+{
+	int	tile;
+	int	kept;
+
+	kept = 0;
+	p->n_queue = 0;
+	tile = 0;
+	while (tile < TILE_COUNT)
+	{
+		if (!p->damaged || p->dirty[tile] || p->done[tile] != 2
+			|| p->frame.scale != p->scale)
+		{
+			p->done[tile] = 0;
+			p->queue[p->n_queue++] = tile;
+		}
+		else
+			kept++;
+		tile++;
+	}
+	p->damaged = 0;
+	if (p->deadline > 0 && p->complete)
+		budget_order(p);
+	return (kept);
+}
+
+/*
+ * pool_antialias - 끝난 프레임의 가장자리 픽셀만 다시 샘플링 (--aa)
+ * @p: 전체 해상도 프레임을 모두 창에 옮긴 묶음 (view_refine이 부름)
+ *
+ * G-버퍼가 지금 프레임으로 채워져 있어야 합니다 (pool_gbuffer). 가장자리가 있는
+ * 타일을 dirty로 표시하고 그 타일만 안티앨리어싱 단계로 렌더링합니다.
+ * 나머지 타일은 창 이미지에 옮긴 그대로 둡니다. 샘플당 시간은 한
+ * 샘플씩의 프레임으로만 잽니다.
+ *
+ * Return: 1 (안티앨리어싱 단계를 시작함), 0 (할 일이 없음)
+ */
+int	pool_antialias(t_pool *p)
+{
+	int	count;
+
+	if (!p->frame.scene->antialias || !p->edges || !p->gbuf_valid)
+		return (0);
+	damage_begin(p);
+	count = aa_edges(&p->frame, p->edges, p->dirty);
+	if (damage_count(p) == 0)
+	{
+		p->damaged = 0;
+		return (0);
+	}
+	p->relight = 0;
+	p->antialias = 1;
+	pool_render(p);
+	p->started = 0;
+	printf("Antialiasing %d edge pixels (%.1f%% extra samples)\n", count,
+		100.0 * count * AA_SAMPLES / (WIDTH * HEIGHT));
+	return (1);
+}
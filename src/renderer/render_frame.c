@@ -0,0 +1,141 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   render_frame.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "render.h"
+#include "vec3_inline.h"
+
+/*
+ * frame_begin - 한 프레임을 렌더링하기 전의 준비
+ * @f: 채울 프레임 상태
+ * @scene: 렌더링할 장면 (prepare_scene 후)
+ * @pixels: 결과를 저장할 이미지 (WIDTH × HEIGHT)
+ *
+ * 현재 카메라로 타일 후보 목록을 만들고 (가속 구조가 없거나 만들 수
+ * 없으면 비워 둠), scene->pixel_order의 타일 안 순서표를 만듭니다.
+ */
+void	frame_begin(t_frame *f, t_scene *scene, int *pixels)
+{
+	f->scene = scene;
+	f->pixels = pixels;
+	f->scale = 1;
+	f->history = NULL;
+	f->gbuf = NULL;
+	f->relight = 0;
+	f->edges = NULL;
+	f->bins.count = NULL;
+	f->bins.start = NULL;
+	f->bins.items = NULL;
+	f->bins.queries = NULL;
+	if (scene->accel)
+		tile_bins_build(&f->bins, scene);
+	pixel_order_table(scene->pixel_order, f->order);
+}
+
+/*
+ * frame_end - 프레임이 끝난 뒤 타일 후보 목록 해제
+ * @f: frame_begin으로 채운 프레임 상태
+ */
+void	frame_end(t_frame *f)
+{
+	tile_bins_free(&f->bins);
+}
+
+/*
+ * fill_block - 샘플 색으로 블록 전체를 칠하기
+ * @pixels: 이미지 (WIDTH × HEIGHT)
+ * @xy: 블록의 왼쪽 위 픽셀 (샘플을 계산한 픽셀)
+ * @size: 블록의 한 변 길이
+ * @color: 샘플 색
+ *
+ * 화면 끝의 블록은 화면 안만 칠합니다. 점진적 렌더링에서는 더 작은
+ * 블록의 샘플이 나중에 그 위를 덮어씁니다.
+ */
+void	fill_block(int *pixels, int *xy, int size, int color)
+{
+	int	x;
+	int	y;
+
+	y = xy[1];
+	while (y < xy[1] + size && y < HEIGHT)
+	{
+		x = xy[0];
+		while (x < xy[0] + size && x < WIDTH)
+			pixels[y * WIDTH + x++] = color;
+		y++;
+	}
+}
+
+/*
+ * render_coarse - 타일 하나를 낮은 해상도로 렌더링 (f->scale > 1)
+ * @f: 프레임 상태
+ * @tile: 타일 번호
+ *
+ * 타일 안의 scale × scale 블록마다 왼쪽 위 픽셀의 샘플 하나를 계산해
+ * 블록 전체를 칠합니다. scale은 TILE_SIZE의 약수이므로 블록은 타일
+ * 밖으로 나가지 않고, 샘플은 타일의 후보 목록을 그대로 씁니다.
+ */
+void	render_coarse(t_frame *f, int tile)
+{
+	int	xy[2];
+	int	x0;
+	int	y0;
+
+	x0 = tile % TILE_COLS * TILE_SIZE;
+	y0 = tile / TILE_COLS * TILE_SIZE;
+	xy[1] = y0;
+	while (xy[1] < y0 + TILE_SIZE && xy[1] < HEIGHT)
+	{
+		xy[0] = x0;
+		while (xy[0] < x0 + TILE_SIZE && xy[0] < WIDTH)
+		{
+			fill_block(f->pixels, xy, f->scale,
+				render_sample(f, xy[0], xy[1]));
+			xy[0] += f->scale;
+		}
+		xy[1] += f->scale;
+	}
+}
+
+/*
+ * sample_hit - 샘플 하나의 교점 찾기와 조명 계산
+ * @f: 프레임 상태
+ * @x: 픽셀의 x 좌표
+ * @y: 픽셀의 y 좌표
+ * @hit: 찾은 교점 (출력, 물체가 없으면 object가 NULL)
+ *
+ * f->relight이면 광선을 추적하지 않고 G-버퍼에 기록한 교점으로
+ * 조명만 다시 계산합니다. 그렇지 않으면 광선을 추적하고, G-버퍼가
+ * 있으면 법선까지 채운 교점을 기록합니다. 조명은 어느 쪽이든 같은
+ * 교점으로 calculate_lighting을 부르므로 결과가 같습니다.
+ *
+ * Return: 샘플 색 (0.0 ~ 1.0)
+ */
+t_vec3	sample_hit(t_frame *f, int x, int y, t_hit *hit)
+{
+	t_ray	ray;
+	t_vec3	color;
+
+	if (f->relight)
+	{
+		*hit = f->gbuf[y * WIDTH + x];
+		if (!hit->object)
+			return (v3_new(0, 0, 0));
+		return (calculate_lighting(f->scene, *hit));
+	}
+	ray = get_ray(&f->scene->camera, x, y, WIDTH);
+	*hit = tile_closest(f->scene, &f->bins,
+			y / TILE_SIZE * TILE_COLS + x / TILE_SIZE, ray);
+	shade_hit(f->scene, ray, hit, &color);
+	if (f->gbuf)
+		f->gbuf[y * WIDTH + x] = *hit;
+	return (color);
+}
@@ -0,0 +1,105 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   render_history.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "render.h"
+
+/*
+ * history_init - 재투영 기록 할당
+ * @h: 채울 기록
+ *
+ * Return: 1 (성공), 0 (메모리 부족, 할당한 것은 history_free로 해제)
+ */
+int	history_init(t_history *h)
+{
+	h->last = malloc(sizeof(t_reuse) * WIDTH * HEIGHT);
+	h->map = malloc(sizeof(t_reuse) * WIDTH * HEIGHT);
+	h->epoch = 0;
+	h->moving = 0;
+	if (!h->last || !h->map)
+		return (0);
+	history_clear(h);
+	return (1);
+}
+
+/*
+ * history_clear - 기억한 샘플을 모두 버리기
+ * @h: 재투영 기록
+ *
+ * 장면이 바뀌어 기억한 교점과 색을 믿을 수 없을 때 부릅니다.
+ */
+void	history_clear(t_history *h)
+{
+	int	i;
+
+	i = 0;
+	while (i < WIDTH * HEIGHT)
+		h->last[i++].object = NULL;
+}
+
+/*
+ * history_free - 재투영 기록 해제
+ * @h: history_init으로 채운 기록
+ */
+void	history_free(t_history *h)
+{
+	free(h->last);
+	free(h->map);
+	h->last = NULL;
+	h->map = NULL;
+}
+
+/*
+ * history_reused - 마지막 프레임에서 옮겨 온 기록을 다시 쓴 샘플 수
+ * @h: 재투영 기록
+ * @scale: 마지막 프레임의 frame.scale
+ *
+ * 통계용입니다 (miniRT_bench --reproject).
+ *
+ * Return: 샘플 픽셀 중 다른 카메라의 기록을 다시 쓴 수
+ */
+int	history_reused(t_history *h, int scale)
+{
+	int	count;
+	int	x;
+	int	y;
+
+	count = 0;
+	y = 0;
+	while (y < HEIGHT)
+	{
+		x = 0;
+		while (x < WIDTH)
+		{
+			if (h->last[y * WIDTH + x].object
+				&& h->last[y * WIDTH + x].epoch < 0)
+				count++;
+			x += scale;
+		}
+		y += scale;
+	}
+	return (count);
+}
+
+/*
+ * history_store - 추적한 샘플을 기록
+ * @h: 재투영 기록
+ * @pixel: 샘플 픽셀 (y × WIDTH + x)
+ * @hit: shade_hit이 채운 교점 (object가 NULL이면 배경)
+ * @rgb: 샘플 색
+ */
+void	history_store(t_history *h, int pixel, t_hit *hit, int rgb)
+{
+	h->last[pixel].object = hit->object;
+	h->last[pixel].point = hit->point;
+	h->last[pixel].color = rgb;
+	h->last[pixel].epoch = h->epoch;
+}
@@ -0,0 +1,187 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   render_pool.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "render.h"
+#include <unistd.h>
+
+/*
+ * pool_worker - 작업 스레드 본체
+ * @arg: t_pool
+ *
+ * 지금 프레임에 남은 타일을 하나씩 가져가 back에 렌더링합니다.
+ * 렌더링하는 동안에는 잠금을 풀어 두므로 loop_hook과 다른 작업
+ * 스레드가 기다리지 않습니다. 취소된 프레임의 타일은 끝나도 done에
+ * 표시하지 않습니다. 가져갈 타일이 없으면 wake를 기다립니다.
+ *
+ * Return: NULL
+ */
+static void	*pool_worker(void *arg)
+{
+	t_pool	*p;
+	int		tile;
+
+	p = arg;
+	pthread_mutex_lock(&p->lock);
+	while (!p->quit)
+	{
+		if (p->cancel || p->next >= p->n_queue)
+			pthread_cond_wait(&p->wake, &p->lock);
+		else
+		{
+			tile = p->queue[p->next++];
+			p->active++;
+			pthread_mutex_unlock(&p->lock);
+			render_tile(&p->frame, tile);
+			pthread_mutex_lock(&p->lock);
+			if (!p->cancel)
+				p->done[tile] = 1;
+			p->active--;
+			if (p->active == 0)
+				pthread_cond_broadcast(&p->idle);
+		}
+	}
+	pthread_mutex_unlock(&p->lock);
+	return (NULL);
+}
+
+/*
+ * pool_init - 작업 스레드 묶음의 버퍼와 상태 초기화
+ * @p: 채울 묶음
+ * @scene: 렌더링할 장면
+ * @data: 완성된 타일을 옮길 창 이미지
+ *
+ * 처음에는 렌더링할 프레임이 없습니다 (cancel이 1).
+ *
+ * Return: 1 (성공), 0 (메모리 부족)
+ */
+static int	pool_init(t_pool *p, t_scene *scene, t_mlx_data *data)
+{
+	p->data = data;
+	p->back = malloc(sizeof(int) * WIDTH * HEIGHT);
+	p->done = malloc(TILE_COUNT);
+	p->frame.scene = scene;
+	p->frame.pixels = p->back;
+	p->frame.bins.count = NULL;
+	p->frame.bins.start = NULL;
+	p->frame.bins.items = NULL;
+	p->shown = 0;
+	p->active = 0;
+	p->cancel = 1;
+	p->quit = 0;
+	p->n_threads = 0;
+	p->scale = 1;
+	p->started = 0;
+	p->sample_ms = 0;
+	p->gbuf = NULL;
+	p->gbuf_valid = 0;
+	p->relight = 0;
+	p->damaged = 0;
+	p->edges = NULL;
+	p->antialias = 0;
+	p->deadline = 0;
+	p->complete = 0;
+	return (history_init(&p->history) && p->back && p->done);
+}
+
+/*
+ * pool_start - 작업 스레드 묶음 만들기
+ * @scene: 렌더링할 장면 (prepare_scene 후)
+ * @data: 완성된 타일을 옮길 창 이미지
+ * @n_threads: 작업 스레드 수 (0 이하이면 CPU 코어 수)
+ *
+ * 스레드는 pool_render가 첫 프레임을 시작할 때까지 기다립니다.
+ *
+ * Return: 작업 스레드 묶음, 메모리가 없거나 스레드를 하나도 만들 수
+ *         없으면 NULL
+ */
+t_pool	*pool_start(t_scene *scene, t_mlx_data *data, int n_threads)
+{
+	t_pool	*p;
+
+	p = malloc(sizeof(t_pool));
+	if (!p)
+		return (NULL);
+	if (n_threads <= 0)
+		n_threads = sysconf(_SC_NPROCESSORS_ONLN);
+	if (n_threads > POOL_MAX_THREADS)
+		n_threads = POOL_MAX_THREADS;
+	pthread_mutex_init(&p->lock, NULL);
+	pthread_cond_init(&p->wake, NULL);
+	pthread_cond_init(&p->idle, NULL);
+	if (pool_init(p, scene, data))
+		while (p->n_threads < n_threads && !pthread_create(
+				&p->threads[p->n_threads], NULL, pool_worker, p))
+			p->n_threads++;
+	if (p->n_threads == 0)
+	{
+		pool_stop(p);
+		return (NULL);
+	}
+	return (p);
+}
+
+/*
+ * pool_gbuffer - G-버퍼 켜기 (--gbuffer)
+ * @p: pool_start로 만든 묶음 (첫 pool_render 전)
+ *
+ * 이후 프레임이 추적한 샘플의 교점을 기록합니다. 전체 해상도
+ * 프레임이 끝나면 광원만 바뀌었을 때 pool_relight가 그 교점을 씁니다.
+ * 장면이 antialias이면 가장자리 표시도 할당합니다 (pool_antialias).
+ *
+ * Return: 1 (성공), 0 (메모리 부족, G-버퍼 없이 계속 렌더링)
+ */
+int	pool_gbuffer(t_pool *p)
+{
+	int	i;
+
+	if (!p->gbuf)
+		p->gbuf = malloc(sizeof(t_hit) * WIDTH * HEIGHT);
+	if (p->frame.scene->antialias && !p->edges)
+	{
+		p->edges = malloc(WIDTH * HEIGHT);
+		i = 0;
+		while (p->edges && i < WIDTH * HEIGHT)
+			p->edges[i++] = 0;
+	}
+	return (p->gbuf != NULL);
+}
+
+/*
+ * pool_stop - 작업 스레드를 모두 끝내고 묶음 해제
+ * @p: pool_start로 만든 묶음
+ *
+ * 렌더링 중인 스레드는 지금 타일을 끝낸 뒤 멈추므로, 기다리는 시간은
+ * 타일 하나를 렌더링하는 시간 이하입니다.
+ */
+void	pool_stop(t_pool *p)
+{
+	int	i;
+
+	pthread_mutex_lock(&p->lock);
+	p->quit = 1;
+	p->cancel = 1;
+	pthread_cond_broadcast(&p->wake);
+	pthread_mutex_unlock(&p->lock);
+	i = 0;
+	while (i < p->n_threads)
+		pthread_join(p->threads[i++], NULL);
+	frame_end(&p->frame);
+	pthread_mutex_destroy(&p->lock);
+	pthread_cond_destroy(&p->wake);
+	pthread_cond_destroy(&p->idle);
+	history_free(&p->history);
+	free(p->gbuf);
+	free(p->edges);
+	free(p->back);
+	free(p->done);
+	free(p);
+}
@@ -0,0 +1,92 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   render_progressive.c                               :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "render.h"
+
+/*
+ * block_pixel - 지금 단계의 블록 번호를 샘플 픽셀로 바꾸기
+ * @p: 점진적 렌더링 상태
+ * @block: 블록 번호 (블록 행 순서)
+ * @xy: 블록의 왼쪽 위 픽셀 (출력)
+ *
+ * 두 배 크기 블록의 왼쪽 위 픽셀은 앞 단계에서 이미 계산했습니다.
+ *
+ * Return: 1 (새로 계산할 샘플), 0 (앞 단계에서 계산한 샘플)
+ */
+static int	block_pixel(t_progress *p, int block, int *xy)
+{
+	int	cols;
+
+	cols = (WIDTH + p->step - 1) / p->step;
+	xy[0] = block % cols * p->step;
+	xy[1] = block / cols * p->step;
+	return (p->step == PROGRESSIVE_START
+		|| xy[0] % (2 * p->step) || xy[1] % (2 * p->step));
+}
+
+/*
+ * progress_start - 점진적 렌더링 시작
+ * @scene: 렌더링할 장면
+ * @data: 결과를 저장할 이미지
+ *
+ * Return: 점진적 렌더링 상태, 메모리 부족이면 NULL
+ */
+t_progress	*progress_start(t_scene *scene, t_mlx_data *data)
+{
+	t_progress	*p;
+
+	p = malloc(sizeof(t_progress));
+	if (!p)
+		return (NULL);
+	frame_begin(&p->frame, scene, data->img_data);
+	p->step = PROGRESSIVE_START;
+	p->next = 0;
+	return (p);
+}
+
+/*
+ * progress_step - 다음 샘플들을 렌더링
+ * @p: 점진적 렌더링 상태
+ * @budget: 이번에 계산할 최대 샘플 수
+ *
+ * 지금 단계의 블록을 블록 행 순서로 계산해 블록을 칠하고, 단계가
+ * 끝나면 블록 크기를 반으로 줄입니다. 마지막 단계(블록 크기 1)가
+ * 끝나면 step을 0으로 두고 타일 후보 목록을 해제합니다. 그때
+ * 이미지는 render_scene의 결과와 같습니다.
+ *
+ * Return: 계산한 샘플 수
+ */
+int	progress_step(t_progress *p, int budget)
+{
+	int	xy[2];
+	int	done;
+
+	done = 0;
+	while (p->step > 0 && done < budget)
+	{
+		if (block_pixel(p, p->next++, xy))
+		{
+			fill_block(p->frame.pixels, xy, p->step,
+				render_sample(&p->frame, xy[0], xy[1]));
+			done++;
+		}
+		if (p->next >= ((WIDTH + p->step - 1) / p->step)
+			* ((HEIGHT + p->step - 1) / p->step))
+		{
+			p->step /= 2;
+			p->next = 0;
+			if (p->step == 0)
+				frame_end(&p->frame);
+		}
+	}
+	return (done);
+}
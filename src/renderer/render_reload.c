@@ -0,0 +1,145 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   render_reload.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "render.h"
+
+/*
+ * reload_objects - 값이 바뀐 물체만 옮기고 가속 구조 고치기
+ * @p: 작업 스레드 묶음 (작업 스레드가 멈춘 뒤)
+ * @fresh: scene_diff가 DIFF_SHAPE 없이 비교한 장면
+ *
+ * 바꾼 물체마다 옛 자리와 새 자리의 타일을 p->dirty에 표시합니다
+ * (damage_object). 옛 도형은 fresh의 물체로 넘어가 있습니다.
+ *
+ * Return: 1 (성공), 0 (메모리 부족, 아무것도 옮기지 않음)
+ */
+static int	reload_objects(t_pool *p, t_scene *fresh)
+{
+	t_object	**moved;
+	t_object	*obj;
+	int			count;
+	int			n;
+	int			i;
+
+	count = 0;
+	obj = fresh->objects;
+	while (obj && ++count)
+		obj = obj->next;
+	moved = malloc(sizeof(t_object *) * (2 * count + 1));
+	if (!moved)
+		return (0);
+	n = scene_adopt_objects(p->frame.scene, fresh, moved, moved + count);
+	i = 0;
+	while (i < n)
+		damage_object(p->dirty, p->frame.scene, moved[count + i++]);
+	scene_refit(p->frame.scene, moved, n);
+	i = 0;
+	while (i < n)
+		damage_object(p->dirty, p->frame.scene, moved[i++]);
+	free(moved);
+	return (1);
+}
+
+/*
+ * reload_view - 카메라만 바뀐 뒤 다시 렌더링
+ * @p: 작업 스레드 묶음
+ *
+ * WASD로 카메라를 옮길 때 (view_key)처럼 낮은 해상도에서 시작하고,
+ * 앞 카메라의 샘플은 재투영해 다시 씁니다.
+ */
+static void	reload_view(t_pool *p)
+{
+	view_measure(p);
+	p->relight = 0;
+	p->gbuf_valid = 0;
+	p->scale = view_scale(p, VIEW_TARGET_MS);
+	p->history.epoch++;
+	p->history.moving = 1;
+	pool_render(p);
+}
+
+/*
+ * pool_reload - 다시 읽은 장면의 바뀐 부분만 옮기고 다시 렌더링
+ * @p: 작업 스레드 묶음
+ * @fresh: 장면 파일을 다시 parse_scene으로 읽은 장면 (해제됨)
+ *
+ * 바뀐 것에 따라 다시 렌더링하는 방법을 고릅니다.
+ * - 물체 값만: 그 물체의 BVH 잎에서 루트까지만 고치고 (scene_refit)
+ *   옛 자리와 새 자리 주변 타일만 다시 렌더링 (pool_damage)
+ * - 광원이나 환경광만: G-버퍼로 조명만 다시 계산 (pool_relight)
+ * - 카메라만: 재투영하며 낮은 해상도부터 (reload_view)
+ * - 그 밖: 바뀐 부분을 모두 옮기고 재투영 기록 없이 전체 해상도로
+ *   처음부터 렌더링. 물체의 구성이 바뀌었으면 가속 구조도 새로 만듭니다.
+ * 바뀐 것이 없으면 렌더링 중인 프레임을 그대로 둡니다.
+ *
+ * Return: scene_diff의 결과
+ */
+int	pool_reload(t_pool *p, t_scene *fresh)
+{
+	int	diff;
+
+	diff = scene_diff(p->frame.scene, fresh);
+	if (diff == DIFF_OBJECTS)
+		damage_begin(p);
+	else if (diff)
+		pool_cancel(p);
+	if ((diff & DIFF_OBJECTS) && !(diff & DIFF_SHAPE)
+		&& !reload_objects(p, fresh))
+		diff |= DIFF_SHAPE;
+	scene_adopt(p->frame.scene, fresh, diff);
+	if (diff == DIFF_OBJECTS)
+		pool_damage(p);
+	else if (diff == DIFF_LIGHTS)
+		pool_relight(p);
+	else if (diff == DIFF_CAMERA)
+		reload_view(p);
+	else if (diff)
+	{
+		p->damaged = 0;
+		p->gbuf_valid = 0;
+		pool_relight(p);
+	}
+	return (diff);
+}
+
+/*
+ * pool_watch - 장면 파일이 저장되었으면 다시 읽어 다시 렌더링
+ * @p: 작업 스레드 묶음
+ * @w: watch_start로 시작한 감시
+ *
+ * loop_hook이 매 프레임 부릅니다. 파일을 읽을 수 없거나 반쯤 쓴 줄이
+ * 있으면 parse_scene이 첫 잘못된 줄을 출력하고 NULL을 돌려주므로
+ * 지금 장면을 그대로 두고 다음 저장을 기다립니다. 파일의 C 줄이 앞에 읽은 것과 같으면 WASD로 옮긴 지금
+ * 카메라를 그대로 둡니다.
+ *
+ * Return: pool_reload의 결과 (다시 읽지 않았으면 0)
+ */
+int	pool_watch(t_pool *p, t_watch *w)
+{
+	t_scene		*fresh;
+	t_camera	camera;
+	int			diff;
+
+	if (!watch_poll(w))
+		return (0);
+	fresh = parse_scene(w->path);
+	if (!fresh)
+		return (0);
+	camera = fresh->camera;
+	if (camera_equal(&camera, &w->camera))
+		fresh->camera = p->frame.scene->camera;
+	w->camera = camera;
+	diff = pool_reload(p, fresh);
+	if (diff)
+		printf("Reloaded %s\n", w->path);
+	return (diff);
+}
@@ -0,0 +1,148 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   render_reproject.c                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "render.h"
+#include "vec3_inline.h"
+
+/*
+ * scatter_one - 기록 하나를 새 카메라의 샘플 픽셀로 옮기기
+ * @h: 재투영 기록
+ * @cam: 새 카메라
+ * @pixel: 기록의 픽셀 (y × WIDTH + x)
+ * @scale: 새 프레임의 frame.scale
+ *
+ * 교점이 든 픽셀의 scale × scale 블록 왼쪽 위(샘플 픽셀)로 옮깁니다.
+ * 이미 옮겨 온 기록이 있으면 카메라에 더 가까운 쪽을 남깁니다. 같은
+ * 카메라의 기록이라도 자기 픽셀이 아닌 곳으로 가면 다른 카메라의
+ * 기록처럼 다룹니다 (epoch -1).
+ */
+static void	scatter_one(t_history *h, t_camera *cam, int pixel, int scale)
+{
+	t_reuse	*dst;
+	t_real	xy[2];
+	int		x;
+	int		y;
+
+	if (!project_point(cam, h->last[pixel].point, xy)
+		|| xy[0] < -0.5 || xy[1] < -0.5
+		|| xy[0] >= WIDTH - 0.5 || xy[1] >= HEIGHT - 0.5)
+		return ;
+	x = (int)(xy[0] + 0.5);
+	y = (int)(xy[1] + 0.5);
+	dst = &h->map[(y - y % scale) * WIDTH + x - x % scale];
+	if (dst->object && v3_dot(v3_sub(dst->point, cam->position), cam->forward)
+		<= v3_dot(v3_sub(h->last[pixel].point, cam->position), cam->forward))
+		return ;
+	*dst = h->last[pixel];
+	if (dst->epoch != h->epoch || dst != &h->map[pixel])
+		dst->epoch = -1;
+}
+
+/*
+ * history_reproject - 기억한 교점을 새 카메라의 샘플 픽셀로 옮기기
+ * @h: 재투영 기록
+ * @cam: 새 프레임의 카메라
+ * @scale: 새 프레임의 frame.scale
+ *
+ * 새 프레임을 시작할 때 작업 스레드가 멈춘 상태에서 한 번 부릅니다.
+ * 픽셀 수에 비례하는 시간이 걸립니다 (800×600에서 약 10 ms). 이
+ * 시간도 프레임 시간에 들어가므로 view_scale이 함께 고려합니다.
+ */
+void	history_reproject(t_history *h, t_camera *cam, int scale)
+{
+	int	i;
+
+	i = 0;
+	while (i < WIDTH * HEIGHT)
+		h->map[i++].object = NULL;
+	i = 0;
+	while (i < WIDTH * HEIGHT)
+	{
+		if (h->last[i].object)
+			scatter_one(h, cam, i, scale);
+		i++;
+	}
+}
+
+/*
+ * history_visible - 카메라에서 옮겨 온 교점까지 가리는 물체가 없는지
+ * @f: 프레임 상태
+ * @x: 샘플 픽셀의 x 좌표
+ * @y: 샘플 픽셀의 y 좌표
+ * @point: 옮겨 온 교점
+ *
+ * 교점은 이 샘플의 블록 안으로 투영되므로 가리는 물체는 이 타일의
+ * 후보 목록에 있습니다. 가장 가까운 교점은 필요 없으므로 교점 바로
+ * 앞(HISTORY_EPSILON)에서 끝나는 구간을 any-hit으로 검사하고 처음
+ * 찾은 물체에서 멈춥니다. 목록이 없거나 후보가 너무 많은 타일은
+ * scene_occluded로 검사합니다.
+ *
+ * Return: 1 (보임), 0 (가려짐)
+ */
+static int	history_visible(t_frame *f, int x, int y, t_vec3 point)
+{
+	t_trav	tr;
+	t_real	dist;
+	int		tile;
+	int		i;
+
+	tr.ray.origin = f->scene->camera.position;
+	tr.ray.direction = v3_sub(point, tr.ray.origin);
+	dist = v3_length(tr.ray.direction);
+	tr.ray.direction = v3_div(tr.ray.direction, dist);
+	tile = y / TILE_SIZE * TILE_COLS + x / TILE_SIZE;
+	if (!f->bins.count || f->bins.count[tile] < 0)
+		return (!scene_occluded(f->scene, tr.ray,
+				dist * (1 - HISTORY_EPSILON)));
+	tr.inv_dir = v3_new(1.0 / tr.ray.direction.x,
+			1.0 / tr.ray.direction.y, 1.0 / tr.ray.direction.z);
+	tr.best.t = dist * (1 - HISTORY_EPSILON);
+	tr.any = 1;
+	if (plane_pass(f->scene->accel, &tr))
+		return (0);
+	i = f->bins.start[tile];
+	while (i < f->bins.start[tile] + f->bins.count[tile])
+		if (prim_item(f->scene->accel, f->bins.items[i++], &tr))
+			return (0);
+	return (1);
+}
+
+/*
+ * history_sample - 옮겨 온 기록으로 샘플 하나를 계산하기
+ * @f: 프레임 상태 (f->history가 있음)
+ * @x: 샘플 픽셀의 x 좌표
+ * @y: 샘플 픽셀의 y 좌표
+ * @rgb: 다시 쓴 색 (출력)
+ *
+ * 같은 카메라로 이 픽셀을 추적한 기록은 그대로 씁니다. 다른 카메라의
+ * 기록은 카메라가 움직이는 중일 때만, 카메라에서 교점까지 가리는
+ * 물체가 없으면 씁니다 (history_visible). 가장 가까운 교점을 찾는
+ * 광선, 그림자 광선과 조명 계산을 건너뛰는 만큼 빨라집니다. 다시 쓴
+ * 기록은 last에 남겨 다음 프레임에도 옮겨 갑니다.
+ *
+ * Return: 1 (기록을 다시 씀), 0 (광선을 추적해야 함)
+ */
+int	history_sample(t_frame *f, int x, int y, int *rgb)
+{
+	t_history	*h;
+	t_reuse		*r;
+
+	h = f->history;
+	r = &h->map[y * WIDTH + x];
+	if (!r->object || (r->epoch != h->epoch && !h->moving))
+		return (0);
+	if (r->epoch != h->epoch && !history_visible(f, x, y, r->point))
+		return (0);
+	h->last[y * WIDTH + x] = *r;
+	*rgb = r->color;
+	return (1);
+}
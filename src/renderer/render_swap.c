@@ -0,0 +1,144 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   render_swap.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "render.h"
+
+/*
+ * copy_tile - back의 타일 하나를 창 이미지로 옮기기
+ * @p: 작업 스레드 묶음
+ * @tile: 타일 번호
+ */
+static void	copy_tile(t_pool *p, int tile)
+{
+	int	x0;
+	int	y;
+	int	x;
+
+	x0 = tile % TILE_COLS * TILE_SIZE;
+	y = tile / TILE_COLS * TILE_SIZE;
+	while (y < (tile / TILE_COLS + 1) * TILE_SIZE && y < HEIGHT)
+	{
+		x = x0;
+		while (x < x0 + TILE_SIZE && x < WIDTH)
+		{
+			p->data->img_data[y * WIDTH + x] = p->back[y * WIDTH + x];
+			x++;
+		}
+		y++;
+	}
+}
+
+/*
+ * pool_cancel - 지금 프레임을 취소하고 작업 스레드가 멈추기를 기다리기
+ * @p: 작업 스레드 묶음
+ *
+ * 렌더링 중인 타일이 끝나기를 기다리므로 (타일 하나 이하) 돌아온
+ * 뒤에는 장면과 카메라를 바꿔도 됩니다. 작업 스레드는 pool_render를
+ * 부를 때까지 쉽니다.
+ */
+void	pool_cancel(t_pool *p)
+{
+	pthread_mutex_lock(&p->lock);
+	p->cancel = 1;
+	while (p->active > 0)
+		pthread_cond_wait(&p->idle, &p->lock);
+	pthread_mutex_unlock(&p->lock);
+}
+
+/*
+ * pool_render - 지금 프레임을 취소하고 새 프레임 시작
+ * @p: 작업 스레드 묶음
+ *
+ * 카메라나 장면이 바뀌었을 때 메인 스레드가 부릅니다 (바꾸기 전에
+ * pool_cancel). 현재 장면으로 타일 후보 목록을 다시 만들고 모든
+ * 타일을 p->scale 해상도로 다시 렌더링하게 합니다. 지난 프레임의
+ * 샘플은 새 카메라로 옮겨 두고 다시 쓸 수 있으면 씁니다
+ * (history_reproject). p->relight이면 광선을 추적하지 않고 G-버퍼로
+ * 조명만 다시 계산합니다 (pool_relight). damage_begin 후이면 바뀐
+ * 물체 주변의 타일만 렌더링합니다 (damage_apply). p->antialias이면
+ * 표시한 타일의 가장자리 픽셀만 다시 샘플링합니다. 창 이미지는 새
+ * 타일이 끝날 때까지 앞 프레임을 그대로 보여 줍니다.
+ */
+void	pool_render(t_pool *p)
+{
+	pool_cancel(p);
+	pthread_mutex_lock(&p->lock);
+	p->shown = damage_apply(p);
+	frame_end(&p->frame);
+	frame_begin(&p->frame, p->frame.scene, p->back);
+	p->frame.scale = p->scale;
+	p->frame.history = &p->history;
+	p->frame.gbuf = p->gbuf;
+	p->frame.relight = p->relight;
+	if (p->antialias)
+		p->frame.edges = p->edges;
+	p->antialias = 0;
+	history_reproject(&p->history, &p->frame.scene->camera, p->scale);
+	p->started = view_now();
+	p->next = 0;
+	p->cancel = 0;
+	pthread_cond_broadcast(&p->wake);
+	pthread_mutex_unlock(&p->lock);
+}
+
+/*
+ * pool_swap - 끝난 타일을 창 이미지로 옮기기
+ * @p: 작업 스레드 묶음
+ *
+ * loop_hook이 매 프레임 부릅니다. 타일 하나는 TILE_SIZE² 픽셀이라
+ * 잠금 안에서 복사해도 작업 스레드를 오래 막지 않습니다. p->shown이
+ * TILE_COUNT가 되면 프레임이 완성된 것입니다.
+ *
+ * Return: 이번에 옮긴 타일 수
+ */
+int	pool_swap(t_pool *p)
+{
+	int	tile;
+	int	moved;
+
+	moved = 0;
+	pthread_mutex_lock(&p->lock);
+	tile = 0;
+	while (tile < TILE_COUNT)
+	{
+		if (p->done[tile] == 1)
+		{
+			copy_tile(p, tile);
+			p->done[tile] = 2;
+			moved++;
+		}
+		tile++;
+	}
+	pthread_mutex_unlock(&p->lock);
+	p->shown += moved;
+	return (moved);
+}
+
+/*
+ * pool_relight - 광원이나 환경광만 바뀐 뒤 다시 렌더링
+ * @p: 작업 스레드 묶음 (pool_cancel 후 장면의 광원을 바꿈)
+ *
+ * 카메라가 그대로이고 G-버퍼가 지금 카메라의 전체 해상도 프레임으로
+ * 채워져 있으면 (gbuf_valid) 광선 추적 없이 조명만 다시 계산합니다.
+ * 그렇지 않으면 전체 해상도로 처음부터 렌더링합니다. 재투영 기록의
+ * 색은 앞 조명으로 계산했으므로 어느 쪽이든 지웁니다. 다시 렌더링하는
+ * 샘플이 새 색으로 다시 기록합니다.
+ */
+void	pool_relight(t_pool *p)
+{
+	pool_cancel(p);
+	history_clear(&p->history);
+	p->history.moving = 0;
+	p->scale = 1;
+	p->relight = p->gbuf_valid;
+	pool_render(p);
+}
@@ -0,0 +1,133 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   render_thumb.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "render.h"
+#include "vec3_inline.h"
+
+/*
+ * thumb_pixel - 화면 위 한 점으로 광선 하나를 쏘아 색 구하기
+ * @f: 프레임 상태 (전체 해상도의 타일 후보 목록)
+ * @px: 화면 x 좌표 (픽셀 단위, 0 ~ WIDTH)
+ * @py: 화면 y 좌표 (픽셀 단위, 0 ~ HEIGHT)
+ *
+ * 점이 든 픽셀의 타일 후보 목록을 씁니다 (tile_px_rect가 한 픽셀
+ * 넓히므로 픽셀 안의 어느 점이든 됨).
+ *
+ * Return: 0xRRGGBB 색상
+ */
+static int	thumb_pixel(t_frame *f, double px, double py)
+{
+	t_ray	ray;
+	t_hit	hit;
+	t_vec3	color;
+
+	ray = get_ray_at(&f->scene->camera, px, py);
+	hit = tile_closest(f->scene, &f->bins,
+			(int)py / TILE_SIZE * TILE_COLS + (int)px / TILE_SIZE, ray);
+	shade_hit(f->scene, ray, &hit, &color);
+	return (vec3_to_color(color));
+}
+
+/*
+ * render_thumbnail - 같은 화면을 작은 이미지로 렌더링
+ * @scene: prepare_scene이 끝난 장면
+ * @pixels: 결과 (width × height)
+ * @width: 결과 너비 (WIDTH 이하)
+ * @height: 결과 높이 (HEIGHT 이하)
+ *
+ * 카메라와 시야는 WIDTH × HEIGHT와 같고, 작은 이미지의 픽셀마다 그
+ * 픽셀이 덮는 화면 영역의 가운데로 광선 하나를 쏩니다. 광선 수가
+ * 픽셀 수와 같으므로 200 × 150은 전체 렌더링의 1/16입니다. 크기가
+ * WIDTH × HEIGHT이면 render_scene과 같은 이미지입니다.
+ */
+void	render_thumbnail(t_scene *scene, int *pixels, int width, int height)
+{
+	t_frame	f;
+	int		x;
+	int		y;
+
+	frame_begin(&f, scene, pixels);
+	y = -1;
+	while (++y < height)
+	{
+		x = -1;
+		while (++x < width)
+			pixels[y * width + x] = thumb_pixel(&f,
+					(x + 0.5) * WIDTH / width, (y + 0.5) * HEIGHT / height);
+	}
+	frame_end(&f);
+}
+
+/*
+ * box_average - 사각형 안 픽셀들의 평균 색
+ * @src: WIDTH × HEIGHT 이미지
+ * @r: [x0, y0, x1, y1) (비어 있지 않음)
+ *
+ * Return: 채널별로 반올림한 평균 (0xRRGGBB)
+ */
+static int	box_average(int *src, int *r)
+{
+	long	sum[3];
+	long	n;
+	int		x;
+	int		y;
+
+	sum[0] = 0;
+	sum[1] = 0;
+	sum[2] = 0;
+	y = r[1] - 1;
+	while (++y < r[3])
+	{
+		x = r[0] - 1;
+		while (++x < r[2])
+		{
+			sum[0] += (src[y * WIDTH + x] >> 16) & 0xFF;
+			sum[1] += (src[y * WIDTH + x] >> 8) & 0xFF;
+			sum[2] += src[y * WIDTH + x] & 0xFF;
+		}
+	}
+	n = (long)(r[2] - r[0]) * (r[3] - r[1]);
+	return ((((sum[0] + n / 2) / n) << 16) | (((sum[1] + n / 2) / n) << 8)
+		| ((sum[2] + n / 2) / n));
+}
+
+/*
+ * image_downscale - 렌더링한 이미지를 작은 크기로 줄이기
+ * @src: WIDTH × HEIGHT 이미지
+ * @dst: width × height 결과
+ * @width: 결과 너비 (WIDTH 이하)
+ * @height: 결과 높이 (HEIGHT 이하)
+ *
+ * 결과 픽셀마다 그 픽셀이 덮는 원본 픽셀들을 평균합니다 (상자 필터).
+ * render_thumbnail보다 느리지만 결과 픽셀마다 여러 샘플의 평균입니다.
+ * 크기가 같으면 그대로 복사한 것과 같습니다.
+ */
+void	image_downscale(int *src, int *dst, int width, int height)
+{
+	int	r[4];
+	int	x;
+	int	y;
+
+	y = -1;
+	while (++y < height)
+	{
+		r[1] = y * HEIGHT / height;
+		r[3] = (y + 1) * HEIGHT / height;
+		x = -1;
+		while (++x < width)
+		{
+			r[0] = x * WIDTH / width;
+			r[2] = (x + 1) * WIDTH / width;
+			dst[y * width + x] = box_average(src, r);
+		}
+	}
+}
@@ -0,0 +1,148 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   render_view.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "render.h"
+#include <sys/time.h>
+
+/*
+ * view_now - 프레임 시간을 재기 위한 현재 시각
+ *
+ * Return: 밀리초 단위 시각 (gettimeofday)
+ */
+double	view_now(void)
+{
+	struct timeval	tv;
+
+	gettimeofday(&tv, NULL);
+	return (tv.tv_sec * 1000.0 + tv.tv_usec / 1000.0);
+}
+
+/*
+ * view_measure - 지금 프레임으로 샘플당 렌더링 시간 갱신
+ * @p: 작업 스레드 묶음 (프레임이 끝났거나 pool_cancel 후)
+ *
+ * pool_render부터 지금까지의 시간을 창에 옮긴 타일의 샘플 수로
+ * 나눕니다. 취소된 프레임도 옮긴 타일이 있으면 잽니다 (키를 누르고
+ * 있으면 프레임이 끝나기 전에 다음 입력이 오므로). 앞의 값과 평균해
+ * 한 프레임의 흔들림을 줄입니다. 한 프레임은 한 번만 잽니다.
+ */
+void	view_measure(t_pool *p)
+{
+	double	ms;
+
+	if (p->started <= 0 || p->shown == 0)
+		return ;
+	ms = (view_now() - p->started) * p->scale * p->scale
+		/ ((double)p->shown * TILE_SIZE * TILE_SIZE);
+	if (p->sample_ms > 0)
+		ms = (ms + p->sample_ms) / 2;
+	p->sample_ms = ms;
+	p->started = 0;
+}
+
+/*
+ * view_scale - 한 프레임이 주어진 시간 안에 끝나는 내부 해상도
+ * @p: 작업 스레드 묶음
+ * @ms: 프레임 하나에 쓸 시간 (카메라 이동 중이면 VIEW_TARGET_MS)
+ *
+ * Return: 한 프레임이 ms 안에 끝나는 가장 작은 scale (VIEW_MAX_SCALE
+ *         이하), 샘플당 시간을 아직 모르면 VIEW_MAX_SCALE
+ */
+int	view_scale(t_pool *p, double ms)
+{
+	int	scale;
+
+	if (p->sample_ms <= 0)
+		return (VIEW_MAX_SCALE);
+	scale = 1;
+	while (scale < VIEW_MAX_SCALE && p->sample_ms * WIDTH * HEIGHT
+		/ (scale * scale) > ms)
+		scale *= 2;
+	return (scale);
+}
+
+/*
+ * view_key - 키 입력으로 지금 프레임을 취소하고 다시 렌더링
+ * @p: 작업 스레드 묶음
+ * @keycode: 눌린 키 (ESC 제외)
+ *
+ * WASD이면 카메라를 옮기고 view_scale의 낮은 해상도로, 다른 키이면
+ * 전체 해상도로 다시 렌더링합니다. 작업 스레드가 멈춘 뒤에 카메라를
+ * 옮기므로 렌더링 중인 타일은 앞 카메라를 끝까지 씁니다. 카메라를
+ * 옮기면 재투영 기록의 epoch를 바꾸어, 앞 카메라의 샘플은 가림 검사를
+ * 거쳐서만 다시 쓰게 합니다. G-버퍼도 앞 카메라의 것이 됩니다.
+ */
+void	view_key(t_pool *p, int keycode)
+{
+	pool_cancel(p);
+	view_measure(p);
+	p->scale = 1;
+	p->history.moving = 0;
+	p->relight = 0;
+	if (camera_move(p->frame.scene, keycode))
+	{
+		p->gbuf_valid = 0;
+		p->scale = view_scale(p, VIEW_TARGET_MS);
+		p->history.epoch++;
+		p->history.moving = 1;
+	}
+	pool_render(p);
+}
+
+/*
+ * view_refine - 프레임이 끝났을 때 해상도 올리기
+ * @p: 모든 타일을 창에 옮긴 작업 스레드 묶음
+ *
+ * 낮은 해상도 프레임이면 scale을 반으로 줄여 다시 렌더링합니다.
+ * 움직이는 중에 옮겨 온 샘플을 쓴 전체 해상도 프레임이면 같은
+ * 해상도로 다시 렌더링합니다. 카메라가 멈춘 것으로 보고 지금 카메라로
+ * 추적한 샘플만 다시 쓰므로, 완성된 전체 해상도 프레임은 처음부터
+ * 렌더링한 것과 같습니다.
+ * 그동안 입력이 없으면 VIEW_MAX_SCALE에서 시작해도 몇 프레임 안에
+ * 전체 해상도가 됩니다. 시간 예산이 있으면 반으로 줄이는 대신 남은
+ * 시간 안에 끝나는 가장 높은 해상도로 건너뛰고, 남은 시간이 없으면
+ * 다음 프레임을 시작하지 않고 지금 이미지로 끝냅니다.
+ *
+ * 전체 해상도 프레임이 끝나면 모든 픽셀의 G-버퍼가 지금 카메라의
+ * 교점이므로 광원만 바꿀 때 쓸 수 있습니다 (gbuf_valid). --aa이면
+ * 이어서 가장자리 픽셀만 다시 샘플링합니다 (pool_antialias).
+ *
+ * Return: 1 (전체 해상도 프레임이 끝났거나 예산이 다 됨, 저장할 것),
+ *         0 (더 높은 해상도나 안티앨리어싱 단계를 렌더링 중)
+ */
+int	view_refine(t_pool *p)
+{
+	double	ms;
+	int		scale;
+
+	view_measure(p);
+	p->complete = 1;
+	if (p->scale == 1 && !p->history.moving)
+	{
+		p->gbuf_valid = (p->gbuf != NULL);
+		return (p->frame.edges || !pool_antialias(p));
+	}
+	scale = p->scale / 2;
+	ms = p->deadline - view_now() - BUDGET_SLACK_MS;
+	if (p->deadline > 0 && ms <= 0)
+	{
+		p->deadline = 0;
+		return (1);
+	}
+	if (p->deadline > 0 && view_scale(p, ms) < scale)
+		scale = view_scale(p, ms);
+	if (scale > 0)
+		p->scale = scale;
+	p->history.moving = 0;
+	pool_render(p);
+	return (0);
+}
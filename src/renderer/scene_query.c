@@ -0,0 +1,102 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   scene_query.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+#include "accel.h"
+
+/*
+ * list_closest - 물체 목록을 차례로 검사해 가장 가까운 교점 찾기
+ * @scene: 장면 정보 (물체 목록)
+ * @ray: 검사할 광선
+ * @closest: t = -1, object = NULL로 초기화한 교점 정보 (갱신됨)
+ *
+ * 가속 구조가 없을 때(메모리 부족) 쓰는 기본 방법입니다.
+ * 배치는 그룹의 가속 구조가 필요하므로 이 경로에서는 건너뜁니다.
+ *
+ * 동작 과정:
+ * 1. 모든 물체를 순회
+ * 2. 물체 타입에 따라 적절한 교점 계산 함수 호출
+ *    - 구(Sphere): intersect_sphere
+ *    - 평면(Plane): intersect_plane
+ *    - 원기둥(Cylinder): intersect_cylinder
+ * 3. t > 0 (카메라 앞쪽)이고 현재까지의 최소값보다 작으면 갱신
+ * 4. 가장 가까운 교점 정보를 closest에 기록
+ */
+static void	list_closest(t_scene *scene, t_ray ray, t_hit *closest)
+{
+	t_object	*obj;
+	t_real		t;
+
+	obj = scene->objects;
+	while (obj)
+	{
+		if (obj->type == OBJ_SPHERE)
+			t = intersect_sphere(ray, (t_sphere *)obj->object);
+		else if (obj->type == OBJ_PLANE)
+			t = intersect_plane(ray, (t_plane *)obj->object);
+		else if (obj->type == OBJ_CYLINDER)
+			t = intersect_cylinder(ray, (t_cylinder *)obj->object);
+		else
+			t = -1;
+		if (t > 0 && (closest->t < 0 || t < closest->t))
+		{
+			closest->t = t;
+			closest->object = obj;
+		}
+		obj = obj->next;
+	}
+}
+
+/*
+ * find_closest_intersection - 광선과 가장 가까운 물체의 교점 찾기
+ * @scene: 장면 정보 (물체 목록, 가속 구조)
+ * @ray: 검사할 광선
+ *
+ * prepare_scene이 만든 가속 구조(BVH + 종류별 반복문)로 검사합니다.
+ * 가속 구조가 없으면 물체 목록을 차례로 검사합니다.
+ *
+ * Return: 교점 정보 (t, object, instance), 교점 없으면 t = -1
+ */
+t_hit	find_closest_intersection(t_scene *scene, t_ray ray)
+{
+	t_hit	closest;
+
+	closest.t = -1;
+	closest.object = NULL;
+	closest.instance = NULL;
+	if (scene->accel)
+		accel_closest(scene->accel, ray, &closest);
+	else
+		list_closest(scene, ray, &closest);
+	return (closest);
+}
+
+/*
+ * scene_occluded - 광선의 (0, tmax) 구간을 가리는 물체가 있는지 검사
+ * @scene: 장면 정보
+ * @ray: 검사할 광선 (그림자 광선)
+ * @tmax: 검사할 최대 거리
+ *
+ * 가장 가까운 교점은 필요 없으므로 가속 구조에서는 처음 찾은
+ * 교점에서 멈춥니다.
+ *
+ * Return: 1 (가려짐), 0 (가려지지 않음)
+ */
+int	scene_occluded(t_scene *scene, t_ray ray, t_real tmax)
+{
+	t_hit	hit;
+
+	if (scene->accel)
+		return (accel_occluded(scene->accel, ray, tmax));
+	hit = find_closest_intersection(scene, ray);
+	return (hit.object && hit.t < tmax);
+}
@@ -0,0 +1,153 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   trace.c                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+#include "vec3_inline.h"
+
+/*
+ * cylinder_normal - 원기둥 표면의 법선 계산
+ * @cy: 원기둥
+ * @point: 원기둥 표면 위의 교점
+ *
+ * 교점을 축 방향 성분 z와 축에 수직인 성분 radial로 나눕니다.
+ * - 뚜껑 평면(|z| = half_height)이 측면(|radial| = radius)보다 가까우면
+ *   뚜껑: 법선 = ±axis
+ * - 그 외에는 측면: 법선 = normalize(radial)
+ *
+ * Return: 단위 법선 벡터
+ */
+static t_vec3	cylinder_normal(t_cylinder *cy, t_vec3 point)
+{
+	t_vec3	rel;
+	t_vec3	radial;
+	t_real	z;
+
+	rel = v3_sub(point, cy->center);
+	z = v3_dot(rel, cy->axis);
+	radial = v3_sub(rel, v3_mul(cy->axis, z));
+	if (RT_FABS(cy->half_height - RT_FABS(z))
+		< RT_FABS(cy->radius - v3_length(radial)))
+	{
+		if (z < 0)
+			return (v3_mul(cy->axis, -1));
+		return (cy->axis);
+	}
+	return (v3_normalize(radial));
+}
+
+/*
+ * object_normal - 물체 표면 위의 점에서의 법선 벡터 계산
+ * @obj: 교점이 있는 물체
+ * @point: 물체 표면 위의 교점 (물체와 같은 좌표계)
+ *
+ * 법선 벡터는 표면에 수직인 벡터로, 조명 계산에 필수적입니다.
+ * 물체 타입에 따라 계산 방법이 다릅니다:
+ *
+ * 1. 구(Sphere):
+ *    - normal = normalize(hit_point - center)
+ *    - 구의 중심에서 표면의 점으로 향하는 벡터
+ *    - 항상 바깥쪽을 향함
+ *
+ * 2. 평면(Plane):
+ *    - normal = plane.normal
+ *    - 평면의 법선은 prepare_scene에서 이미 정규화되어 있음
+ *    - 평면의 모든 점에서 동일
+ *
+ * 3. 원기둥(Cylinder):
+ *    - cylinder_normal 참고 (측면과 뚜껑의 법선이 다름)
+ *
+ * Return: 단위 법선 벡터
+ */
+static t_vec3	object_normal(t_object *obj, t_vec3 point)
+{
+	t_sphere	*sp;
+
+	if (obj->type == OBJ_SPHERE)
+	{
+		sp = (t_sphere *)obj->object;
+		return (v3_normalize(v3_sub(point, sp->center)));
+	}
+	if (obj->type == OBJ_PLANE)
+		return (((t_plane *)obj->object)->normal);
+	if (obj->type == OBJ_CYLINDER)
+		return (cylinder_normal((t_cylinder *)obj->object, point));
+	return (v3_new(0, 1, 0));
+}
+
+/*
+ * calculate_normal - 교점에서의 법선 벡터 계산
+ * @hit: 교점 정보 (수정됨: normal 필드가 채워짐)
+ *
+ * 배치(instance) 안의 물체와 만났으면 교점을 그룹의 로컬 좌표로
+ * 옮겨 법선을 구한 뒤 세계 좌표로 돌립니다.
+ * 법선은 항상 단위 벡터(길이 1)로 정규화됩니다.
+ */
+static void	calculate_normal(t_hit *hit)
+{
+	t_vec3	local;
+
+	if (!hit->instance)
+	{
+		hit->normal = object_normal(hit->object, hit->point);
+		return ;
+	}
+	local = instance_point_to_local(hit->instance, hit->point);
+	hit->normal = instance_dir_to_world(hit->instance,
+			object_normal(hit->object, local));
+}
+
+/*
+ * shade_hit - 찾은 교점의 색상 계산
+ * @scene: 장면 정보
+ * @ray: 교점을 찾은 광선
+ * @hit: 교점 정보 (find_closest_intersection 또는 tile_closest의 결과,
+ *        point와 normal을 채움)
+ * @color: 계산된 색상 (출력, 0.0 ~ 1.0)
+ *
+ * 교점 위치 계산 → 법선 계산 → 조명 계산을 수행합니다.
+ * 교점이 없으면 color를 검은색으로 채웁니다.
+ *
+ * Return: 1 (물체와 만남), 0 (배경)
+ */
+int	shade_hit(t_scene *scene, t_ray ray, t_hit *hit, t_vec3 *color)
+{
+	if (!hit->object)
+	{
+		*color = v3_new(0, 0, 0);
+		return (0);
+	}
+	hit->point = v3_add(ray.origin, v3_mul(ray.direction, hit->t));
+	calculate_normal(hit);
+	*color = calculate_lighting(scene, *hit);
+	return (1);
+}
+
+/*
+ * trace_ray - 광선 하나를 추적하여 최종 색상 계산
+ * @scene: 장면 정보
+ * @ray: 추적할 광선
+ * @color: 계산된 색상 (출력, 0.0 ~ 1.0)
+ *
+ * 교점 찾기 → 교점 위치 계산 → 법선 계산 → 조명 계산의
+ * 전체 과정을 수행합니다. 차등 테스트(tests/diff)는 이 경로를,
+ * render_pixel은 교점 찾기만 타일 후보 목록으로 바꾼 같은 경로를
+ * 사용합니다.
+ *
+ * Return: 1 (물체와 만남), 0 (배경)
+ */
+int	trace_ray(t_scene *scene, t_ray ray, t_vec3 *color)
+{
+	t_hit	hit;
+
+	hit = find_closest_intersection(scene, ray);
+	return (shade_hit(scene, ray, &hit, color));
+}
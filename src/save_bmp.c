@@ -15,65 +15,93 @@
 #include <fcntl.h>
 #include <unistd.h>
 
-static void	init_bmp_header(t_bmp_header *header)
+static void	init_bmp_header(t_bmp_header *header, int row, int height)
 {
 	header->type = 0x4D42;
-	header->size = 54 + WIDTH * HEIGHT * 3;
+	header->size = 54 + row * height;
 	header->reserved1 = 0;
 	header->reserved2 = 0;
 	header->offset = 54;
 }
 
-static void	init_bmp_info(t_bmp_info *info)
+static void	init_bmp_info(t_bmp_info *info, int width, int height, int row)
 {
 	info->size = 40;
-	info->width = WIDTH;
-	info->height = HEIGHT;
+	info->width = width;
+	info->height = height;
 	info->planes = 1;
 	info->bit_count = 24;
 	info->compression = 0;
-	info->size_image = WIDTH * HEIGHT * 3;
+	info->size_image = row * height;
 	info->x_pixels_per_meter = 0;
 	info->y_pixels_per_meter = 0;
 	info->clr_used = 0;
 	info->clr_important = 0;
 }
 
-static void	write_pixel_row(int fd, t_mlx_data *data, int y)
+/*
+ * write_pixel_row - 한 줄을 BGR 바이트로 바꿔 한 번에 쓰기
+ * @fd: BMP 파일
+ * @pixels: 줄의 첫 픽셀
+ * @width: 줄의 픽셀 수 (WIDTH 이하)
+ * @row: 4의 배수로 맞춘 줄의 바이트 수
+ *
+ * Return: 1 (성공), 0 (쓰기 실패)
+ */
+static int	write_pixel_row(int fd, int *pixels, int width, int row)
 {
+	unsigned char	bytes[WIDTH * 3 + 3];
 	int				x;
-	unsigned char	pixel[3];
 
 	x = 0;
-	while (x < WIDTH)
+	while (x < width)
 	{
-		pixel[2] = (data->img_data[y * WIDTH + x] >> 16) & 0xFF;
-		pixel[1] = (data->img_data[y * WIDTH + x] >> 8) & 0xFF;
-		pixel[0] = data->img_data[y * WIDTH + x] & 0xFF;
-		write(fd, pixel, 3);
+		bytes[x * 3 + 2] = (pixels[x] >> 16) & 0xFF;
+		bytes[x * 3 + 1] = (pixels[x] >> 8) & 0xFF;
+		bytes[x * 3] = pixels[x] & 0xFF;
 		x++;
 	}
+	x *= 3;
+	while (x < row)
+		bytes[x++] = 0;
+	return (write(fd, bytes, row) == row);
 }
 
-void	save_to_bmp(t_mlx_data *data, char *filename)
+/*
+ * bmp_write - 크기가 정해진 이미지를 24비트 BMP로 저장
+ * @pixels: 0xRRGGBB 픽셀 (width × height, 위쪽 줄부터)
+ * @width: 너비 (1 이상 WIDTH 이하)
+ * @height: 높이
+ * @filename: 저장할 경로
+ *
+ * BMP는 아래쪽 줄부터 저장하고 줄마다 4바이트 경계까지 0을 채웁니다.
+ * 줄을 한 번에 쓰므로 write 호출은 줄 수만큼입니다.
+ *
+ * Return: 1 (성공), 0 (파일을 만들거나 쓸 수 없음)
+ */
+int	bmp_write(int *pixels, int width, int height, char *filename)
 {
 	int				fd;
 	t_bmp_header	header;
 	t_bmp_info		info;
-	int				y;
+	int				row;
+	int				ok;
 
 	fd = open(filename, O_WRONLY | O_CREAT | O_TRUNC, 0644);
 	if (fd < 0)
-		return ;
-	init_bmp_header(&header);
-	init_bmp_info(&info);
-	write(fd, &header, sizeof(t_bmp_header));
-	write(fd, &info, sizeof(t_bmp_info));
-	y = HEIGHT - 1;
-	while (y >= 0)
-	{
-		write_pixel_row(fd, data, y);
-		y--;
-	}
+		return (0);
+	row = (width * 3 + 3) / 4 * 4;
+	init_bmp_header(&header, row, height);
+	init_bmp_info(&info, width, height, row);
+	ok = (write(fd, &header, sizeof(t_bmp_header)) == sizeof(t_bmp_header));
+	ok = (ok && write(fd, &info, sizeof(t_bmp_info)) == sizeof(t_bmp_info));
+	while (ok && --height >= 0)
+		ok = write_pixel_row(fd, pixels + height * width, width, row);
 	close(fd);
+	return (ok);
+}
+
+void	save_to_bmp(t_mlx_data *data, char *filename)
+{
+	bmp_write(data->img_data, WIDTH, HEIGHT, filename);
 }
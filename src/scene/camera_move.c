@@ -0,0 +1,84 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   camera_move.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "accel.h"
+#include "vec3_inline.h"
+#include "libft.h"
+
+/*
+ * camera_step - 키 한 번에 카메라가 움직이는 거리
+ * @scene: prepare_scene이 끝난 장면
+ *
+ * 크기가 다른 장면도 비슷한 횟수로 가로지르도록, 유한한 물체를 모두
+ * 감싸는 상자(가속 구조의 bounds) 대각선에 비례하게 합니다.
+ *
+ * Return: 이동 거리 (유한한 물체가 없으면 1)
+ */
+static t_real	camera_step(t_scene *scene)
+{
+	t_aabb	box;
+
+	if (!scene->accel)
+		return (1);
+	box = scene->accel->bounds;
+	if (box.min.x > box.max.x)
+		return (1);
+	return (CAMERA_STEP_RATIO * v3_length(v3_sub(box.max, box.min)));
+}
+
+/*
+ * camera_move - WASD 키로 카메라 옮기기
+ * @scene: prepare_scene이 끝난 장면
+ * @keycode: 눌린 키
+ *
+ * W/S는 바라보는 방향으로 앞뒤, A/D는 화면 오른쪽 방향으로 좌우로
+ * 옮깁니다. 방향은 그대로이므로 prepare_scene이 만든 좌표계를 다시
+ * 계산하지 않아도 됩니다. 렌더링 중인 작업 스레드가 없을 때
+ * 불러야 합니다 (pool_cancel).
+ *
+ * Return: 1 (옮김), 0 (이동 키가 아님)
+ */
+int	camera_move(t_scene *scene, int keycode)
+{
+	t_camera	*cam;
+	t_real		step;
+
+	cam = &scene->camera;
+	step = camera_step(scene);
+	if (keycode == KEY_W)
+		cam->position = v3_add(cam->position, v3_mul(cam->forward, step));
+	else if (keycode == KEY_S)
+		cam->position = v3_sub(cam->position, v3_mul(cam->forward, step));
+	else if (keycode == KEY_D)
+		cam->position = v3_add(cam->position, v3_mul(cam->right, step));
+	else if (keycode == KEY_A)
+		cam->position = v3_sub(cam->position, v3_mul(cam->right, step));
+	else
+		return (0);
+	return (1);
+}
+
+/*
+ * camera_equal - 파일에 적은 카메라가 같은지
+ * @a: 카메라
+ * @b: 카메라
+ *
+ * 위치, 방향, 시야각만 비교합니다 (나머지는 prepare_scene이 계산).
+ *
+ * Return: 1 (같음), 0 (다름)
+ */
+int	camera_equal(t_camera *a, t_camera *b)
+{
+	return (!ft_memcmp(&a->position, &b->position, sizeof(t_vec3))
+		&& !ft_memcmp(&a->orientation, &b->orientation, sizeof(t_vec3))
+		&& a->fov == b->fov);
+}
@@ -0,0 +1,65 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   instance_xform.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+#include "vec3_inline.h"
+
+/*
+ * 배치 좌표 변환
+ *
+ * (u, axis, w)는 직교 좌표계이므로 세계 → 로컬 회전은 각 축과의
+ * 내적이고, 로컬 → 세계 회전은 각 축에 성분을 곱해 더한 값입니다.
+ * 배율은 균일하므로 방향 벡터는 회전만 하면 길이가 그대로이고,
+ * 로컬 거리 t에 scale을 곱하면 세계 거리가 됩니다.
+ */
+
+/*
+ * instance_point_to_local - 세계 좌표의 점을 그룹의 로컬 좌표로
+ * @inst: prepare_instance가 준비한 배치
+ * @p: 세계 좌표의 점
+ *
+ * Return: 로컬 좌표의 점
+ */
+t_vec3	instance_point_to_local(t_instance *inst, t_vec3 p)
+{
+	p = v3_sub(p, inst->position);
+	return (v3_mul(v3_new(v3_dot(p, inst->u), v3_dot(p, inst->axis),
+				v3_dot(p, inst->w)), inst->inv_scale));
+}
+
+/*
+ * instance_dir_to_local - 세계 좌표의 방향을 로컬 좌표로 (회전만)
+ * @inst: 배치
+ * @d: 세계 좌표의 방향
+ *
+ * Return: 같은 길이의 로컬 방향
+ */
+t_vec3	instance_dir_to_local(t_instance *inst, t_vec3 d)
+{
+	return (v3_new(v3_dot(d, inst->u), v3_dot(d, inst->axis),
+			v3_dot(d, inst->w)));
+}
+
+/*
+ * instance_dir_to_world - 로컬 좌표의 방향(법선)을 세계 좌표로
+ * @inst: 배치
+ * @d: 로컬 좌표의 방향
+ *
+ * 균일 배율과 회전뿐이므로 법선도 같은 방법으로 변환합니다.
+ *
+ * Return: 같은 길이의 세계 방향
+ */
+t_vec3	instance_dir_to_world(t_instance *inst, t_vec3 d)
+{
+	return (v3_add(v3_add(v3_mul(inst->u, d.x), v3_mul(inst->axis, d.y)),
+			v3_mul(inst->w, d.z)));
+}
@@ -0,0 +1,114 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   prepare_objects.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+#include "vec3.h"
+#include <math.h>
+
+/*
+ * prepare_sphere - 구의 불변값 계산
+ * @sp: 파싱된 구
+ *
+ * 교점 계산마다 필요한 반지름의 제곱을 미리 구해 둡니다.
+ */
+void	prepare_sphere(t_sphere *sp)
+{
+	sp->radius2 = sp->radius * sp->radius;
+}
+
+/*
+ * prepare_plane - 평면의 법선 정규화
+ * @pl: 파싱된 평면
+ *
+ * .rt 파일의 법선은 단위 벡터가 아닐 수 있습니다. 한 번 정규화해 두면
+ * 교점마다 법선을 다시 정규화할 필요가 없습니다.
+ */
+void	prepare_plane(t_plane *pl)
+{
+	pl->normal = vec3_normalize(pl->normal);
+}
+
+/*
+ * prepare_cylinder - 원기둥의 로컬 좌표계와 불변값 계산
+ * @cy: 파싱된 원기둥
+ *
+ * 1. 축(axis)을 정규화
+ * 2. 반지름, 반지름의 제곱, 높이의 절반 계산
+ * 3. 원기둥을 감싸는 구(중심은 원기둥의 중심)의 반지름의 제곱
+ *    bound2 = radius² + half_height² (빠른 배제 판정용)
+ * 4. 축에 수직인 두 단위 벡터 u, v를 만들어 (u, v, axis)를
+ *    원기둥의 로컬 좌표계로 사용 (직교 행렬이므로 세계 → 로컬 변환은
+ *    각 축과의 내적)
+ *    - 축과 거의 평행하지 않은 보조 벡터(x축 또는 y축)와의 외적으로
+ *      u를 구하고, v = axis × u
+ */
+void	prepare_cylinder(t_cylinder *cy)
+{
+	t_vec3	helper;
+
+	cy->axis = vec3_normalize(cy->axis);
+	cy->radius = cy->diameter / 2.0;
+	cy->radius2 = cy->radius * cy->radius;
+	cy->half_height = cy->height / 2.0;
+	cy->bound2 = cy->radius2 + cy->half_height * cy->half_height;
+	if (fabs(cy->axis.x) < 0.9)
+		helper = vec3_new(1, 0, 0);
+	else
+		helper = vec3_new(0, 1, 0);
+	cy->u = vec3_normalize(vec3_cross(cy->axis, helper));
+	cy->v = vec3_cross(cy->axis, cy->u);
+}
+
+/*
+ * prepare_instance - 배치의 로컬 좌표계 계산
+ * @inst: 파싱된 배치
+ *
+ * 그룹의 로컬 x, y, z축이 세계 좌표계의 u, axis, w가 되도록
+ * 오른손 좌표계 (u, axis, w)를 만듭니다. 보조 벡터는 axis와 거의
+ * 평행하지 않은 z축 또는 x축이며, axis = (0,1,0)이면 회전이 없습니다.
+ * 길이가 0인 축은 (0,1,0), 0 이하의 배율은 1로 봅니다.
+ */
+void	prepare_instance(t_instance *inst)
+{
+	t_vec3	helper;
+
+	if (vec3_length(inst->axis) == 0)
+		inst->axis = vec3_new(0, 1, 0);
+	inst->axis = vec3_normalize(inst->axis);
+	if (!(inst->scale > 0))
+		inst->scale = 1;
+	inst->inv_scale = 1.0 / inst->scale;
+	if (fabs(inst->axis.z) < 0.9)
+		helper = vec3_new(0, 0, 1);
+	else
+		helper = vec3_new(1, 0, 0);
+	inst->u = vec3_normalize(vec3_cross(inst->axis, helper));
+	inst->w = vec3_cross(inst->u, inst->axis);
+}
+
+/*
+ * prepare_object - 물체 종류에 맞는 준비 함수 호출
+ * @obj: 파싱된 물체
+ *
+ * 물체 하나를 새로 만들거나 수정한 뒤에도 이 함수를 호출해야 합니다.
+ */
+void	prepare_object(t_object *obj)
+{
+	if (obj->type == OBJ_SPHERE)
+		prepare_sphere((t_sphere *)obj->object);
+	else if (obj->type == OBJ_PLANE)
+		prepare_plane((t_plane *)obj->object);
+	else if (obj->type == OBJ_CYLINDER)
+		prepare_cylinder((t_cylinder *)obj->object);
+	else if (obj->type == OBJ_INSTANCE)
+		prepare_instance((t_instance *)obj->object);
+}
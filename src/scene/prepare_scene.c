@@ -0,0 +1,127 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   prepare_scene.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+#include "vec3.h"
+#include <math.h>
+
+/*
+ * prepare_camera - 카메라의 로컬 좌표계 생성
+ * @camera: 파싱된 카메라
+ *
+ * 카메라의 방향(orientation)으로부터 세 개의 직교하는 단위 벡터를 생성합니다.
+ * 이 벡터들은 카메라만의 로컬 좌표계를 형성합니다.
+ *
+ * 동작 과정:
+ * 1. forward: 카메라가 바라보는 방향 (정규화된 orientation)
+ * 2. world_up: 세계 좌표계의 위 방향
+ *    - forward가 거의 수직(y > 0.999)이면 x축 사용
+ *    - 그 외에는 y축(0,1,0) 사용
+ * 3. right: world_up과 forward의 외적으로 계산 (카메라의 오른쪽)
+ * 4. up: forward와 right의 외적으로 계산 (카메라의 위쪽)
+ * 5. tan(fov / 2): 시야각에 따른 가상 스크린의 크기
+ *
+ * 외적의 순서가 중요합니다: 오른손 좌표계를 유지하기 위해
+ * right = world_up × forward
+ * up = forward × right
+ *
+ * 픽셀마다 같은 값이 필요하므로 장면을 준비할 때 한 번만 계산합니다.
+ */
+void	prepare_camera(t_camera *camera)
+{
+	t_vec3	world_up;
+
+	camera->forward = vec3_normalize(camera->orientation);
+	if (fabs(camera->forward.y) > 0.999)
+		world_up = vec3_new(1, 0, 0);
+	else
+		world_up = vec3_new(0, 1, 0);
+	camera->right = vec3_normalize(vec3_cross(world_up, camera->forward));
+	camera->up = vec3_normalize(vec3_cross(camera->forward, camera->right));
+	camera->tan_half_fov = RT_TAN(camera->fov * M_PI / 180.0 / 2);
+}
+
+/*
+ * prepare_lights - 광원과 환경광의 실제 세기 계산
+ * @scene: 장면
+ *
+ * 조명 계산에서 픽셀마다 곱하던 색상 × 밝기 비율을
+ * 광원의 radiance와 환경광의 term으로 미리 구해 둡니다.
+ * 광원만 바꾼 뒤에는 이 함수만 다시 부르면 됩니다 (scene_reload_lights).
+ */
+void	prepare_lights(t_scene *scene)
+{
+	t_light	*light;
+
+	if (scene->ambient_light)
+		scene->ambient_light->term = vec3_mul(scene->ambient_light->color,
+				scene->ambient_light->ratio);
+	light = scene->lights;
+	while (light)
+	{
+		light->radiance = vec3_mul(light->color, light->ratio);
+		light = light->next;
+	}
+}
+
+/*
+ * prepare_list - 물체 목록의 모든 물체 준비
+ * @obj: 목록의 첫 물체
+ */
+static void	prepare_list(t_object *obj)
+{
+	while (obj)
+	{
+		prepare_object(obj);
+		obj = obj->next;
+	}
+}
+
+/*
+ * prepare_shapes - 그룹과 장면의 모든 물체를 한 번 준비
+ * @scene: 파싱된 장면
+ *
+ * 법선과 축의 정규화는 두 번 하면 비트 단위로 같지 않을 수 있으므로
+ * 물체마다 정확히 한 번만 불러야 합니다. --watch는 다시 읽은 장면을
+ * 비교하기 전에 이 함수로 준비하고 (scene_diff), 바꿀 때는 가속
+ * 구조만 다시 만듭니다 (prepare_accel).
+ */
+void	prepare_shapes(t_scene *scene)
+{
+	t_group	*group;
+
+	group = scene->groups;
+	while (group)
+	{
+		prepare_list(group->objects);
+		group = group->next;
+	}
+	prepare_list(scene->objects);
+}
+
+/*
+ * prepare_scene - 파싱된 장면의 불변값 계산
+ * @scene: parse_scene이 만든 장면
+ *
+ * 렌더링 중 교점이나 픽셀마다 반복되던 계산(방향 정규화, 반지름의
+ * 제곱, 광원 세기, 카메라 좌표계 등)을 장면을 읽은 직후 한 번만
+ * 수행합니다. parse_scene 다음, 렌더링 전에 반드시 호출해야 합니다.
+ * 마지막으로 그룹과 장면의 가속 구조를 scene->accel_mode에 따라
+ * 만듭니다 (prepare_accel).
+ */
+void	prepare_scene(t_scene *scene)
+{
+	prepare_camera(&scene->camera);
+	prepare_lights(scene);
+	prepare_shapes(scene);
+	prepare_accel(scene);
+}
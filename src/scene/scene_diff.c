@@ -0,0 +1,160 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   scene_diff.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+#include "libft.h"
+
+/*
+ * object_diff - 같은 자리의 두 물체 비교
+ * @a: 지금 장면의 물체
+ * @b: 다시 읽은 장면의 물체 (prepare_object 후)
+ *
+ * 도형의 모든 필드 (prepare_object가 계산한 값 포함)와 색을 비교합니다.
+ * 배치는 그룹 포인터 대신 그룹 이름을 비교합니다. 종류나 그룹이 다르면
+ * 물체 하나만 바꿀 수 없으므로 구성이 바뀐 것으로 봅니다.
+ *
+ * Return: 0 (같음), DIFF_OBJECTS (값이 다름), DIFF_SHAPE (종류가 다름)
+ */
+int	object_diff(t_object *a, t_object *b)
+{
+	t_instance	*ia;
+	t_instance	*ib;
+	size_t		size;
+
+	if (a->type != b->type)
+		return (DIFF_SHAPE);
+	ia = a->object;
+	ib = b->object;
+	size = sizeof(t_sphere);
+	if (a->type == OBJ_PLANE)
+		size = sizeof(t_plane);
+	else if (a->type == OBJ_CYLINDER)
+		size = sizeof(t_cylinder);
+	if (a->type == OBJ_INSTANCE
+		&& ft_strcmp(ia->group->name, ib->group->name))
+		return (DIFF_SHAPE);
+	if (a->type == OBJ_INSTANCE)
+		size = 0;
+	if (ft_memcmp(a->object, b->object, size)
+		|| ft_memcmp(&a->color, &b->color, sizeof(t_vec3))
+		|| (a->type == OBJ_INSTANCE && (ia->scale != ib->scale
+				|| ft_memcmp(&ia->position, &ib->position, sizeof(t_vec3))
+				|| ft_memcmp(&ia->axis, &ib->axis, sizeof(t_vec3)))))
+		return (DIFF_OBJECTS);
+	return (0);
+}
+
+/*
+ * list_diff - 두 물체 목록을 같은 순서의 물체끼리 비교
+ * @a: 지금 장면의 목록
+ * @b: 다시 읽은 장면의 목록 (prepare_shapes 후)
+ *
+ * 물체에는 이름이 없으므로 목록에서의 순서를 물체의 정체로 봅니다.
+ *
+ * Return: 0, DIFF_OBJECTS (값만 다름), DIFF_SHAPE (개수나 종류가 다름)
+ */
+static int	list_diff(t_object *a, t_object *b)
+{
+	int	diff;
+
+	diff = 0;
+	while (a && b && !(diff & DIFF_SHAPE))
+	{
+		diff |= object_diff(a, b);
+		a = a->next;
+		b = b->next;
+	}
+	if (a || b || (diff & DIFF_SHAPE))
+		return (DIFF_SHAPE);
+	return (diff);
+}
+
+/*
+ * groups_diff - 두 그룹 목록 비교
+ * @a: 지금 장면의 그룹
+ * @b: 다시 읽은 장면의 그룹
+ *
+ * 그룹의 물체가 바뀌면 그룹의 가속 구조와 그 그룹의 모든 배치가
+ * 바뀌므로 어떤 차이든 구성이 바뀐 것으로 봅니다.
+ *
+ * Return: 0 (같음), DIFF_SHAPE (다름)
+ */
+static int	groups_diff(t_group *a, t_group *b)
+{
+	while (a && b && !ft_strcmp(a->name, b->name)
+		&& !list_diff(a->objects, b->objects))
+	{
+		a = a->next;
+		b = b->next;
+	}
+	if (a || b)
+		return (DIFF_SHAPE);
+	return (0);
+}
+
+/*
+ * lights_diff - 광원과 환경광 비교
+ * @scene: 지금 장면
+ * @fresh: 다시 읽은 장면
+ *
+ * Return: 0 (같음), DIFF_LIGHTS (다름)
+ */
+static int	lights_diff(t_scene *scene, t_scene *fresh)
+{
+	t_light		*a;
+	t_light		*b;
+	t_ambient	*am;
+	t_ambient	*bm;
+
+	am = scene->ambient_light;
+	bm = fresh->ambient_light;
+	if (!am != !bm || (am && (am->ratio != bm->ratio
+				|| ft_memcmp(&am->color, &bm->color, sizeof(t_vec3)))))
+		return (DIFF_LIGHTS);
+	a = scene->lights;
+	b = fresh->lights;
+	while (a && b && a->ratio == b->ratio
+		&& !ft_memcmp(&a->position, &b->position, sizeof(t_vec3))
+		&& !ft_memcmp(&a->color, &b->color, sizeof(t_vec3)))
+	{
+		a = a->next;
+		b = b->next;
+	}
+	if (a || b)
+		return (DIFF_LIGHTS);
+	return (0);
+}
+
+/*
+ * scene_diff - 다시 읽은 장면이 지금 장면과 어디가 다른지
+ * @scene: 렌더링 중인 장면 (prepare_scene 후)
+ * @fresh: 같은 파일을 다시 parse_scene으로 읽은 장면
+ *
+ * 비교하기 전에 fresh의 모든 물체를 한 번 준비하지만 (prepare_shapes)
+ * 가속 구조는 만들지 않습니다. 바뀐 부분만 scene_adopt_objects,
+ * scene_adopt로 지금 장면에 옮기며, 둘 다 물체를 다시 준비하지
+ * 않습니다.
+ *
+ * Return: DIFF_*의 비트 합 (같으면 0)
+ */
+int	scene_diff(t_scene *scene, t_scene *fresh)
+{
+	int	diff;
+
+	prepare_shapes(fresh);
+	diff = groups_diff(scene->groups, fresh->groups);
+	if (!diff)
+		diff = list_diff(scene->objects, fresh->objects);
+	if (!camera_equal(&scene->camera, &fresh->camera))
+		diff |= DIFF_CAMERA;
+	return (diff | lights_diff(scene, fresh));
+}
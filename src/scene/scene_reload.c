@@ -0,0 +1,127 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   scene_reload.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+
+/*
+ * swap_ptr - 두 포인터 바꾸기
+ * @a: 포인터의 주소
+ * @b: 포인터의 주소
+ */
+static void	swap_ptr(void **a, void **b)
+{
+	void	*tmp;
+
+	tmp = *a;
+	*a = *b;
+	*b = tmp;
+}
+
+/*
+ * scene_reload_lights - 장면 파일에서 광원과 환경광만 다시 읽기
+ * @scene: 렌더링 중인 장면 (작업 스레드가 멈춘 뒤)
+ * @path: 장면 파일 경로
+ *
+ * 파일 전체를 새 장면으로 파싱한 뒤 A, L 줄로 만든 환경광과 광원만
+ * 지금 장면의 것과 바꾸고, 나머지(카메라, 물체)는 버립니다. 카메라와
+ * 물체는 그대로이므로 가속 구조와 G-버퍼를 계속 쓸 수 있습니다.
+ * 파일을 읽을 수 없으면 지금 광원을 그대로 둡니다.
+ *
+ * Return: 1 (성공), 0 (파일을 읽을 수 없음)
+ */
+int	scene_reload_lights(t_scene *scene, char *path)
+{
+	t_scene		*fresh;
+
+	fresh = parse_scene(path);
+	if (!fresh)
+		return (0);
+	scene_adopt(scene, fresh, DIFF_LIGHTS);
+	return (1);
+}
+
+/*
+ * scene_adopt_objects - 값이 바뀐 물체만 다시 읽은 장면의 값으로 바꾸기
+ * @scene: 렌더링 중인 장면 (작업 스레드가 멈춘 뒤)
+ * @fresh: scene_diff가 DIFF_SHAPE 없이 비교한 장면
+ * @moved: 바꾼 scene의 물체들 (출력, 물체 수만큼)
+ * @old: moved와 같은 순서로, 바꾸기 전 도형을 넘겨받은 fresh의 물체들
+ *       (출력)
+ *
+ * t_object는 그대로 두고 도형 데이터만 맞바꾸므로 가속 구조, 재투영
+ * 기록, G-버퍼가 가리키는 물체는 계속 유효합니다. old로 옛 자리를 알 수
+ * 있고, 가속 구조는 moved로 고칩니다 (scene_refit, 도형은 이미 준비됨).
+ *
+ * Return: 바꾼 물체 수
+ */
+int	scene_adopt_objects(t_scene *scene, t_scene *fresh,
+		t_object **moved, t_object **old)
+{
+	t_object	*a;
+	t_object	*b;
+	int			n;
+
+	n = 0;
+	a = scene->objects;
+	b = fresh->objects;
+	while (a && b)
+	{
+		if (object_diff(a, b))
+		{
+			if (a->type == OBJ_INSTANCE)
+				((t_instance *)b->object)->group
+					= ((t_instance *)a->object)->group;
+			swap_ptr(&a->object, &b->object);
+			a->color = b->color;
+			moved[n] = a;
+			old[n++] = b;
+		}
+		a = a->next;
+		b = b->next;
+	}
+	return (n);
+}
+
+/*
+ * scene_adopt - 다시 읽은 장면의 바뀐 부분을 지금 장면으로 옮기고 해제
+ * @scene: 렌더링 중인 장면 (작업 스레드가 멈춘 뒤)
+ * @fresh: 다시 읽은 장면 (해제됨)
+ * @diff: 옮길 부분 (scene_diff)
+ *
+ * 광원과 카메라는 통째로 옮깁니다. DIFF_SHAPE이면 물체와 그룹 목록을
+ * 바꾸고 가속 구조만 다시 만듭니다 (prepare_accel). 물체는 scene_diff가
+ * 이미 준비했으므로 다시 준비하지 않습니다. 이때 옛 물체는
+ * 해제되므로 옛 물체를 가리키는 기록을 먼저 버려야 합니다. 값만 바뀐
+ * 물체는 이 함수 전에 scene_adopt_objects로 옮깁니다.
+ */
+void	scene_adopt(t_scene *scene, t_scene *fresh, int diff)
+{
+	if (diff & DIFF_LIGHTS)
+	{
+		swap_ptr((void **)&scene->lights, (void **)&fresh->lights);
+		swap_ptr((void **)&scene->ambient_light,
+			(void **)&fresh->ambient_light);
+		prepare_lights(scene);
+	}
+	if (diff & DIFF_CAMERA)
+	{
+		scene->camera = fresh->camera;
+		prepare_camera(&scene->camera);
+	}
+	if (diff & DIFF_SHAPE)
+	{
+		swap_ptr((void **)&scene->objects, (void **)&fresh->objects);
+		swap_ptr((void **)&scene->groups, (void **)&fresh->groups);
+		prepare_accel(scene);
+	}
+	free_scene(fresh);
+}
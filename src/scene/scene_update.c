@@ -0,0 +1,81 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   scene_update.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+#include "accel.h"
+
+/*
+ * prepare_accel - 그룹과 장면의 가속 구조를 (다시) 만들기
+ * @scene: 물체를 준비한 장면 (prepare_shapes 후)
+ *
+ * 배치의 경계 상자는 그룹의 가속 구조로 계산하므로 그룹마다 먼저
+ * 만들고, 장면의 가속 구조를 scene->accel_mode에 따라 만듭니다.
+ * 그룹마다 한 번만 만들고 그 그룹의 모든 배치가 공유합니다. 이전
+ * 가속 구조는 해제됩니다. 물체는 다시 준비하지 않습니다.
+ */
+void	prepare_accel(t_scene *scene)
+{
+	t_group	*group;
+
+	group = scene->groups;
+	while (group)
+	{
+		free_accel(group->accel);
+		group->accel = build_accel(group->objects, scene->accel_mode);
+		group = group->next;
+	}
+	free_accel(scene->accel);
+	scene->accel = build_accel(scene->objects, scene->accel_mode);
+}
+
+/*
+ * scene_refit - 이미 준비한 물체들을 옮긴 뒤 가속 구조 고치기
+ * @scene: prepare_scene을 마친 장면
+ * @moved: 옮긴 물체들 (scene->objects의 원소, 그룹 안의 물체는 제외)
+ * @n: moved의 개수
+ *
+ * BVH의 상자를 고칩니다 (accel_refit). 품질이 scene->refit_limit보다
+ * 나빠졌거나 고칠 수 없는 구조 (격자, BVH=wide)이면 장면의 가속
+ * 구조를 새로 만듭니다. --watch는 준비된 도형을 옮겨 오므로
+ * scene_update 대신 이 함수를 부릅니다.
+ *
+ * Return: 1 (고쳐서 그대로 씀), 0 (새로 만듦)
+ */
+int	scene_refit(t_scene *scene, t_object **moved, int n)
+{
+	if (scene->accel
+		&& accel_refit(scene->accel, moved, n, scene->refit_limit))
+		return (1);
+	free_accel(scene->accel);
+	scene->accel = build_accel(scene->objects, scene->accel_mode);
+	return (0);
+}
+
+/*
+ * scene_update - 몇몇 물체를 옮긴 뒤 가속 구조 고치기
+ * @scene: prepare_scene을 마친 장면
+ * @moved: 값을 고친 물체들 (scene->objects의 원소, 그룹 안의 물체는 제외)
+ * @n: moved의 개수
+ *
+ * 옮긴 물체만 다시 준비한 뒤 scene_refit으로 가속 구조를 고칩니다.
+ *
+ * Return: 1 (고쳐서 그대로 씀), 0 (새로 만듦)
+ */
+int	scene_update(t_scene *scene, t_object **moved, int n)
+{
+	int	i;
+
+	i = 0;
+	while (i < n)
+		prepare_object(moved[i++]);
+	return (scene_refit(scene, moved, n));
+}
@@ -0,0 +1,85 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   scene_watch.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+#include <sys/stat.h>
+#include <unistd.h>
+
+int	watch_open(t_watch *w);
+int	watch_events(t_watch *w);
+
+/*
+ * watch_start - 장면 파일이 저장되는지 감시 시작
+ * @path: 장면 파일 경로 (감시하는 동안 유효해야 함)
+ * @camera: 그 파일에서 읽은 카메라 (pool_watch가 WASD로 옮긴 카메라를
+ *          지킬 때 비교)
+ *
+ * 편집기는 파일을 제자리에 쓰거나, 임시 파일에 쓴 뒤 이름을 바꿔
+ * 저장합니다. 이름을 바꾸면 파일 자체를 감시하던 것은 사라지므로
+ * 파일이 든 디렉터리를 감시하고 이름으로 거릅니다 (watch_open).
+ * inotify가 없으면 watch_poll이 수정 시각을 직접 비교합니다.
+ *
+ * Return: 감시 상태, 메모리 부족이면 NULL
+ */
+t_watch	*watch_start(char *path, t_camera *camera)
+{
+	t_watch		*w;
+	struct stat	st;
+	char		*slash;
+
+	w = malloc(sizeof(t_watch));
+	if (!w)
+		return (NULL);
+	w->path = path;
+	w->name = path;
+	slash = path;
+	while (*slash)
+		if (*slash++ == '/')
+			w->name = slash;
+	w->mtime = 0;
+	if (stat(path, &st) == 0)
+		w->mtime = st.st_mtime;
+	w->camera = *camera;
+	w->fd = watch_open(w);
+	return (w);
+}
+
+/*
+ * watch_poll - 지난번 이후 장면 파일이 저장되었는지
+ * @w: watch_start로 시작한 감시
+ *
+ * loop_hook이 매 프레임 부르므로 기다리지 않고 바로 돌아옵니다.
+ *
+ * Return: 1 (저장됨), 0 (그대로)
+ */
+int	watch_poll(t_watch *w)
+{
+	struct stat	st;
+
+	if (w->fd >= 0)
+		return (watch_events(w));
+	if (stat(w->path, &st) != 0 || st.st_mtime == w->mtime)
+		return (0);
+	w->mtime = st.st_mtime;
+	return (1);
+}
+
+/*
+ * watch_stop - 감시 끝내기
+ * @w: watch_start로 시작한 감시 (NULL 허용)
+ */
+void	watch_stop(t_watch *w)
+{
+	if (w && w->fd >= 0)
+		close(w->fd);
+	free(w);
+}
@@ -0,0 +1,102 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   watch_notify.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+#include "libft.h"
+#ifdef __linux__
+# include <sys/inotify.h>
+# include <unistd.h>
+
+/*
+ * watch_open - 장면 파일이 든 디렉터리를 inotify로 감시
+ * @w: path와 name을 채운 감시
+ *
+ * 쓰고 닫힌 파일 (IN_CLOSE_WRITE)과 이름이 바뀌어 들어온 파일
+ * (IN_MOVED_TO)만 알립니다. 쓰는 중인 파일은 알리지 않으므로 반쯤 쓴
+ * 파일을 읽지 않습니다.
+ *
+ * Return: 읽기에서 기다리지 않는 inotify 기술자, 실패하면 -1
+ */
+int	watch_open(t_watch *w)
+{
+	char	*dir;
+	int		fd;
+
+	dir = ft_strdup(".");
+	if (w->name != w->path)
+	{
+		free(dir);
+		dir = ft_strdup(w->path);
+		if (dir)
+			dir[w->name - w->path] = '\0';
+	}
+	fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+	if (fd >= 0 && (!dir
+			|| inotify_add_watch(fd, dir, IN_CLOSE_WRITE | IN_MOVED_TO) < 0))
+	{
+		close(fd);
+		fd = -1;
+	}
+	free(dir);
+	return (fd);
+}
+
+/*
+ * watch_events - 쌓인 inotify 이벤트를 모두 읽고 장면 파일의 것이 있는지
+ * @w: watch_open이 성공한 감시
+ *
+ * 한 번 저장에도 이벤트가 여럿 올 수 있으므로 모두 읽어 한 번으로
+ * 합칩니다. 같은 디렉터리의 다른 파일 이벤트는 버립니다.
+ *
+ * Return: 1 (장면 파일이 저장됨), 0 (그대로)
+ */
+int	watch_events(t_watch *w)
+{
+	long					buf[1024];
+	struct inotify_event	*ev;
+	ssize_t					len;
+	ssize_t					off;
+	int						changed;
+
+	changed = 0;
+	len = read(w->fd, buf, sizeof(buf));
+	while (len > 0)
+	{
+		off = 0;
+		while (off < len)
+		{
+			ev = (struct inotify_event *)((char *)buf + off);
+			if (ev->len > 0 && !ft_strcmp(ev->name, w->name))
+				changed = 1;
+			off += sizeof(struct inotify_event) + ev->len;
+		}
+		len = read(w->fd, buf, sizeof(buf));
+	}
+	return (changed);
+}
+#else
+
+/*
+ * inotify가 없는 시스템: watch_poll이 수정 시각을 비교합니다.
+ */
+int	watch_open(t_watch *w)
+{
+	(void)w;
+	return (-1);
+}
+
+int	watch_events(t_watch *w)
+{
+	(void)w;
+	return (0);
+}
+#endif
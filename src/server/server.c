@@ -0,0 +1,178 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   server.c                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "server.h"
+#include "libft.h"
+#include <stdio.h>
+#include <unistd.h>
+#include <signal.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+
+/*
+ * server_open - 소켓을 만들어 연결을 기다리기 시작
+ * @path: UNIX 도메인 소켓 경로 (그 경로에 파일이 있으면 실패)
+ *
+ * Return: 서버, 실패 시 NULL
+ */
+t_server	*server_open(char *path)
+{
+	t_server			*s;
+	struct sockaddr_un	addr;
+
+	if (ft_strlen(path) >= sizeof(addr.sun_path))
+		return (NULL);
+	s = calloc(1, sizeof(t_server));
+	if (!s)
+		return (NULL);
+	s->listen_fd = socket(AF_UNIX, SOCK_STREAM, 0);
+	s->pixels = malloc(sizeof(int) * WIDTH * HEIGHT);
+	s->thumb = malloc(sizeof(int) * WIDTH * HEIGHT);
+	memset(&addr, 0, sizeof(addr));
+	addr.sun_family = AF_UNIX;
+	ft_memcpy(addr.sun_path, path, ft_strlen(path) + 1);
+	if (!s->pixels || !s->thumb || s->listen_fd < 0
+		|| bind(s->listen_fd, (struct sockaddr *)&addr, sizeof(addr)) < 0
+		|| listen(s->listen_fd, SERVER_MAX_CLIENTS) < 0)
+	{
+		server_close(s);
+		return (NULL);
+	}
+	s->path = path;
+	return (s);
+}
+
+/*
+ * server_close - 연결과 남은 작업, 캐시를 정리하고 소켓 파일 지우기
+ * @s: 서버 (path는 bind와 listen이 성공했을 때만 채워짐)
+ */
+void	server_close(t_server *s)
+{
+	t_job	job;
+
+	while (s->n_clients > 0)
+	{
+		close(s->clients[--s->n_clients].fd);
+		free(s->clients[s->n_clients].buf);
+	}
+	while (job_pop(s, &job))
+	{
+		job_reply(&job, "error", "server stopped");
+		job_free(&job);
+	}
+	if (s->listen_fd >= 0)
+		close(s->listen_fd);
+	if (s->path)
+		unlink(s->path);
+	cache_clear(s);
+	free(s->pixels);
+	free(s->thumb);
+	free(s);
+}
+
+/*
+ * poll_events - 새 연결을 받고 도착한 요청을 읽기
+ * @s: 서버
+ * @wait_ms: 아무 일도 없을 때 기다릴 시간 (-1이면 무한히)
+ *
+ * 연결은 뒤에서부터 읽습니다. 요청을 다 받은 연결은 마지막 연결과
+ * 자리를 바꿔 빠지므로, 아직 읽지 않은 앞쪽 번호는 그대로입니다.
+ */
+static void	poll_events(t_server *s, int wait_ms)
+{
+	struct pollfd	fds[SERVER_MAX_CLIENTS + 1];
+	int				n;
+
+	fds[0].fd = s->listen_fd;
+	fds[0].events = POLLIN;
+	n = 0;
+	while (n < s->n_clients)
+	{
+		fds[n + 1].fd = s->clients[n].fd;
+		fds[n + 1].events = POLLIN;
+		n++;
+	}
+	if (poll(fds, n + 1, wait_ms) <= 0)
+		return ;
+	while (--n >= 0)
+		if (fds[n + 1].revents)
+			client_read(s, n);
+	if (fds[0].revents & POLLIN)
+		client_accept(s);
+}
+
+/*
+ * server_step - 들어온 요청을 모두 받고 작업 하나를 렌더링
+ * @s: 서버
+ * @wait_ms: 대기열이 비었을 때 요청을 기다릴 시간 (-1이면 무한히)
+ *
+ * 작업마다 먼저 요청을 받으므로, 렌더링하는 동안 들어온 더 높은
+ * 우선순위의 작업이 다음 차례가 됩니다.
+ *
+ * Return: 1 (작업 하나를 처리함), 0 (대기열이 비어 있음)
+ */
+int	server_step(t_server *s, int wait_ms)
+{
+	t_job	job;
+
+	if (s->n_jobs > 0)
+		wait_ms = 0;
+	poll_events(s, wait_ms);
+	if (!job_pop(s, &job))
+		return (0);
+	if (job.quit)
+	{
+		s->quit = 1;
+		job_reply(&job, "ok", "shutdown");
+	}
+	else
+		job_run(s, &job);
+	job_free(&job);
+	return (1);
+}
+
+/*
+ * server_run - 렌더 서버 실행 (miniRT --serve <소켓>)
+ * @path: UNIX 도메인 소켓 경로
+ *
+ * 지난 실행이 남긴 소켓 파일은 지우고 (소켓이 아닌 파일은 그대로),
+ * shutdown 요청을 받을 때까지 작업을 처리합니다. 그 전에 받은 작업을
+ * 마저 끝낸 뒤 돌아갑니다. 창은 만들지 않습니다.
+ *
+ * Return: 0 (정상 종료), 1 (소켓을 열 수 없음)
+ */
+int	server_run(char *path)
+{
+	t_server	*s;
+	struct stat	st;
+	long		done;
+
+	signal(SIGPIPE, SIG_IGN);
+	if (stat(path, &st) == 0 && S_ISSOCK(st.st_mode))
+		unlink(path);
+	s = server_open(path);
+	if (!s)
+	{
+		printf("Error\nCannot listen on %s\n", path);
+		return (1);
+	}
+	printf("Serving on %s\n", path);
+	fflush(stdout);
+	done = 0;
+	while (!s->quit || s->n_jobs > 0)
+		done += server_step(s, -1);
+	printf("Served %ld jobs (%ld cache hits)\n", done, s->hits);
+	server_close(s);
+	return (0);
+}
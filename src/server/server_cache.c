@@ -0,0 +1,132 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   server_cache.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "server.h"
+#include "libft.h"
+#include <sys/stat.h>
+
+/*
+ * cache_match - 남겨 둔 장면이 작업과 같은 장면인지
+ * @c: 캐시 칸
+ * @job: 작업
+ *
+ * 장면 파일은 경로로, 요청에 담은 장면은 내용으로 비교합니다. 파일이
+ * 바뀌었는지는 cache_get이 봅니다.
+ *
+ * Return: 1 (같은 장면), 0 (다른 장면이거나 빈 칸)
+ */
+static int	cache_match(t_cached *c, t_job *job)
+{
+	if (!c->key)
+		return (0);
+	if (job->scene)
+		return (c->is_path && !ft_strcmp(c->key, job->scene));
+	return (!c->is_path && !ft_strcmp(c->key, job->text));
+}
+
+/*
+ * cache_load - 장면을 읽어 캐시 칸에 넣기
+ * @slot: 비울 캐시 칸
+ * @job: 작업 (요청에 담은 장면이면 job->text를 파싱하며 바꿈)
+ * @st: 장면 파일의 stat (파일이 아니면 무시)
+ * @tick: 칸의 used
+ *
+ * 파싱 후 prepare_scene으로 가속 구조까지 만들어 두므로, 같은 장면의
+ * 다음 작업은 바로 렌더링합니다.
+ *
+ * Return: 준비된 장면, 읽을 수 없으면 NULL
+ */
+static t_scene	*cache_load(t_cached *slot, t_job *job, struct stat *st,
+	long tick)
+{
+	free_scene(slot->scene);
+	free(slot->key);
+	slot->is_path = (job->scene != NULL);
+	if (job->scene)
+		slot->key = ft_strdup(job->scene);
+	else
+		slot->key = ft_strdup(job->text);
+	if (job->scene)
+		slot->scene = parse_scene(job->scene);
+	else
+		slot->scene = parse_scene_buffer(job->text, job->text_len);
+	slot->mtime = st->st_mtime;
+	slot->size = st->st_size;
+	slot->used = tick;
+	if (slot->scene)
+		prepare_scene(slot->scene);
+	if (!slot->scene || !slot->key)
+	{
+		free(slot->key);
+		slot->key = NULL;
+		slot->used = 0;
+	}
+	return (slot->scene);
+}
+
+/*
+ * cache_get - 작업의 장면을 캐시에서 찾거나 읽기
+ * @s: 서버
+ * @job: 작업
+ *
+ * 장면 파일은 수정 시각이나 크기가 바뀌었으면 같은 칸에 다시 읽습니다.
+ * 없는 장면은 가장 오래 쓰지 않은 칸(LRU)을 비우고 읽습니다. 돌려준
+ * 장면은 다음 cache_get까지만 유효합니다.
+ *
+ * Return: 준비된 장면, 읽을 수 없으면 NULL
+ */
+t_scene	*cache_get(t_server *s, t_job *job)
+{
+	t_cached	*slot;
+	struct stat	st;
+	int			i;
+
+	st.st_mtime = 0;
+	st.st_size = 0;
+	if (job->scene && stat(job->scene, &st) < 0)
+		return (NULL);
+	slot = &s->cache[0];
+	i = -1;
+	while (++i < SERVER_CACHE && !cache_match(&s->cache[i], job))
+		if (s->cache[i].used < slot->used)
+			slot = &s->cache[i];
+	s->tick++;
+	if (i == SERVER_CACHE)
+		return (cache_load(slot, job, &st, s->tick));
+	slot = &s->cache[i];
+	if (job->scene && (slot->mtime != st.st_mtime
+			|| slot->size != st.st_size))
+		return (cache_load(slot, job, &st, s->tick));
+	slot->used = s->tick;
+	s->hits++;
+	return (slot->scene);
+}
+
+/*
+ * cache_clear - 남겨 둔 장면을 모두 해제
+ * @s: 서버
+ */
+void	cache_clear(t_server *s)
+{
+	int	i;
+
+	i = 0;
+	while (i < SERVER_CACHE)
+	{
+		free_scene(s->cache[i].scene);
+		free(s->cache[i].key);
+		s->cache[i].scene = NULL;
+		s->cache[i].key = NULL;
+		s->cache[i].used = 0;
+		i++;
+	}
+}
@@ -0,0 +1,142 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   server_client.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "server.h"
+#include "libft.h"
+#include <stdio.h>
+#include <unistd.h>
+#include <sys/socket.h>
+
+#define CLIENT_CHUNK 65536
+
+/*
+ * client_accept - 새 연결을 요청을 받는 중인 연결 목록에 넣기
+ * @s: 서버 (listen_fd가 읽을 수 있을 때 부름)
+ *
+ * 목록이 가득 차면 답을 보내고 바로 닫습니다.
+ */
+void	client_accept(t_server *s)
+{
+	t_client	*c;
+	int			fd;
+
+	fd = accept(s->listen_fd, NULL, NULL);
+	if (fd < 0)
+		return ;
+	if (s->n_clients >= SERVER_MAX_CLIENTS)
+	{
+		dprintf(fd, "error too many connections\n");
+		close(fd);
+		return ;
+	}
+	c = &s->clients[s->n_clients++];
+	c->fd = fd;
+	c->buf = NULL;
+	c->len = 0;
+	c->cap = 0;
+}
+
+/*
+ * client_drop - 연결을 목록에서 빼기
+ * @s: 서버
+ * @i: 연결 번호 (빈자리는 마지막 연결로 채움)
+ * @close_fd: 1이면 연결을 닫음, 0이면 작업이 연결을 가져감
+ */
+static void	client_drop(t_server *s, int i, int close_fd)
+{
+	if (close_fd)
+		close(s->clients[i].fd);
+	free(s->clients[i].buf);
+	s->clients[i] = s->clients[--s->n_clients];
+}
+
+/*
+ * client_submit - 다 받은 요청을 작업으로 바꿔 대기열에 넣기
+ * @s: 서버
+ * @i: 연결 번호 (목록에서 빠짐)
+ *
+ * 요청이 잘못되었거나 대기열이 가득 차면 바로 error로 답합니다.
+ */
+static void	client_submit(t_server *s, int i)
+{
+	t_job	job;
+	char	*err;
+
+	job.fd = s->clients[i].fd;
+	err = job_parse(s->clients[i].buf, &job);
+	if (!err && !job_push(s, &job))
+		err = "queue full or out of memory";
+	if (err)
+	{
+		job_reply(&job, "error", err);
+		job_free(&job);
+	}
+	client_drop(s, i, 0);
+}
+
+/*
+ * client_grow - 한 번 더 읽을 자리가 없으면 버퍼를 두 배로 늘리기
+ * @c: 연결
+ *
+ * Return: 1 (자리가 있음), 0 (메모리 부족이거나 SERVER_MAX_REQUEST 초과)
+ */
+static int	client_grow(t_client *c)
+{
+	char	*grown;
+
+	if (c->len + CLIENT_CHUNK + 1 <= c->cap)
+		return (1);
+	if (c->len >= SERVER_MAX_REQUEST)
+		return (0);
+	c->cap = c->len * 2 + CLIENT_CHUNK + 1;
+	grown = malloc(c->cap);
+	if (grown && c->len > 0)
+		ft_memcpy(grown, c->buf, c->len);
+	free(c->buf);
+	c->buf = grown;
+	return (grown != NULL);
+}
+
+/*
+ * client_read - 연결에서 읽은 만큼 요청에 붙이기
+ * @s: 서버 (연결이 읽을 수 있을 때 부름)
+ * @i: 연결 번호
+ *
+ * 빈 줄을 받거나 클라이언트가 쓰기를 닫으면 요청이 끝납니다. 빈 줄은
+ * 새로 읽은 부분과 그 앞 한 글자에서만 찾으므로 큰 요청도 한 번씩만
+ * 훑습니다.
+ */
+void	client_read(t_server *s, int i)
+{
+	t_client	*c;
+	ssize_t		n;
+	size_t		from;
+
+	c = &s->clients[i];
+	n = -1;
+	if (client_grow(c))
+		n = read(c->fd, c->buf + c->len, CLIENT_CHUNK);
+	else
+		dprintf(c->fd, "error request too large\n");
+	if (n < 0 || (n == 0 && c->len == 0))
+	{
+		client_drop(s, i, 1);
+		return ;
+	}
+	from = c->len;
+	if (from > 0)
+		from--;
+	c->len += n;
+	c->buf[c->len] = '\0';
+	if (n == 0 || c->buf[0] == '\n' || strstr(c->buf + from, "\n\n"))
+		client_submit(s, i);
+}
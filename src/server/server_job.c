@@ -0,0 +1,154 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   server_job.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "server.h"
+#include "libft.h"
+
+/*
+ * has_key - 요청 줄이 key로 시작하는지
+ * @line: 요청 줄
+ * @key: 키와 뒤의 공백 ("scene " 등)
+ *
+ * Return: 1 (key로 시작함), 0 (아님)
+ */
+static int	has_key(char *line, char *key)
+{
+	while (*key && *line == *key)
+	{
+		line++;
+		key++;
+	}
+	return (*key == '\0');
+}
+
+/*
+ * append_text - 요청에 담은 장면 줄을 text 끝에 붙이기
+ * @job: 작업
+ * @line: "> " 뒤의 장면 줄
+ *
+ * 용량이 모자라면 두 배로 늘리므로 큰 장면도 선형 시간에 모입니다.
+ *
+ * Return: NULL (성공), 실패 이유
+ */
+static char	*append_text(t_job *job, char *line)
+{
+	size_t	len;
+	char	*grown;
+
+	len = ft_strlen(line);
+	if (job->text_len + len + 2 > job->text_cap)
+	{
+		job->text_cap = (job->text_len + len + 2) * 2;
+		grown = malloc(job->text_cap);
+		if (grown && job->text_len > 0)
+			ft_memcpy(grown, job->text, job->text_len);
+		free(job->text);
+		job->text = grown;
+		if (!grown)
+			return ("out of memory");
+	}
+	ft_memcpy(job->text + job->text_len, line, len);
+	job->text_len += len + 1;
+	job->text[job->text_len - 1] = '\n';
+	job->text[job->text_len] = '\0';
+	return (NULL);
+}
+
+/*
+ * job_line - 요청 한 줄을 작업에 적용 (형식은 server.h)
+ * @job: 작업
+ * @line: 요청 줄
+ *
+ * Return: NULL (성공), 실패 이유
+ */
+static char	*job_line(t_job *job, char *line)
+{
+	char	*end;
+
+	if (has_key(line, "> "))
+		return (append_text(job, line + 2));
+	if (has_key(line, "scene ") && !job->scene)
+		job->scene = ft_strdup(line + 6);
+	else if (has_key(line, "camera ") && !job->camera)
+		job->camera = ft_strdup(line);
+	else if (has_key(line, "output ") && !job->output)
+		job->output = ft_strdup(line + 7);
+	else if (has_key(line, "size "))
+	{
+		job->width = strtol(line + 5, &end, 10);
+		job->height = atoi(end);
+	}
+	else if (has_key(line, "priority "))
+		job->priority = atoi(line + 9);
+	else if (!ft_strcmp(line, "aa"))
+		job->aa = 1;
+	else if (!ft_strcmp(line, "shutdown"))
+		job->quit = 1;
+	else
+		return ("unknown or repeated request line");
+	return (NULL);
+}
+
+/*
+ * job_init - 요청을 읽기 전의 기본값 (전체 해상도, 우선순위 0)
+ * @job: 작업 (fd는 그대로 둠)
+ */
+static void	job_init(t_job *job)
+{
+	job->priority = 0;
+	job->seq = 0;
+	job->scene = NULL;
+	job->text = NULL;
+	job->text_len = 0;
+	job->text_cap = 0;
+	job->camera = NULL;
+	job->output = NULL;
+	job->width = WIDTH;
+	job->height = HEIGHT;
+	job->aa = 0;
+	job->quit = 0;
+}
+
+/*
+ * job_parse - 빈 줄 앞까지의 요청을 작업으로 바꾸기
+ * @request: NULL로 끝나는 요청 (개행 문자를 '\0'으로 바꿈)
+ * @job: 결과 (실패해도 job_free로 해제할 수 있음)
+ *
+ * 장면은 scene이나 > 줄 중 하나로만 줄 수 있고, size는 렌더링
+ * 해상도(WIDTH × HEIGHT)보다 클 수 없습니다.
+ *
+ * Return: NULL (성공), 실패 이유 (답의 error 뒤에 보냄)
+ */
+char	*job_parse(char *request, t_job *job)
+{
+	char	*err;
+	size_t	len;
+
+	job_init(job);
+	err = NULL;
+	while (!err && *request && *request != '\n')
+	{
+		len = 0;
+		while (request[len] && request[len] != '\n')
+			len++;
+		if (request[len])
+			request[len++] = '\0';
+		err = job_line(job, request);
+		request += len;
+	}
+	if (!err && !job->quit && !job->scene == !job->text)
+		err = "need either a scene line or > lines";
+	if (!err && (job->width < 1 || job->width > WIDTH
+			|| job->height < 1 || job->height > HEIGHT))
+		err = "size out of range";
+	return (err);
+}
@@ -0,0 +1,113 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   server_queue.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "server.h"
+#include <stdio.h>
+#include <unistd.h>
+
+/*
+ * job_output - 저장할 경로가 없으면 SERVER_SHM_DIR에 하나 만들기
+ * @job: 받은 순서를 매긴 작업
+ *
+ * Return: 1 (경로가 있음), 0 (메모리 부족)
+ */
+static int	job_output(t_job *job)
+{
+	if (job->output)
+		return (1);
+	job->output = malloc(64 + sizeof(SERVER_SHM_DIR));
+	if (job->output)
+		snprintf(job->output, 64 + sizeof(SERVER_SHM_DIR),
+			SERVER_SHM_DIR "/miniRT-%d-%ld.bmp", (int)getpid(), job->seq);
+	return (job->output != NULL);
+}
+
+/*
+ * job_push - 작업을 대기열에 넣기
+ * @s: 서버
+ * @job: job_parse가 채운 작업 (복사해 넣고, 받은 순서와 저장할 경로를
+ *       매김)
+ *
+ * Return: 1 (성공), 0 (대기열이 가득 찼거나 메모리 부족)
+ */
+int	job_push(t_server *s, t_job *job)
+{
+	if (s->n_jobs >= SERVER_MAX_JOBS)
+		return (0);
+	job->seq = s->seq++;
+	if (!job_output(job))
+		return (0);
+	s->jobs[s->n_jobs++] = *job;
+	return (1);
+}
+
+/*
+ * job_pop - 다음에 렌더링할 작업 꺼내기
+ * @s: 서버
+ * @job: 꺼낸 작업 (출력)
+ *
+ * 우선순위가 가장 높은 작업을, 같으면 먼저 받은 작업을 꺼냅니다.
+ * 대기열은 SERVER_MAX_JOBS개 이하이므로 한 번 훑는 것으로 충분하고,
+ * 빈자리는 마지막 작업으로 채웁니다 (순서는 seq가 기억함).
+ *
+ * Return: 1 (꺼냄), 0 (대기열이 비어 있음)
+ */
+int	job_pop(t_server *s, t_job *job)
+{
+	t_job	*best;
+	int		i;
+
+	if (s->n_jobs == 0)
+		return (0);
+	best = &s->jobs[0];
+	i = 0;
+	while (++i < s->n_jobs)
+	{
+		if (s->jobs[i].priority > best->priority
+			|| (s->jobs[i].priority == best->priority
+				&& s->jobs[i].seq < best->seq))
+			best = &s->jobs[i];
+	}
+	*job = *best;
+	*best = s->jobs[--s->n_jobs];
+	return (1);
+}
+
+/*
+ * job_reply - 답 한 줄을 보내고 연결 닫기
+ * @job: 작업
+ * @status: "ok" 또는 "error"
+ * @text: 저장한 경로 또는 실패 이유
+ *
+ * 클라이언트가 먼저 끊었으면 보내지 못한 답은 버립니다 (SIGPIPE는
+ * server_run이 무시하도록 설정함).
+ */
+void	job_reply(t_job *job, char *status, char *text)
+{
+	if (job->fd < 0)
+		return ;
+	dprintf(job->fd, "%s %s\n", status, text);
+	close(job->fd);
+	job->fd = -1;
+}
+
+/*
+ * job_free - 작업이 가진 문자열 해제 (연결은 job_reply가 닫음)
+ * @job: 작업
+ */
+void	job_free(t_job *job)
+{
+	free(job->scene);
+	free(job->text);
+	free(job->camera);
+	free(job->output);
+}
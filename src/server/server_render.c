@@ -0,0 +1,96 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   server_render.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "server.h"
+#include "render.h"
+#include "libft.h"
+#include <stdio.h>
+
+/*
+ * set_camera - 요청의 camera 줄로 카메라 바꾸기
+ * @scene: 장면
+ * @line: "camera <위치> <방향> <fov>" (C 줄과 같은 인자)
+ */
+static void	set_camera(t_scene *scene, char *line)
+{
+	char	**parts;
+	int		i;
+
+	parts = ft_split(line, ' ');
+	if (parts)
+		parse_camera(parts, scene);
+	i = 0;
+	while (parts && parts[i])
+		free(parts[i++]);
+	free(parts);
+	prepare_camera(&scene->camera);
+}
+
+/*
+ * render_job - 작업의 카메라와 크기로 렌더링
+ * @s: 서버 (결과는 s->thumb)
+ * @scene: 캐시의 장면 (끝나면 카메라를 되돌림)
+ * @job: 작업
+ *
+ * 작은 크기는 그 크기로 바로 렌더링합니다 (render_thumbnail). aa이면
+ * WIDTH × HEIGHT로 가장자리까지 안티앨리어싱한 뒤 줄이므로, 줄인
+ * 픽셀마다 여러 샘플의 평균이 됩니다.
+ */
+static void	render_job(t_server *s, t_scene *scene, t_job *job)
+{
+	t_camera	saved;
+	t_mlx_data	data;
+
+	saved = scene->camera;
+	if (job->camera)
+		set_camera(scene, job->camera);
+	scene->antialias = job->aa;
+	data.img_data = s->pixels;
+	if (job->aa)
+	{
+		render_scene(scene, &data);
+		image_downscale(s->pixels, s->thumb, job->width, job->height);
+	}
+	else
+		render_thumbnail(scene, s->thumb, job->width, job->height);
+	scene->camera = saved;
+}
+
+/*
+ * job_run - 작업 하나를 렌더링해 저장하고 답하기
+ * @s: 서버
+ * @job: job_pop으로 꺼낸 작업
+ *
+ * 장면은 캐시에서 가져오므로, 같은 장면의 두 번째 작업부터는 파싱과
+ * 가속 구조 빌드 없이 렌더링만 합니다.
+ */
+void	job_run(t_server *s, t_job *job)
+{
+	t_scene		*scene;
+	double		start;
+
+	start = view_now();
+	scene = cache_get(s, job);
+	if (scene)
+		render_job(s, scene, job);
+	if (!scene)
+		job_reply(job, "error", "cannot read scene");
+	else if (!bmp_write(s->thumb, job->width, job->height, job->output))
+		job_reply(job, "error", "cannot write output");
+	else
+	{
+		printf("Job %ld: %s %dx%d in %.1f ms (%ld cache hits)\n",
+			job->seq, job->output, job->width, job->height,
+			view_now() - start, s->hits);
+		job_reply(job, "ok", job->output);
+	}
+}
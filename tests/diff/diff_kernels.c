@@ -0,0 +1,158 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   diff_kernels.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "difftest.h"
+#include "vec3.h"
+#include <math.h>
+
+/*
+ * diff_record - 기준 결과와 최적화 결과 한 쌍을 통계에 반영
+ * @st: 누적 통계
+ * @t_ref: 기준 구현의 교점 거리 (없으면 음수)
+ * @t_opt: 최적화 구현의 교점 거리 (없으면 음수)
+ *
+ * 한쪽만 교점을 찾으면 불일치로 셉니다.
+ * 둘 다 찾으면 상대 오차 |Δt| / max(1, t)의 최댓값을 갱신합니다.
+ */
+void	diff_record(t_diff_stats *st, double t_ref, double t_opt)
+{
+	double	dt;
+
+	st->rays++;
+	if ((t_ref > 0) != (t_opt > 0))
+		st->disagree++;
+	else if (t_ref > 0)
+	{
+		dt = fabs(t_ref - t_opt) / fmax(1.0, t_ref);
+		if (dt > st->max_dt)
+			st->max_dt = dt;
+	}
+}
+
+/*
+ * diff_random_ray - 목표 근처를 향하거나 임의 방향인 광선 생성
+ * @state: 난수 상태
+ * @target: 물체의 중심 (광선의 절반은 이 근처를 겨냥)
+ * @spread: 겨냥 지점이 흩어지는 범위
+ *
+ * 완전히 임의의 방향만 쓰면 대부분 빗나가므로,
+ * 절반은 물체 주변을 겨냥해 교점과 스침(grazing) 사례를 충분히 만듭니다.
+ */
+t_ray	diff_random_ray(unsigned long long *state, t_vec3 target,
+	double spread)
+{
+	t_ray	ray;
+	t_vec3	aim;
+
+	ray.origin = rng_point(state, 40.0);
+	if (rng_next(state) & 1)
+	{
+		aim = vec3_add(target, rng_point(state, spread));
+		ray.direction = vec3_normalize(vec3_sub(aim, ray.origin));
+	}
+	else
+		ray.direction = rng_unit(state);
+	return (ray);
+}
+
+/*
+ * diff_sphere - intersect_sphere를 기준 구현과 비교
+ * @opts: 광선 수, 시드
+ * @st: 결과 통계 (출력)
+ */
+void	diff_sphere(t_diff_opts *opts, t_diff_stats *st)
+{
+	unsigned long long	state;
+	t_sphere			sp;
+	t_ray				ray;
+	long				i;
+
+	state = opts->seed ^ 0x5350ULL;
+	i = 0;
+	while (i < opts->rays)
+	{
+		sp.center = rng_point(&state, 20.0);
+		sp.radius = rng_range(&state, 0.5, 10.0);
+		prepare_sphere(&sp);
+		ray = diff_random_ray(&state, sp.center, sp.radius * 1.2);
+		diff_record(st, ref_intersect_sphere(rray(ray), &sp),
+			intersect_sphere(ray, &sp));
+		i++;
+	}
+}
+
+/*
+ * diff_plane - intersect_plane을 기준 구현과 비교
+ * @opts: 광선 수, 시드
+ * @st: 결과 통계 (출력)
+ *
+ * 법선은 정규화하지 않은 임의 길이로 만들어 기준 구현에는 파서가
+ * 받은 그대로, 최적화 구현에는 prepare_plane을 거쳐 넘기므로
+ * 준비 단계까지 함께 검사합니다.
+ */
+void	diff_plane(t_diff_opts *opts, t_diff_stats *st)
+{
+	unsigned long long	state;
+	t_plane				pl;
+	t_plane				raw;
+	t_ray				ray;
+	long				i;
+
+	state = opts->seed ^ 0x504CULL;
+	i = 0;
+	while (i < opts->rays)
+	{
+		pl.point = rng_point(&state, 20.0);
+		pl.normal = vec3_mul(rng_unit(&state), rng_range(&state, 0.5, 2.0));
+		ray = diff_random_ray(&state, pl.point, 20.0);
+		raw = pl;
+		prepare_plane(&pl);
+		diff_record(st, ref_intersect_plane(rray(ray), &raw),
+			intersect_plane(ray, &pl));
+		i++;
+	}
+}
+
+/*
+ * diff_cylinder - intersect_cylinder를 기준 구현과 비교
+ * @opts: 광선 수, 시드
+ * @st: 결과 통계 (출력)
+ *
+ * 축은 정규화하지 않은 임의 길이로 만들어, 기준 구현에는 파서가
+ * 받은 그대로, 최적화 구현에는 prepare_cylinder를 거쳐 넘깁니다.
+ * 광선의 절반은 원기둥 주변을 겨냥해 측면, 뚜껑, 모서리 근처를
+ * 고르게 지나도록 합니다.
+ */
+void	diff_cylinder(t_diff_opts *opts, t_diff_stats *st)
+{
+	unsigned long long	state;
+	t_cylinder			cy;
+	t_cylinder			raw;
+	t_ray				ray;
+	long				i;
+
+	state = opts->seed ^ 0x4359ULL;
+	i = 0;
+	while (i < opts->rays)
+	{
+		cy.center = rng_point(&state, 20.0);
+		cy.axis = vec3_mul(rng_unit(&state), rng_range(&state, 0.5, 2.0));
+		cy.diameter = rng_range(&state, 1.0, 10.0);
+		cy.height = rng_range(&state, 1.0, 20.0);
+		raw = cy;
+		prepare_cylinder(&cy);
+		ray = diff_random_ray(&state, cy.center, cy.half_height * 1.2);
+		diff_record(st, ref_intersect_cylinder(rray(ray), &raw),
+			intersect_cylinder(ray, &cy));
+		i++;
+	}
+}
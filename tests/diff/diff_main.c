@@ -0,0 +1,130 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   diff_main.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "difftest.h"
+#include <string.h>
+
+/*
+ * parse_diff_args - 차등 테스트 옵션 해석
+ * @argc: 인자 개수
+ * @argv: 인자 배열
+ * @opts: 해석 결과 (출력)
+ *
+ * 사용법: ./miniRT_difftest [--rays N] [--seed S] [--max-rate R]
+ *                           [--t-tol T] [--color-tol C]
+ *
+ * Return: 1 (성공), 0 (잘못된 인자)
+ */
+static int	parse_diff_args(int argc, char **argv, t_diff_opts *opts)
+{
+	int	i;
+
+	opts->rays = DIFF_DEFAULT_RAYS;
+	opts->seed = DIFF_DEFAULT_SEED;
+	opts->max_rate = 1e-4;
+	opts->t_tol = DIFF_T_TOL;
+	opts->color_tol = 1.0 / 255.0;
+	i = 1;
+	while (i + 1 < argc)
+	{
+		if (!strcmp(argv[i], "--rays"))
+			opts->rays = atol(argv[i + 1]);
+		else if (!strcmp(argv[i], "--seed"))
+			opts->seed = strtoull(argv[i + 1], NULL, 10);
+		else if (!strcmp(argv[i], "--max-rate"))
+			opts->max_rate = atof(argv[i + 1]);
+		else if (!strcmp(argv[i], "--t-tol"))
+			opts->t_tol = atof(argv[i + 1]);
+		else if (!strcmp(argv[i], "--color-tol"))
+			opts->color_tol = atof(argv[i + 1]);
+		else
+			return (0);
+		i += 2;
+	}
+	return (i == argc && opts->rays > 0);
+}
+
+/*
+ * report - 한 커널의 결과를 출력하고 허용치를 넘었는지 판정
+ * @opts: 허용치
+ * @st: 커널의 누적 통계
+ *
+ * Return: 1 (통과), 0 (실패)
+ */
+static int	report(t_diff_opts *opts, t_diff_stats *st)
+{
+	double	rate;
+	int		ok;
+
+	rate = 0;
+	if (st->rays > 0)
+		rate = (double)st->disagree / st->rays;
+	ok = rate <= opts->max_rate && st->max_dt <= opts->t_tol;
+	printf("%-10s %10ld %10ld %12.3e %12.3e %12.3e  ", st->name,
+		st->rays, st->disagree, rate, st->max_dt, st->max_dcolor);
+	if (ok)
+		printf("ok\n");
+	else
+		printf("FAIL\n");
+	return (ok);
+}
+
+/*
+ * run_kernels - 모든 커널의 차등 테스트 실행
+ * @opts: 광선 수, 시드, 허용치
+ * @st: 커널별 통계 (DIFF_KERNELS개, 출력)
+ */
+static void	run_kernels(t_diff_opts *opts, t_diff_stats *st)
+{
+	memset(st, 0, sizeof(*st) * DIFF_KERNELS);
+	st[0].name = "sphere";
+	st[1].name = "plane";
+	st[2].name = "cylinder";
+	st[3].name = "shading";
+	diff_sphere(opts, &st[0]);
+	diff_plane(opts, &st[1]);
+	diff_cylinder(opts, &st[2]);
+	diff_shading(opts, &st[3]);
+}
+
+/*
+ * main - 최적화된 경로와 기준 구현을 임의의 광선으로 비교
+ * @argc: 인자 개수
+ * @argv: 인자 배열
+ *
+ * 같은 시드로 실행하면 항상 같은 광선과 장면이 만들어지므로,
+ * 실패한 경우 같은 명령으로 그대로 재현할 수 있습니다.
+ *
+ * Return: 0 (모든 커널 통과), 1 (불일치 또는 잘못된 인자)
+ */
+int	main(int argc, char **argv)
+{
+	t_diff_opts		opts;
+	t_diff_stats	st[DIFF_KERNELS];
+	int				ok;
+	int				i;
+
+	if (!parse_diff_args(argc, argv, &opts))
+	{
+		printf("Error\nUsage: %s [--rays N] [--seed S] [--max-rate R] "
+			"[--t-tol T] [--color-tol C]\n", argv[0]);
+		return (1);
+	}
+	run_kernels(&opts, st);
+	printf("seed=%llu\n%-10s %10s %10s %12s %12s %12s\n", opts.seed,
+		"kernel", "rays", "disagree", "rate", "max_dt", "max_dcolor");
+	ok = 1;
+	i = 0;
+	while (i < DIFF_KERNELS)
+		ok &= report(&opts, &st[i++]);
+	return (!ok);
+}
@@ -0,0 +1,109 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   diff_ref.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "difftest.h"
+#include <math.h>
+
+/*
+ * 이 파일의 함수들은 src/renderer의 최초 구현을 그대로 옮긴 것입니다.
+ * 최적화된 경로가 바뀌더라도 이 파일은 수정하지 않습니다.
+ * 모든 계산은 빌드 설정과 무관하게 double로 수행합니다.
+ */
+
+static double	ref_solve_quadratic(double abc[3])
+{
+	double	discriminant;
+	double	t1;
+	double	t2;
+
+	discriminant = abc[1] * abc[1] - 4 * abc[0] * abc[2];
+	if (discriminant < 0)
+		return (-1.0);
+	t1 = (-abc[1] - sqrt(discriminant)) / (2.0 * abc[0]);
+	t2 = (-abc[1] + sqrt(discriminant)) / (2.0 * abc[0]);
+	if (t1 > 0 && (t2 < 0 || t1 < t2))
+		return (t1);
+	if (t2 > 0)
+		return (t2);
+	return (-1.0);
+}
+
+double	ref_intersect_sphere(t_rray ray, t_sphere *sphere)
+{
+	t_rvec	oc;
+	t_rvec	dir;
+	double	radius;
+	double	abc[3];
+
+	oc = rv_sub(ray.origin, rv(sphere->center));
+	dir = ray.direction;
+	radius = sphere->radius;
+	abc[0] = rv_dot(dir, dir);
+	abc[1] = 2.0 * rv_dot(oc, dir);
+	abc[2] = rv_dot(oc, oc) - radius * radius;
+	return (ref_solve_quadratic(abc));
+}
+
+double	ref_intersect_plane(t_rray ray, t_plane *plane)
+{
+	double	denom;
+	double	t;
+	t_rvec	normal;
+
+	normal = rv(plane->normal);
+	denom = rv_dot(ray.direction, normal);
+	if (fabs(denom) > 1e-6)
+	{
+		t = rv_dot(rv_sub(rv(plane->point), ray.origin), normal) / denom;
+		if (t > 1e-6)
+			return (t);
+	}
+	return (-1.0);
+}
+
+/*
+ * ref_closest - 물체 목록을 순서대로 전부 검사하는 기준 교점 탐색
+ * @scene: 장면 (파싱된 물체 연결 리스트만 사용)
+ * @ray: 검사할 광선
+ * @t: 가장 가까운 교점까지의 거리 (출력, 없으면 -1)
+ *
+ * 원기둥은 diff_ref_cylinder.c의 기준 구현을 사용합니다.
+ *
+ * Return: 가장 가까운 물체, 없으면 NULL
+ */
+t_object	*ref_closest(t_scene *scene, t_rray ray, double *t)
+{
+	t_object	*obj;
+	t_object	*closest;
+	double		cur;
+
+	closest = NULL;
+	*t = -1;
+	obj = scene->objects;
+	while (obj)
+	{
+		cur = -1;
+		if (obj->type == OBJ_SPHERE)
+			cur = ref_intersect_sphere(ray, (t_sphere *)obj->object);
+		else if (obj->type == OBJ_PLANE)
+			cur = ref_intersect_plane(ray, (t_plane *)obj->object);
+		else if (obj->type == OBJ_CYLINDER)
+			cur = ref_intersect_cylinder(ray, (t_cylinder *)obj->object);
+		if (cur > 0 && (*t < 0 || cur < *t))
+		{
+			*t = cur;
+			closest = obj;
+		}
+		obj = obj->next;
+	}
+	return (closest);
+}
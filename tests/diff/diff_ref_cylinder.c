@@ -0,0 +1,141 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   diff_ref_cylinder.c                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "difftest.h"
+#include <math.h>
+
+/*
+ * 원기둥의 기준 구현입니다. 최적화된 intersect_cylinder와 달리
+ * 로컬 좌표계, 감싸는 구 배제, prepare_cylinder의 값을 쓰지 않고
+ * 파싱된 값(center, axis, diameter, height)만으로 세계 좌표계에서
+ * 교과서 공식대로 계산합니다. 모든 계산은 double로 수행합니다.
+ */
+
+typedef struct s_rcyl
+{
+	t_rvec	center;
+	t_rvec	axis;
+	double	radius;
+	double	half_height;
+}	t_rcyl;
+
+static t_rcyl	ref_cyl(t_cylinder *cy)
+{
+	t_rcyl	r;
+	double	len;
+
+	r.center = rv(cy->center);
+	r.axis = rv(cy->axis);
+	len = sqrt(rv_dot(r.axis, r.axis));
+	r.axis = rv_muladd((t_rvec){0, 0, 0}, r.axis, 1.0 / len);
+	r.radius = cy->diameter / 2.0;
+	r.half_height = cy->height / 2.0;
+	return (r);
+}
+
+/*
+ * ref_side - 측면: |X + tD - ((X + tD)·a)a|² = r²를 풀고
+ * 축 방향 위치 (X + tD)·a가 ±half_height 안인 가장 작은 양의 근
+ */
+static double	ref_side(t_rray ray, t_rcyl *c)
+{
+	t_rvec	x;
+	double	abc[3];
+	double	disc;
+	double	t;
+
+	x = rv_sub(ray.origin, c->center);
+	abc[0] = rv_dot(ray.direction, ray.direction)
+		- pow(rv_dot(ray.direction, c->axis), 2);
+	abc[1] = 2 * (rv_dot(ray.direction, x) - rv_dot(ray.direction, c->axis)
+			* rv_dot(x, c->axis));
+	abc[2] = rv_dot(x, x) - pow(rv_dot(x, c->axis), 2) - c->radius * c->radius;
+	disc = abc[1] * abc[1] - 4 * abc[0] * abc[2];
+	if (abc[0] < 1e-12 || disc < 0)
+		return (-1.0);
+	t = (-abc[1] - sqrt(disc)) / (2 * abc[0]);
+	if (t > 1e-6 && fabs(rv_dot(rv_muladd(x, ray.direction, t), c->axis))
+		<= c->half_height)
+		return (t);
+	t = (-abc[1] + sqrt(disc)) / (2 * abc[0]);
+	if (t > 1e-6 && fabs(rv_dot(rv_muladd(x, ray.direction, t), c->axis))
+		<= c->half_height)
+		return (t);
+	return (-1.0);
+}
+
+/*
+ * ref_caps - 뚜껑: center ± half_height * axis를 지나는 평면과 만나고
+ * 뚜껑 중심과의 거리가 반지름 이하인 가장 작은 양의 t
+ */
+static double	ref_caps(t_rray ray, t_rcyl *c)
+{
+	t_rvec	cap;
+	t_rvec	q;
+	double	best;
+	double	t;
+	int		side;
+
+	best = -1.0;
+	side = -1;
+	while (side <= 1 && fabs(rv_dot(ray.direction, c->axis)) > 1e-12)
+	{
+		cap = rv_muladd(c->center, c->axis, side * c->half_height);
+		t = rv_dot(rv_sub(cap, ray.origin), c->axis)
+			/ rv_dot(ray.direction, c->axis);
+		q = rv_sub(rv_muladd(ray.origin, ray.direction, t), cap);
+		if (t > 1e-6 && rv_dot(q, q) <= c->radius * c->radius
+			&& (best < 0 || t < best))
+			best = t;
+		side += 2;
+	}
+	return (best);
+}
+
+double	ref_intersect_cylinder(t_rray ray, t_cylinder *cylinder)
+{
+	t_rcyl	c;
+	double	side;
+	double	caps;
+
+	c = ref_cyl(cylinder);
+	side = ref_side(ray, &c);
+	caps = ref_caps(ray, &c);
+	if (side < 0 || (caps > 0 && caps < side))
+		return (caps);
+	return (side);
+}
+
+/*
+ * ref_cylinder_normal - 측면과 뚜껑 중 교점에서 더 가까운 면의 법선
+ */
+t_rvec	ref_cylinder_normal(t_cylinder *cylinder, t_rvec point)
+{
+	t_rcyl	c;
+	t_rvec	rel;
+	t_rvec	radial;
+	double	z;
+
+	c = ref_cyl(cylinder);
+	rel = rv_sub(point, c.center);
+	z = rv_dot(rel, c.axis);
+	radial = rv_muladd(rel, c.axis, -z);
+	if (fabs(c.half_height - fabs(z))
+		< fabs(c.radius - sqrt(rv_dot(radial, radial))))
+	{
+		if (z < 0)
+			return (rv_muladd((t_rvec){0, 0, 0}, c.axis, -1));
+		return (c.axis);
+	}
+	return (rv_muladd((t_rvec){0, 0, 0}, radial,
+		1.0 / sqrt(rv_dot(radial, radial))));
+}
@@ -0,0 +1,119 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   diff_ref_light.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "difftest.h"
+#include <math.h>
+
+/*
+ * src/renderer/lighting.c와 render.c의 최초 구현을 고정해 둔 복사본입니다.
+ * 최적화된 경로가 바뀌더라도 이 파일은 수정하지 않습니다.
+ */
+
+static t_rvec	rv_normalize(t_rvec v)
+{
+	double	len;
+
+	len = sqrt(rv_dot(v, v));
+	if (len == 0)
+		return (v);
+	return (rv_muladd((t_rvec){0, 0, 0}, v, 1.0 / len));
+}
+
+static t_rvec	ref_normal(t_object *obj, t_rvec point)
+{
+	if (obj->type == OBJ_SPHERE)
+		return (rv_normalize(rv_sub(point,
+					rv(((t_sphere *)obj->object)->center))));
+	if (obj->type == OBJ_PLANE)
+		return (rv_normalize(rv(((t_plane *)obj->object)->normal)));
+	if (obj->type == OBJ_CYLINDER)
+		return (ref_cylinder_normal((t_cylinder *)obj->object, point));
+	return ((t_rvec){0, 0, 0});
+}
+
+static int	ref_in_shadow(t_scene *scene, t_rvec point, t_light *light)
+{
+	t_rray	shadow_ray;
+	t_rvec	light_dir;
+	double	light_distance;
+	double	t;
+
+	light_dir = rv_sub(rv(light->position), point);
+	light_distance = sqrt(rv_dot(light_dir, light_dir));
+	shadow_ray.origin = rv_muladd(point, light_dir, 0.001);
+	shadow_ray.direction = rv_normalize(light_dir);
+	if (ref_closest(scene, shadow_ray, &t) && t < light_distance)
+		return (1);
+	return (0);
+}
+
+static t_rvec	ref_diffuse(t_scene *scene, t_object *obj, t_rvec point,
+	t_rvec normal)
+{
+	t_rvec	color;
+	t_light	*light;
+	double	diff;
+
+	color = (t_rvec){0, 0, 0};
+	light = scene->lights;
+	while (light)
+	{
+		if (!ref_in_shadow(scene, point, light))
+		{
+			diff = rv_dot(normal, rv_normalize(rv_sub(rv(light->position),
+							point)));
+			if (diff < 0)
+				diff = 0;
+			color.x += obj->color.x * light->color.x * light->ratio * diff;
+			color.y += obj->color.y * light->color.y * light->ratio * diff;
+			color.z += obj->color.z * light->color.z * light->ratio * diff;
+		}
+		light = light->next;
+	}
+	return (color);
+}
+
+/*
+ * ref_trace - 기준 구현으로 광선 하나를 추적 (환경광 + 확산광 + 그림자)
+ * @scene: 장면
+ * @ray: 추적할 광선
+ * @color: 0.0 ~ 1.0으로 클램핑된 색상 (출력)
+ *
+ * Return: 1 (물체와 만남), 0 (배경)
+ */
+int	ref_trace(t_scene *scene, t_rray ray, t_rvec *color)
+{
+	t_object	*obj;
+	t_rvec		point;
+	t_rvec		diffuse;
+	double		t;
+
+	*color = (t_rvec){0, 0, 0};
+	obj = ref_closest(scene, ray, &t);
+	if (!obj)
+		return (0);
+	point = rv_muladd(ray.origin, ray.direction, t);
+	diffuse = ref_diffuse(scene, obj, point, ref_normal(obj, point));
+	if (scene->ambient_light)
+	{
+		color->x = obj->color.x * scene->ambient_light->color.x
+			* scene->ambient_light->ratio;
+		color->y = obj->color.y * scene->ambient_light->color.y
+			* scene->ambient_light->ratio;
+		color->z = obj->color.z * scene->ambient_light->color.z
+			* scene->ambient_light->ratio;
+	}
+	color->x = fmin(fmax(color->x + diffuse.x, 0.0), 1.0);
+	color->y = fmin(fmax(color->y + diffuse.y, 0.0), 1.0);
+	color->z = fmin(fmax(color->z + diffuse.z, 0.0), 1.0);
+	return (1);
+}
@@ -0,0 +1,61 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   diff_rvec.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "difftest.h"
+#include <math.h>
+
+t_rvec	rv(t_vec3 v)
+{
+	t_rvec	r;
+
+	r.x = v.x;
+	r.y = v.y;
+	r.z = v.z;
+	return (r);
+}
+
+t_rray	rray(t_ray ray)
+{
+	t_rray	r;
+
+	r.origin = rv(ray.origin);
+	r.direction = rv(ray.direction);
+	return (r);
+}
+
+t_rvec	rv_sub(t_rvec a, t_rvec b)
+{
+	t_rvec	r;
+
+	r.x = a.x - b.x;
+	r.y = a.y - b.y;
+	r.z = a.z - b.z;
+	return (r);
+}
+
+double	rv_dot(t_rvec a, t_rvec b)
+{
+	return (a.x * b.x + a.y * b.y + a.z * b.z);
+}
+
+/*
+ * rv_muladd - a + b * s
+ */
+t_rvec	rv_muladd(t_rvec a, t_rvec b, double s)
+{
+	t_rvec	r;
+
+	r.x = a.x + b.x * s;
+	r.y = a.y + b.y * s;
+	r.z = a.z + b.z * s;
+	return (r);
+}
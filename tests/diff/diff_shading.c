@@ -0,0 +1,167 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   diff_shading.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "difftest.h"
+#include "vec3.h"
+#include <math.h>
+
+void	parse_line(char *line, t_scene *scene);
+
+/*
+ * add_random_line - 임의의 장면 요소 한 줄을 만들어 파서에 전달
+ * @scene: 요소를 추가할 장면
+ * @state: 난수 상태
+ * @kind: 0 (구), 1 (평면), 2 (광원)
+ *
+ * 실제 .rt 파서를 거치게 하여, 최적화 경로가 파싱 후 처리에
+ * 의존하더라도 실제 렌더링과 같은 입력을 받도록 합니다.
+ */
+static void	add_random_line(t_scene *scene, unsigned long long *state,
+	int kind)
+{
+	char	line[256];
+	t_vec3	p;
+	t_vec3	n;
+
+	p = rng_point(state, 20.0);
+	n = rng_unit(state);
+	if (kind == 0)
+		snprintf(line, sizeof(line), "sp %f,%f,%f %f %d,%d,%d", p.x, p.y,
+			p.z, rng_range(state, 1.0, 12.0), (int)(rng_next(state) % 256),
+			(int)(rng_next(state) % 256), (int)(rng_next(state) % 256));
+	else if (kind == 1)
+		snprintf(line, sizeof(line), "pl %f,%f,%f %f,%f,%f %d,%d,%d", p.x,
+			p.y, p.z, n.x, n.y, n.z, (int)(rng_next(state) % 256),
+			(int)(rng_next(state) % 256), (int)(rng_next(state) % 256));
+	else
+		snprintf(line, sizeof(line), "L %f,%f,%f %f 255,255,255",
+			p.x * 2, p.y * 2, p.z * 2, rng_range(state, 0.2, 0.9));
+	parse_line(line, scene);
+}
+
+/*
+ * add_random_cylinder - 임의의 원기둥 한 줄을 만들어 파서에 전달
+ * @scene: 원기둥을 추가할 장면
+ * @state: 난수 상태
+ */
+static void	add_random_cylinder(t_scene *scene, unsigned long long *state)
+{
+	char	line[256];
+	t_vec3	p;
+	t_vec3	n;
+
+	p = rng_point(state, 20.0);
+	n = rng_unit(state);
+	snprintf(line, sizeof(line), "cy %f,%f,%f %f,%f,%f %f %f %d,%d,%d",
+		p.x, p.y, p.z, n.x, n.y, n.z, rng_range(state, 1.0, 8.0),
+		rng_range(state, 1.0, 16.0), (int)(rng_next(state) % 256),
+		(int)(rng_next(state) % 256), (int)(rng_next(state) % 256));
+	parse_line(line, scene);
+}
+
+/*
+ * random_scene - 구 4~19개, 원기둥 0~4개, 평면 0~1개, 광원 1~3개로 된
+ *                임의의 장면
+ * @state: 난수 상태
+ *
+ * Return: 새 장면, 실패 시 NULL
+ */
+static t_scene	*random_scene(unsigned long long *state)
+{
+	t_scene	*scene;
+	int		count;
+
+	scene = calloc(1, sizeof(t_scene));
+	if (!scene)
+		return (NULL);
+	parse_line("A 0.2 255,255,255", scene);
+	count = 4 + rng_next(state) % 16;
+	while (count-- > 0)
+		add_random_line(scene, state, 0);
+	count = rng_next(state) % 5;
+	while (count-- > 0)
+		add_random_cylinder(scene, state);
+	count = rng_next(state) % 2;
+	while (count-- > 0)
+		add_random_line(scene, state, 1);
+	count = 1 + rng_next(state) % 3;
+	while (count-- > 0)
+		add_random_line(scene, state, 2);
+	prepare_scene(scene);
+	return (scene);
+}
+
+/*
+ * shade_once - 임의의 광선 하나를 두 경로로 추적하여 통계에 반영
+ * @scene: 장면
+ * @state: 난수 상태
+ * @opts: 색상 허용치
+ * @st: 누적 통계
+ *
+ * 교점 여부가 다르면 불일치입니다. 둘 다 만나면 채널별 최대 편차를
+ * 기록하고, 편차가 허용치를 넘으면(그림자 판정이 뒤집힌 경우 등)
+ * 역시 불일치로 셉니다.
+ */
+static void	shade_once(t_scene *scene, unsigned long long *state,
+	t_diff_opts *opts, t_diff_stats *st)
+{
+	t_ray	ray;
+	t_rvec	ref;
+	t_vec3	opt;
+	int		hit_ref;
+	double	dc;
+
+	ray = diff_random_ray(state, vec3_new(0, 0, 0), 20.0);
+	hit_ref = ref_trace(scene, rray(ray), &ref);
+	st->rays++;
+	if (hit_ref != trace_ray(scene, ray, &opt))
+	{
+		st->disagree++;
+		return ;
+	}
+	dc = fmax(fabs(ref.x - opt.x), fmax(fabs(ref.y - opt.y),
+				fabs(ref.z - opt.z)));
+	if (dc > st->max_dcolor)
+		st->max_dcolor = dc;
+	if (dc > opts->color_tol)
+		st->disagree++;
+}
+
+/*
+ * diff_shading - trace_ray(교점 + 법선 + 조명) 전체를 기준 구현과 비교
+ * @opts: 광선 수, 시드, 색상 허용치
+ * @st: 결과 통계 (출력)
+ *
+ * 임의의 장면을 만들고 장면마다 DIFF_SCENE_RAYS개의 광선을 쏩니다.
+ * 광선마다 그림자 광선이 추가로 필요하므로 전체 광선 수는
+ * 커널 테스트의 1/5로 줄입니다.
+ */
+void	diff_shading(t_diff_opts *opts, t_diff_stats *st)
+{
+	unsigned long long	state;
+	t_scene				*scene;
+
+	state = opts->seed ^ 0x5348ULL;
+	scene = NULL;
+	while (st->rays < opts->rays / 5)
+	{
+		if (st->rays % DIFF_SCENE_RAYS == 0)
+		{
+			free_scene(scene);
+			scene = random_scene(&state);
+			if (!scene)
+				return ;
+		}
+		shade_once(scene, &state, opts, st);
+	}
+	free_scene(scene);
+}
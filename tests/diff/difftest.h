@@ -0,0 +1,96 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   difftest.h                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef DIFFTEST_H
+# define DIFFTEST_H
+
+# include "minirt.h"
+# include "rng.h"
+
+# define DIFF_DEFAULT_RAYS 1000000
+# define DIFF_DEFAULT_SEED 42
+# define DIFF_SCENE_RAYS 2000
+# define DIFF_KERNELS 4
+
+/*
+ * 기본 교점 거리 허용치 (상대 오차)
+ * float 빌드는 스침 광선의 평면 교점처럼 조건이 나쁜 경우
+ * 1e-4 수준의 상대 오차가 정상적으로 생기므로 허용치를 넓힙니다.
+ */
+# ifdef RT_FLOAT
+#  define DIFF_T_TOL 2e-3
+# else
+#  define DIFF_T_TOL 1e-9
+# endif
+
+/*
+ * 참조 구현은 빌드 설정(정밀도, SIMD 등)과 무관하게
+ * 항상 double로 계산하도록 별도의 벡터 타입을 사용합니다.
+ */
+typedef struct s_rvec
+{
+	double	x;
+	double	y;
+	double	z;
+}	t_rvec;
+
+typedef struct s_rray
+{
+	t_rvec	origin;
+	t_rvec	direction;
+}	t_rray;
+
+typedef struct s_diff_opts
+{
+	long				rays;
+	unsigned long long	seed;
+	double				max_rate;
+	double				t_tol;
+	double				color_tol;
+}	t_diff_opts;
+
+typedef struct s_diff_stats
+{
+	const char	*name;
+	long		rays;
+	long		disagree;
+	double		max_dt;
+	double		max_dcolor;
+}	t_diff_stats;
+
+/* diff_rvec.c */
+t_rvec				rv(t_vec3 v);
+t_rray				rray(t_ray ray);
+t_rvec				rv_sub(t_rvec a, t_rvec b);
+double				rv_dot(t_rvec a, t_rvec b);
+t_rvec				rv_muladd(t_rvec a, t_rvec b, double s);
+
+/* diff_ref.c, diff_ref_light.c: 원래의 단순한 구현을 고정해 둔 복사본 */
+double				ref_intersect_sphere(t_rray ray, t_sphere *sphere);
+double				ref_intersect_plane(t_rray ray, t_plane *plane);
+t_object			*ref_closest(t_scene *scene, t_rray ray, double *t);
+int					ref_trace(t_scene *scene, t_rray ray, t_rvec *color);
+
+/* diff_ref_cylinder.c: 파싱된 값만 쓰는 원기둥 기준 구현 */
+double				ref_intersect_cylinder(t_rray ray, t_cylinder *cylinder);
+t_rvec				ref_cylinder_normal(t_cylinder *cylinder, t_rvec point);
+
+/* diff_kernels.c, diff_shading.c */
+t_ray				diff_random_ray(unsigned long long *state, t_vec3 target,
+						double spread);
+void				diff_record(t_diff_stats *st, double t_ref, double t_opt);
+void				diff_sphere(t_diff_opts *opts, t_diff_stats *st);
+void				diff_plane(t_diff_opts *opts, t_diff_stats *st);
+void				diff_cylinder(t_diff_opts *opts, t_diff_stats *st);
+void				diff_shading(t_diff_opts *opts, t_diff_stats *st);
+
+#endif
@@ -0,0 +1,112 @@
+#!/bin/bash
+# Build-variant comparison for miniRT
+#
+# Builds miniRT_bench once per variant (each variant is a string of make
+# variable assignments), renders every perf-test scene with each build,
+# and reports rays/sec, the speedup over the first variant and how much
+# the image differs from the first variant's image (largest channel
+# delta, mean channel delta, % of pixels that changed) and the memory
+# used by the acceleration structure.
+#
+# The tree is rebuilt with the default settings before exiting.
+#
+# Environment:
+#   PERF_RUNS   renders per scene, the fastest one is kept (default 3)
+#   MAKE        make command to use (default make)
+#   GEN_SCENES  generated scenes as dist:count (default: the perf-test
+#               list, every distribution at 100, 10000 and 100000 objects)
+#
+# Usage:
+#   tests/perf/build_compare.sh "PRECISION=double" "PRECISION=float"
+#   tests/perf/build_compare.sh "LTO=0" "LTO=1" "SIMD=avx"
+
+set -u
+
+ROOT="$(cd "$(dirname "$0")/../.." && pwd)"
+RUNS="${PERF_RUNS:-3}"
+GEN_SCENES="${GEN_SCENES:-uniform:100 clustered:100 stadium:100
+    uniform:10000 clustered:10000 stadium:10000
+    uniform:100000 clustered:100000 stadium:100000}"
+MAKE="${MAKE:-make}"
+# Variables given on the calling make's command line would override
+# every variant in the sub-makes below.
+unset MAKEFLAGS MFLAGS MAKELEVEL
+
+if [ "$#" -lt 2 ]; then
+    echo "Usage: $0 <variant> <variant>..."
+    exit 1
+fi
+
+WORK="$(mktemp -d)"
+trap 'rm -rf "$WORK"' EXIT
+
+build() {
+    # $1 is split on purpose: one word per make variable
+    # shellcheck disable=SC2086
+    "$MAKE" -s -C "$ROOT" bench scenegen $1 > /dev/null || exit 1
+    cp "$ROOT/miniRT_bench" "$2"
+}
+
+i=0
+for variant in "$@"; do
+    build "$variant" "$WORK/bench_$i"
+    i=$((i + 1))
+done
+build "" "$WORK/bench_default"
+
+SCENES=()
+for f in "$ROOT"/scenes/*.rt; do
+    SCENES+=("$(basename "$f" .rt)=$f")
+done
+for spec in $GEN_SCENES; do
+    dist="${spec%%:*}"
+    count="${spec#*:}"
+    name="gen_${dist}_${count}"
+    "$ROOT/miniRT_scenegen" -n "$count" --dist "$dist" --seed 1 \
+        -o "$WORK/$name.rt"
+    SCENES+=("$name=$WORK/$name.rt")
+done
+
+field() {
+    sed -n "s/^$1=//p" "$2"
+}
+
+printf "%-22s %-20s %12s %8s %7s %9s %8s %9s\n" "scene" "variant" \
+    "rays/sec" "speedup" "max_ch" "mean_ch" "pixels%" "accel_kb"
+for entry in "${SCENES[@]}"; do
+    name="${entry%%=*}"
+    path="${entry#*=}"
+    ref="$WORK/$name.ppm"
+    i=0
+    for variant in "$@"; do
+        out="$WORK/$name.$i"
+        if [ "$i" -eq 0 ]; then
+            "$WORK/bench_0" "$path" --runs "$RUNS" --dump "$ref" > "$out" \
+                || exit 1
+            base="$(field rays_per_sec "$out")"
+        else
+            "$WORK/bench_$i" "$path" --runs "$RUNS" --compare "$ref" \
+                > "$out" || exit 1
+        fi
+        rps="$(field rays_per_sec "$out")"
+        echo "$i $(awk -v r="$rps" -v b="$base" 'BEGIN { print r / b }')" \
+            >> "$WORK/speedups"
+        printf "%-22s %-20s %12s %7.2fx %7s %9s %8s %9s\n" "$name" \
+            "${variant:-default}" "$rps" \
+            "$(awk -v r="$rps" -v b="$base" 'BEGIN { print r / b }')" \
+            "$(field diff_max_channel "$out")" \
+            "$(field diff_mean_abs "$out")" \
+            "$(field diff_pixels_pct "$out")" \
+            "$(( $(field accel_bytes "$out") / 1024 ))"
+        i=$((i + 1))
+    done
+done
+
+echo
+echo "geometric mean speedup over '$1':"
+i=0
+for variant in "$@"; do
+    awk -v i="$i" -v v="$variant" '$1 == i { s += log($2); n++ }
+        END { printf "  %-20s %.3fx\n", v, exp(s / n) }' "$WORK/speedups"
+    i=$((i + 1))
+done
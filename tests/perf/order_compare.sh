@@ -0,0 +1,88 @@
+#!/bin/bash
+# Pixel-order comparison for miniRT
+#
+# Renders every perf-test scene and a few generated scenes once per pixel
+# order (--order) and reports rays/sec, the speedup over the first order
+# and the L1 data-cache and last-level-cache misses per camera ray. The
+# miss columns read "n/a" where hardware counters are unavailable (not
+# Linux, most virtual machines, or perf_event_paranoid > 2). The image
+# checksum must be the same for every order; a mismatch is marked.
+#
+# Environment:
+#   PERF_RUNS     renders per scene, the fastest one is kept (default 3)
+#   GEN_SCENES    generated scenes as dist:count (default
+#                 "uniform:100 clustered:100 stadium:100 clustered:100000")
+#   PIXEL_ORDERS  orders to compare (default "tile scanline morton hilbert")
+
+set -u
+
+ROOT="$(cd "$(dirname "$0")/../.." && pwd)"
+BENCH="$ROOT/miniRT_bench"
+SCENEGEN="$ROOT/miniRT_scenegen"
+RUNS="${PERF_RUNS:-3}"
+GEN_SCENES="${GEN_SCENES:-uniform:100 clustered:100 stadium:100 clustered:100000}"
+ORDERS="${PIXEL_ORDERS:-tile scanline morton hilbert}"
+
+for tool in "$BENCH" "$SCENEGEN"; do
+    if [ ! -x "$tool" ]; then
+        echo "$(basename "$tool") not found, run 'make bench scenegen' first."
+        exit 1
+    fi
+done
+
+WORK="$(mktemp -d)"
+trap 'rm -rf "$WORK"' EXIT
+
+SCENES=()
+for f in "$ROOT"/scenes/*.rt; do
+    SCENES+=("$(basename "$f" .rt)=$f")
+done
+for spec in $GEN_SCENES; do
+    dist="${spec%%:*}"
+    count="${spec#*:}"
+    name="gen_${dist}_${count}"
+    "$SCENEGEN" -n "$count" --dist "$dist" --seed 1 -o "$WORK/$name.rt"
+    SCENES+=("$name=$WORK/$name.rt")
+done
+
+field() {
+    sed -n "s/^$1=//p" "$2"
+}
+
+status=0
+printf "%-22s %-9s %12s %8s %10s %10s\n" "scene" "order" "rays/sec" \
+    "speedup" "l1d/ray" "llc/ray"
+for entry in "${SCENES[@]}"; do
+    name="${entry%%=*}"
+    path="${entry#*=}"
+    base=""
+    for order in $ORDERS; do
+        out="$WORK/out.txt"
+        "$BENCH" "$path" --runs "$RUNS" --order "$order" > "$out" || exit 1
+        rps="$(field rays_per_sec "$out")"
+        sum="$(field checksum "$out")"
+        if [ -z "$base" ]; then
+            base="$rps"
+            ref="$sum"
+        fi
+        mark=""
+        if [ "$sum" != "$ref" ]; then
+            mark="  IMAGE DIFFERS"
+            status=1
+        fi
+        echo "$order $(awk -v r="$rps" -v b="$base" 'BEGIN { print r / b }')" \
+            >> "$WORK/speedups"
+        printf "%-22s %-9s %12s %7.2fx %10s %10s%s\n" "$name" "$order" \
+            "$rps" "$(awk -v r="$rps" -v b="$base" 'BEGIN { print r / b }')" \
+            "$(field l1d_misses_per_ray "$out")" \
+            "$(field llc_misses_per_ray "$out")" "$mark"
+    done
+done
+
+echo
+echo "geometric mean speedup over '${ORDERS%% *}':"
+for order in $ORDERS; do
+    awk -v o="$order" '$1 == o { s += log($2); n++ }
+        END { printf "  %-9s %.3fx\n", o, exp(s / n) }' "$WORK/speedups"
+done
+exit "$status"
@@ -0,0 +1,50 @@
+#!/bin/bash
+# Scaling sweep for miniRT
+#
+# Generates scenes with miniRT_scenegen for every distribution and for
+# object counts 10, 100, 1000, ... up to PERF_SWEEP_MAX, renders each once
+# with miniRT_bench and prints rays/sec. Nothing is compared; use it to see
+# how the renderer scales with scene size.
+#
+# Environment:
+#   PERF_SWEEP_MAX    largest object count (default 1000)
+#   PERF_SWEEP_DISTS  distributions to sweep (default "uniform clustered stadium")
+#   PERF_SWEEP_ACCEL  --accel modes to render with (default "auto"),
+#                     e.g. "bvh grid" to compare the two structures
+
+set -u
+
+ROOT="$(cd "$(dirname "$0")/../.." && pwd)"
+BENCH="$ROOT/miniRT_bench"
+SCENEGEN="$ROOT/miniRT_scenegen"
+MAX="${PERF_SWEEP_MAX:-1000}"
+DISTS="${PERF_SWEEP_DISTS:-uniform clustered stadium}"
+ACCELS="${PERF_SWEEP_ACCEL:-auto}"
+
+for tool in "$BENCH" "$SCENEGEN"; do
+    if [ ! -x "$tool" ]; then
+        echo "$(basename "$tool") not found, run 'make bench scenegen' first."
+        exit 1
+    fi
+done
+
+WORK="$(mktemp -d)"
+trap 'rm -rf "$WORK"' EXIT
+
+printf "%-10s %10s %6s %10s %14s\n" "dist" "objects" "accel" "seconds" \
+    "rays/sec"
+for dist in $DISTS; do
+    n=10
+    while [ "$n" -le "$MAX" ]; do
+        "$SCENEGEN" -n "$n" --dist "$dist" --seed 1 -o "$WORK/scene.rt"
+        for accel in $ACCELS; do
+            "$BENCH" "$WORK/scene.rt" --runs 1 --accel "$accel" \
+                > "$WORK/out.txt" || exit 1
+            printf "%-10s %10d %6s %10s %14s\n" "$dist" "$n" \
+                "$(sed -n 's/^accel=//p' "$WORK/out.txt")" \
+                "$(sed -n 's/^seconds=//p' "$WORK/out.txt")" \
+                "$(sed -n 's/^rays_per_sec=//p' "$WORK/out.txt")"
+        done
+        n=$((n * 10))
+    done
+done
@@ -0,0 +1,139 @@
+#!/bin/bash
+# Performance regression test for miniRT
+#
+# Renders every scene in scenes/*.rt plus scenes generated by
+# miniRT_scenegen (100, 10k and 100k objects per distribution) with
+# miniRT_bench, then compares the image checksum against the committed
+# checksums in tests/perf/baselines.txt.
+#
+# Throughput is reported relative to tests/perf/throughput.local, the
+# rays/sec that --update measured on this machine (not committed, since
+# rays/sec from another machine means nothing here).
+#
+# Fails when:
+#   - an image checksum differs from its baseline (output changed)
+#   - PERF_TOLERANCE is set and rays/sec drops below the local
+#     baseline * (1 - PERF_TOLERANCE)
+#
+# Environment:
+#   PERF_TOLERANCE  allowed throughput drop as a fraction (default unset:
+#                   report only)
+#   PERF_RUNS       renders per scene, the fastest one is kept (default 3)
+#   GEN_SCENES      generated scenes as dist:count (default
+#                   "uniform:100 ... stadium:100000", every distribution
+#                   at 100, 10000 and 100000 objects)
+#
+# Usage:
+#   tests/perf/perf_test.sh            compare against baselines
+#   tests/perf/perf_test.sh --update   rewrite checksums and the local
+#                                      throughput baseline
+
+set -u
+
+ROOT="$(cd "$(dirname "$0")/../.." && pwd)"
+BENCH="$ROOT/miniRT_bench"
+SCENEGEN="$ROOT/miniRT_scenegen"
+BASELINE="$ROOT/tests/perf/baselines.txt"
+LOCAL="$ROOT/tests/perf/throughput.local"
+TOLERANCE="${PERF_TOLERANCE:-}"
+RUNS="${PERF_RUNS:-3}"
+GEN_SCENES="${GEN_SCENES:-uniform:100 clustered:100 stadium:100
+    uniform:10000 clustered:10000 stadium:10000
+    uniform:100000 clustered:100000 stadium:100000}"
+UPDATE=0
+[ "${1:-}" = "--update" ] && UPDATE=1
+
+for tool in "$BENCH" "$SCENEGEN"; do
+    if [ ! -x "$tool" ]; then
+        echo "$(basename "$tool") not found, run 'make bench scenegen' first."
+        exit 1
+    fi
+done
+
+WORK="$(mktemp -d)"
+trap 'rm -rf "$WORK"' EXIT
+
+SCENES=()
+for f in "$ROOT"/scenes/*.rt; do
+    SCENES+=("$(basename "$f" .rt)=$f")
+done
+# Generated scenes: miniRT_scenegen distributions and sizes, fixed seed.
+for spec in $GEN_SCENES; do
+    dist="${spec%%:*}"
+    count="${spec#*:}"
+    name="gen_${dist}_${count}"
+    "$SCENEGEN" -n "$count" --dist "$dist" --seed 1 -o "$WORK/$name.rt"
+    SCENES+=("$name=$WORK/$name.rt")
+done
+
+lookup() {
+    awk -v k="$1" -v c="$2" '$1 == k { print $c }' "$3" 2>/dev/null
+}
+
+field() {
+    sed -n "s/^$1=//p" "$2"
+}
+
+FAILED=0
+RESULTS="$WORK/results.txt"
+printf "%-22s %-18s %12s %8s  %s\n" "scene" "checksum" "rays/sec" \
+    "vs local" "status"
+for entry in "${SCENES[@]}"; do
+    name="${entry%%=*}"
+    path="${entry#*=}"
+    out="$WORK/$name.out"
+    if ! "$BENCH" "$path" --runs "$RUNS" > "$out"; then
+        echo "$name: miniRT_bench failed"
+        FAILED=1
+        continue
+    fi
+    sum="$(field checksum "$out")"
+    rps="$(field rays_per_sec "$out")"
+    echo "$name $sum $rps" >> "$RESULTS"
+    base_sum="$(lookup "$name" 2 "$BASELINE")"
+    base_rps="$(lookup "$name" 2 "$LOCAL")"
+    ratio="-"
+    if [ -n "$base_rps" ]; then
+        ratio="$(awk -v r="$rps" -v b="$base_rps" \
+            'BEGIN { printf "%.2fx", r / b }')"
+    fi
+    status="ok"
+    if [ "$UPDATE" -eq 0 ]; then
+        if [ -z "$base_sum" ]; then
+            status="NO BASELINE"
+            FAILED=1
+        elif [ "$sum" != "$base_sum" ]; then
+            status="OUTPUT CHANGED (expected $base_sum)"
+            FAILED=1
+        elif [ -n "$TOLERANCE" ] && [ -n "$base_rps" ] \
+            && awk -v r="$rps" -v b="$base_rps" -v t="$TOLERANCE" \
+            'BEGIN { exit !(r < b * (1 - t)) }'; then
+            status="SLOWER (tolerance $TOLERANCE)"
+            FAILED=1
+        fi
+    fi
+    printf "%-22s %-18s %12s %8s  %s\n" "$name" "$sum" "$rps" "$ratio" \
+        "$status"
+done
+
+if [ "$UPDATE" -eq 1 ]; then
+    {
+        echo "# miniRT image checksums (tests/perf/perf_test.sh --update)"
+        echo "# name checksum"
+        awk '{ print $1, $2 }' "$RESULTS"
+    } > "$BASELINE"
+    awk '{ print $1, $3 }' "$RESULTS" > "$LOCAL"
+    echo "Checksums written to $BASELINE"
+    echo "Throughput of this machine written to $LOCAL"
+    exit 0
+fi
+
+if [ -n "$TOLERANCE" ] && [ ! -f "$LOCAL" ]; then
+    echo "No $LOCAL yet, run 'make perf-baseline' to gate on throughput."
+fi
+
+if [ "$FAILED" -ne 0 ]; then
+    echo "perf-test: FAILED"
+    exit 1
+fi
+echo "perf-test: OK"
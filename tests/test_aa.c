@@ -0,0 +1,106 @@
+#include "minirt.h"
+#include "render.h"
+#include "vec3.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <assert.h>
+
+void	parse_line(char *line, t_scene *scene);
+
+static void	setup_scene(t_scene *scene)
+{
+	parse_line("A 0.2 255,255,255", scene);
+	parse_line("C 0,1,-12 0,0,1 70", scene);
+	parse_line("L -10,10,-10 0.7 255,255,255", scene);
+	parse_line("sp 0,0,5 6 255,0,0", scene);
+	parse_line("sp -4,1,9 3 0,255,0", scene);
+	parse_line("cy 4,-1,6 0,1,0.3 2 5 0,0,255", scene);
+	parse_line("pl 0,-3,0 0,1,0 200,200,200", scene);
+	prepare_scene(scene);
+}
+
+static void	finish(t_pool *p, t_scene *scene, int *pixels, int passes)
+{
+	t_mlx_data	full;
+	int			i;
+
+	while (passes-- > 0)
+	{
+		while (p->shown < TILE_COUNT)
+			pool_swap(p);
+		assert(view_refine(p) == (passes == 0));
+	}
+	full.img_data = malloc(sizeof(int) * WIDTH * HEIGHT);
+	render_scene(scene, &full);
+	i = 0;
+	while (i < WIDTH * HEIGHT)
+	{
+		assert(pixels[i] == full.img_data[i]);
+		i++;
+	}
+	free(full.img_data);
+}
+
+void	test_antialias_edges()
+{
+	t_scene		scene = {0};
+	t_mlx_data	base;
+	t_mlx_data	shown;
+	t_ray		a;
+	t_ray		b;
+	int			changed;
+	int			i;
+
+	setup_scene(&scene);
+	a = get_ray(&scene.camera, 37, 81, WIDTH);
+	b = get_ray_at(&scene.camera, 37.5, 81.5);
+	assert(vec3_length(vec3_sub(a.direction, b.direction)) < 1e-12);
+	base.img_data = malloc(sizeof(int) * WIDTH * HEIGHT);
+	shown.img_data = malloc(sizeof(int) * WIDTH * HEIGHT);
+	render_scene(&scene, &base);
+	scene.antialias = 1;
+	render_scene(&scene, &shown);
+	changed = 0;
+	i = 0;
+	while (i < WIDTH * HEIGHT)
+	{
+		changed += (shown.img_data[i] != base.img_data[i]);
+		i++;
+	}
+	assert(changed > 0 && changed < WIDTH * HEIGHT / 10);
+	free(base.img_data);
+	free(shown.img_data);
+	printf("test_antialias_edges: OK\n");
+}
+
+void	test_pool_antialias()
+{
+	t_scene		scene = {0};
+	t_mlx_data	shown;
+	t_object	*obj;
+	t_pool		*p;
+
+	setup_scene(&scene);
+	scene.antialias = 1;
+	shown.img_data = calloc(WIDTH * HEIGHT, sizeof(int));
+	p = pool_start(&scene, &shown, 2);
+	assert(p && pool_gbuffer(p) && p->edges);
+	pool_render(p);
+	finish(p, &scene, shown.img_data, 2);
+	obj = scene.objects;
+	while (obj->type != OBJ_SPHERE || ((t_sphere *)obj->object)->radius > 4)
+		obj = obj->next;
+	damage_begin(p);
+	damage_object(p->dirty, &scene, obj);
+	((t_sphere *)obj->object)->center.x += 1.5;
+	scene_update(&scene, &obj, 1);
+	damage_object(p->dirty, &scene, obj);
+	pool_damage(p);
+	assert(p->shown > 0 && !p->frame.edges);
+	finish(p, &scene, shown.img_data, 2);
+	pool_relight(p);
+	finish(p, &scene, shown.img_data, 2);
+	pool_stop(p);
+	free(shown.img_data);
+	printf("test_pool_antialias: OK\n");
+}
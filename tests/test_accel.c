@@ -0,0 +1,146 @@
+#include "minirt.h"
+#include "accel_inline.h"
+#include "vec3.h"
+#include <stdio.h>
+#include <math.h>
+#include <assert.h>
+
+void	parse_line(char *line, t_scene *scene);
+
+static void	add_grid(t_scene *scene)
+{
+	char	line[128];
+	int		i;
+
+	i = 0;
+	while (i < 60)
+	{
+		if (i % 3 == 0)
+			snprintf(line, sizeof(line), "cy %d,%d,%d 0.3,1,0.2 1 2 255,0,0",
+				i % 5 * 3 - 6, i / 5 % 4 * 3 - 4, i / 20 * 4 + 8);
+		else
+			snprintf(line, sizeof(line), "sp %d,%d,%d 1.5 255,0,0",
+				i % 5 * 3 - 6, i / 5 % 4 * 3 - 4, i / 20 * 4 + 8);
+		parse_line(line, scene);
+		i++;
+	}
+	parse_line("pl 0,-8,0 0,1,0 255,255,255", scene);
+}
+
+static void	check_leaf_order(t_accel *acc)
+{
+	int	seen[PRIM_BOUNDED] = {0};
+	int	i;
+
+	i = 0;
+	while (i < acc->n_nodes)
+	{
+		if (acc->nodes[i].child < 0)
+		{
+			assert(acc->nodes[i].first[PRIM_SPHERE] == seen[PRIM_SPHERE]);
+			assert(acc->nodes[i].first[PRIM_CYLINDER]
+				== seen[PRIM_CYLINDER]);
+			seen[PRIM_SPHERE] += acc->nodes[i].count[PRIM_SPHERE];
+			seen[PRIM_CYLINDER] += acc->nodes[i].count[PRIM_CYLINDER];
+		}
+		i++;
+	}
+	i = 0;
+	while (i < acc->n_leaves)
+	{
+		seen[PRIM_SPHERE] += acc->leaves[i].count[PRIM_SPHERE];
+		seen[PRIM_CYLINDER] += acc->leaves[i++].count[PRIM_CYLINDER];
+	}
+	assert(seen[PRIM_SPHERE] == 40 && seen[PRIM_CYLINDER] == 20);
+}
+
+void	test_accel_layout()
+{
+	t_scene		scene = {0};
+	t_accel		*acc;
+
+	add_grid(&scene);
+	prepare_scene(&scene);
+	acc = scene.accel;
+	assert(acc && acc->n_spheres == 40 && acc->n_cylinders == 20);
+	assert(acc->n_planes == 1);
+	assert(acc->planes.size == PLANE_BLOCK && acc->planes.ny[0] == 1);
+	assert(acc->planes.nx[1] == 0 && acc->planes.nz[PLANE_BLOCK - 1] == 0);
+	if (BVH_WIDE)
+		assert(acc->n_wide > 1 && acc->n_nodes == 0);
+	else
+		assert(acc->n_nodes > 1 && acc->n_wide == 0);
+	check_leaf_order(acc);
+	printf("test_accel_layout: OK\n");
+}
+
+/* Float rounding can push child.max past the parent; clamp it back in. */
+static void	clamp_child(t_aabb *child, t_aabb *parent)
+{
+	child->max.x = fmin(child->max.x, parent->max.x);
+	child->max.y = fmin(child->max.y, parent->max.y);
+	child->max.z = fmin(child->max.z, parent->max.z);
+}
+
+void	test_qbvh_quantize()
+{
+	t_qbvh_node	q;
+	t_aabb		parent;
+	t_aabb		child;
+	t_aabb		out;
+	int			i;
+
+	parent.min = vec3_new(-1000.3, 0.1, 7);
+	parent.max = vec3_new(1234.5, 0.1000001, 7.5);
+	qbvh_set_frame(&q, &parent);
+	i = 0;
+	while (i < 1000)
+	{
+		child.min = vec3_add(parent.min, vec3_mul(vec3_sub(parent.max,
+						parent.min), (i % 37) / 74.0));
+		child.max = vec3_add(child.min, vec3_mul(vec3_sub(parent.max,
+						child.min), (i % 11) / 10.0));
+		clamp_child(&child, &parent);
+		qbvh_quantize(&q, i % QBVH_WIDTH, &child);
+		qbvh_child_box(&q, i % QBVH_WIDTH, &out);
+		assert(out.min.x <= child.min.x && out.max.x >= child.max.x);
+		assert(out.min.y <= child.min.y && out.max.y >= child.max.y);
+		assert(out.min.z <= child.min.z && out.max.z >= child.max.z);
+		assert(out.max.x - out.min.x
+			<= child.max.x - child.min.x + 2.01 * q.scale[0]);
+		i++;
+	}
+	printf("test_qbvh_quantize: OK\n");
+}
+
+void	test_accel_matches_list()
+{
+	t_scene		scene = {0};
+	t_accel		*acc;
+	t_ray		ray;
+	t_hit		fast;
+	t_hit		slow;
+	int			i;
+
+	add_grid(&scene);
+	prepare_scene(&scene);
+	acc = scene.accel;
+	ray.origin = vec3_new(0.5, 0.25, -5);
+	i = 0;
+	while (i < 4000)
+	{
+		ray.direction = vec3_normalize(vec3_new(
+					sin(i * 0.37) * 0.9, cos(i * 0.61) * 0.7, 1));
+		scene.accel = acc;
+		fast = find_closest_intersection(&scene, ray);
+		assert(scene_occluded(&scene, ray, 30) == (fast.object && fast.t < 30));
+		scene.accel = NULL;
+		slow = find_closest_intersection(&scene, ray);
+		assert(fast.object == slow.object);
+		assert(!fast.object || fabs(fast.t - slow.t) < 1e-9);
+		assert(scene_occluded(&scene, ray, 30) == (slow.object && slow.t < 30));
+		i++;
+	}
+	scene.accel = acc;
+	printf("test_accel_matches_list: OK\n");
+}
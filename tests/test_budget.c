@@ -0,0 +1,93 @@
+#include "minirt.h"
+#include "render.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <assert.h>
+
+void	parse_line(char *line, t_scene *scene);
+
+static void	setup_scene(t_scene *scene)
+{
+	parse_line("A 0.2 255,255,255", scene);
+	parse_line("C 0,1,-12 0,0,1 70", scene);
+	parse_line("L -10,10,-10 0.7 255,255,255", scene);
+	parse_line("sp 0,0,5 6 255,0,0", scene);
+	parse_line("sp -4,1,9 3 0,255,0", scene);
+	parse_line("cy 4,-1,6 0,1,0.3 2 5 0,0,255", scene);
+	parse_line("pl 0,-3,0 0,1,0 200,200,200", scene);
+	prepare_scene(scene);
+	scene->antialias = 1;
+}
+
+static int	run_budget(t_scene *scene, int *pixels, double start, int ms)
+{
+	t_mlx_data	data;
+	t_pool		*p;
+	int			done;
+	int			scale;
+
+	data.img_data = pixels;
+	p = pool_start(scene, &data, 2);
+	assert(p && pool_gbuffer(p));
+	pool_budget(p, start, ms);
+	pool_render(p);
+	assert(p->frame.scale == BUDGET_FIRST_SCALE);
+	done = 0;
+	while (!done)
+	{
+		done = budget_expired(p);
+		if (pool_swap(p) > 0)
+			done = (done || (p->shown == TILE_COUNT && view_refine(p)));
+	}
+	assert(!budget_expired(p));
+	scale = p->frame.scale;
+	pool_stop(p);
+	return (scale);
+}
+
+void	test_time_budget()
+{
+	t_scene		scene = {0};
+	t_mlx_data	full;
+	int			*pixels;
+	int			i;
+
+	assert(budget_from_name("2s") == 2000 && budget_from_name("1.5") == 1500);
+	assert(budget_from_name("250ms") == 250);
+	assert(budget_from_name("2m") == -1 && budget_from_name("s") == -1);
+	assert(budget_from_name("0") == -1);
+	setup_scene(&scene);
+	full.img_data = malloc(sizeof(int) * WIDTH * HEIGHT);
+	pixels = malloc(sizeof(int) * WIDTH * HEIGHT);
+	render_scene(&scene, &full);
+	assert(run_budget(&scene, pixels, view_now(), 60000) == 1);
+	i = 0;
+	while (i < WIDTH * HEIGHT)
+	{
+		assert(pixels[i] == full.img_data[i]);
+		pixels[i++] = -1;
+	}
+	assert(run_budget(&scene, pixels, view_now() - 1000, 500)
+		== BUDGET_FIRST_SCALE);
+	i = 0;
+	while (i < WIDTH * HEIGHT)
+		assert(pixels[i++] != -1);
+	free(pixels);
+	free(full.img_data);
+	printf("test_time_budget: OK\n");
+}
+
+void	test_check_args()
+{
+	char		*good[] = {"miniRT", "a.rt", "--aa", "--time-budget", "500ms",
+		"--order", "morton", "--watch"};
+	char		*bad[] = {"miniRT", "a.rt", "--accel", "fast"};
+	t_options	opt;
+
+	assert(check_args(8, good, &opt));
+	assert(opt.accel_mode == ACCEL_AUTO && opt.pixel_order == ORDER_MORTON);
+	assert(opt.antialias && opt.watch && !opt.gbuffer && !opt.progressive);
+	assert(opt.budget_ms == 500);
+	assert(!check_args(4, bad, &opt));
+	printf("test_check_args: OK\n");
+}
@@ -0,0 +1,92 @@
+#include "minirt.h"
+#include "accel.h"
+#include "vec3.h"
+#include <stdio.h>
+#include <math.h>
+#include <assert.h>
+
+void	parse_line(char *line, t_scene *scene);
+
+static void	add_particles(t_scene *scene, int n, double radius)
+{
+	char	line[128];
+	int		i;
+
+	i = 0;
+	while (i < n)
+	{
+		if (i % 7 == 0)
+			snprintf(line, sizeof(line), "cy %g,%g,%g 1,0.5,0 %g %g 255,0,0",
+				fmod(i * 7.31, 20) - 10, fmod(i * 3.17, 16) - 8,
+				fmod(i * 5.53, 20) + 5, radius * 2, radius * 3);
+		else
+			snprintf(line, sizeof(line), "sp %g,%g,%g %g 255,0,0",
+				fmod(i * 7.31, 20) - 10, fmod(i * 3.17, 16) - 8,
+				fmod(i * 5.53, 20) + 5, radius * 2);
+		parse_line(line, scene);
+		i++;
+	}
+}
+
+static void	compare_with_list(t_scene *scene)
+{
+	t_accel		*acc;
+	t_ray		ray;
+	t_hit		fast;
+	t_hit		slow;
+	int			i;
+
+	acc = scene->accel;
+	ray.origin = vec3_new(0.5, 0.25, -5);
+	i = 0;
+	while (i < 4000)
+	{
+		ray.direction = vec3_normalize(vec3_new(
+					sin(i * 0.37) * 0.9, cos(i * 0.61) * 0.7, 1));
+		scene->accel = acc;
+		fast = find_closest_intersection(scene, ray);
+		assert(scene_occluded(scene, ray, 20) == (fast.object && fast.t < 20));
+		scene->accel = NULL;
+		slow = find_closest_intersection(scene, ray);
+		assert(fast.object == slow.object);
+		assert(!fast.object || fabs(fast.t - slow.t) < 1e-9);
+		i++;
+	}
+	scene->accel = acc;
+}
+
+void	test_grid_matches_list()
+{
+	t_scene		scene = {0};
+
+	add_particles(&scene, 400, 0.3);
+	prepare_scene(&scene);
+	assert(scene.accel->kind == ACCEL_GRID);
+	assert(scene.accel->grid.n_cells > 1 && scene.accel->n_nodes == 0);
+	compare_with_list(&scene);
+	scene.accel_mode = ACCEL_LIST;
+	prepare_scene(&scene);
+	assert(scene.accel->kind == ACCEL_LIST);
+	compare_with_list(&scene);
+	printf("test_grid_matches_list: OK\n");
+}
+
+void	test_accel_select()
+{
+	t_scene		scene = {0};
+
+	add_particles(&scene, 40, 0.3);
+	prepare_scene(&scene);
+	assert(scene.accel->kind == ACCEL_BVH);
+	add_particles(&scene, 400, 0.05);
+	parse_line("sp 0,0,500 400 255,255,255", &scene);
+	prepare_scene(&scene);
+	assert(scene.accel->kind == ACCEL_BVH);
+	scene.accel_mode = ACCEL_GRID;
+	prepare_scene(&scene);
+	assert(scene.accel->kind == ACCEL_GRID);
+	compare_with_list(&scene);
+	assert(accel_mode_from_name("none") == ACCEL_LIST);
+	assert(accel_mode_from_name("octree") == -1);
+	printf("test_accel_select: OK\n");
+}
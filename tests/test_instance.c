@@ -0,0 +1,52 @@
+#include "minirt.h"
+#include "accel.h"
+#include "vec3.h"
+#include <stdio.h>
+#include <math.h>
+#include <assert.h>
+
+void	parse_line(char *line, t_scene *scene);
+
+static t_hit	shoot(t_scene *scene, t_vec3 origin)
+{
+	t_ray	ray;
+
+	ray.origin = origin;
+	ray.direction = vec3_new(0, 0, 1);
+	return (find_closest_intersection(scene, ray));
+}
+
+void	test_instance_hits()
+{
+	t_scene		scene = {0};
+	t_hit		hit;
+	t_ray		ray;
+	t_vec3		local;
+
+	parse_line("group ball", &scene);
+	parse_line("sp 0,1,0 2 255,0,0", &scene);
+	parse_line("pl 0,0,0 0,1,0 255,255,255", &scene);
+	parse_line("end", &scene);
+	parse_line("group ball", &scene);
+	parse_line("inst ball 5,0,0 0,1,0 2", &scene);
+	parse_line("inst ball 0,0,0 1,0,0 1", &scene);
+	parse_line("inst nothing 0,0,0 0,1,0 1", &scene);
+	assert(scene.invalid == 3 && !scene.open_group);
+	prepare_scene(&scene);
+	assert(scene.groups && !scene.groups->objects->next);
+	assert(scene.accel->n_instances == 2 && scene.accel->n_planes == 0);
+	hit = shoot(&scene, vec3_new(5, 2, -10));
+	assert(hit.instance && hit.object == scene.groups->objects);
+	assert(fabs(hit.t - 8) < 1e-9);
+	hit.point = vec3_new(5, 2, -2);
+	local = instance_point_to_local(hit.instance, hit.point);
+	assert(fabs(vec3_length(vec3_sub(local, vec3_new(0, 1, -1)))) < 1e-9);
+	hit = shoot(&scene, vec3_new(1, 0, -10));
+	assert(hit.instance && fabs(hit.t - 9) < 1e-9);
+	assert(!shoot(&scene, vec3_new(3, -5, -10)).object);
+	ray.origin = vec3_new(5, 2, -10);
+	ray.direction = vec3_new(0, 0, 1);
+	assert(!scene_occluded(&scene, ray, 7.5));
+	assert(scene_occluded(&scene, ray, 8.5));
+	printf("test_instance_hits: OK\n");
+}
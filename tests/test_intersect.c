@@ -0,0 +1,51 @@
+#include "minirt.h"
+#include "vec3.h"
+#include <stdio.h>
+#include <math.h>
+#include <assert.h>
+
+static t_cylinder	make_cylinder(void)
+{
+	t_cylinder	cy = {0};
+
+	cy.center = vec3_new(0, 0, 10);
+	cy.axis = vec3_new(0, 2, 0);
+	cy.diameter = 4;
+	cy.height = 6;
+	prepare_cylinder(&cy);
+	return (cy);
+}
+
+void	test_intersect_cylinder_side()
+{
+	t_cylinder	cy = make_cylinder();
+	t_ray		ray;
+
+	ray.origin = vec3_new(0, 0, 0);
+	ray.direction = vec3_new(0, 0, 1);
+	assert(fabs(intersect_cylinder(ray, &cy) - 8.0) < 1e-9);
+	ray.origin = vec3_new(0, 3.5, 0);
+	assert(intersect_cylinder(ray, &cy) < 0);
+	ray.origin = vec3_new(2.5, 0, 0);
+	assert(intersect_cylinder(ray, &cy) < 0);
+	printf("test_intersect_cylinder_side: OK\n");
+}
+
+void	test_intersect_cylinder_caps()
+{
+	t_cylinder	cy = make_cylinder();
+	t_ray		ray;
+
+	ray.origin = vec3_new(1, 10, 10);
+	ray.direction = vec3_new(0, -1, 0);
+	assert(fabs(intersect_cylinder(ray, &cy) - 7.0) < 1e-9);
+	ray.origin = vec3_new(1, -10, 10);
+	ray.direction = vec3_new(0, 1, 0);
+	assert(fabs(intersect_cylinder(ray, &cy) - 7.0) < 1e-9);
+	ray.origin = vec3_new(1, 0, 10);
+	assert(fabs(intersect_cylinder(ray, &cy) - 3.0) < 1e-9);
+	ray.origin = vec3_new(2.5, 10, 10);
+	ray.direction = vec3_new(0, -1, 0);
+	assert(intersect_cylinder(ray, &cy) < 0);
+	printf("test_intersect_cylinder_caps: OK\n");
+}
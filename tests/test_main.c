@@ -4,6 +4,36 @@ void	test_vec3_add();
 void	test_vec3_sub();
 void	test_parse_ambient();
 void	test_parse_camera();
+void	test_parse_truncated();
+void	test_prepare_objects();
+void	test_prepare_cylinder();
+void	test_prepare_lights();
+void	test_intersect_cylinder_side();
+void	test_intersect_cylinder_caps();
+void	test_accel_layout();
+void	test_accel_matches_list();
+void	test_qbvh_quantize();
+void	test_instance_hits();
+void	test_grid_matches_list();
+void	test_accel_select();
+void	test_refit_matches_list();
+void	test_refit_rebuilds_subtree();
+void	test_tiles_match_accel();
+void	test_pixel_order();
+void	test_progressive_matches_full();
+void	test_pool_matches_full();
+void	test_view_scaling();
+void	test_reprojection();
+void	test_gbuffer_relight();
+void	test_damage_tiles();
+void	test_scene_diff();
+void	test_watch_reload();
+void	test_antialias_edges();
+void	test_pool_antialias();
+void	test_time_budget();
+void	test_check_args();
+void	test_server_jobs();
+void	test_server_render();
 
 int	main()
 {
@@ -12,6 +42,36 @@ int	main()
 	test_vec3_sub();
 	test_parse_ambient();
 	test_parse_camera();
+	test_parse_truncated();
+	test_prepare_objects();
+	test_prepare_cylinder();
+	test_prepare_lights();
+	test_intersect_cylinder_side();
+	test_intersect_cylinder_caps();
+	test_accel_layout();
+	test_accel_matches_list();
+	test_qbvh_quantize();
+	test_instance_hits();
+	test_grid_matches_list();
+	test_accel_select();
+	test_refit_matches_list();
+	test_refit_rebuilds_subtree();
+	test_tiles_match_accel();
+	test_pixel_order();
+	test_progressive_matches_full();
+	test_pool_matches_full();
+	test_view_scaling();
+	test_reprojection();
+	test_gbuffer_relight();
+	test_damage_tiles();
+	test_scene_diff();
+	test_watch_reload();
+	test_antialias_edges();
+	test_pool_antialias();
+	test_time_budget();
+	test_check_args();
+	test_server_jobs();
+	test_server_render();
 	printf("--- All tests passed ---\n");
 	return (0);
 }
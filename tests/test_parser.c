@@ -1,6 +1,7 @@
 #include "minirt.h"
 #include <stdio.h>
 #include <assert.h>
+#include <string.h>
 
 void	parse_line(char *line, t_scene *scene);
 
@@ -8,10 +9,10 @@ void	test_parse_ambient()
 {
 	t_scene	scene = {0};
 	parse_line("A 0.2 255,255,255", &scene);
-	assert(scene.ambient_light->ratio == 0.2);
-	assert(scene.ambient_light->color.x == 255);
-	assert(scene.ambient_light->color.y == 255);
-	assert(scene.ambient_light->color.z == 255);
+	assert(scene.ambient_light->ratio == (t_real)0.2);
+	assert(scene.ambient_light->color.x == 1.0);
+	assert(scene.ambient_light->color.y == 1.0);
+	assert(scene.ambient_light->color.z == 1.0);
 	printf("test_parse_ambient: OK\n");
 }
 
@@ -24,3 +25,18 @@ void	test_parse_camera()
 	printf("test_parse_camera: OK\n");
 }
 
+
+void	test_parse_truncated()
+{
+	char	sphere[] = "A 0.2 255,255,255\nsp\n";
+	char	cylinder[] = "cy 0,0,0 0,1,0 2 5";
+	char	good[] = "A 0.2 255,255,255\nsp 0,0,0 2 255,0,0";
+	t_scene	*scene;
+
+	assert(!parse_scene_buffer(sphere, strlen(sphere)));
+	assert(!parse_scene_buffer(cylinder, strlen(cylinder)));
+	scene = parse_scene_buffer(good, strlen(good));
+	assert(scene && scene->objects && !scene->invalid);
+	free_scene(scene);
+	printf("test_parse_truncated: OK\n");
+}
@@ -0,0 +1,58 @@
+#include "minirt.h"
+#include "vec3.h"
+#include <stdio.h>
+#include <math.h>
+#include <assert.h>
+
+void	parse_line(char *line, t_scene *scene);
+
+void	test_prepare_objects()
+{
+	t_scene		scene = {0};
+	t_plane		*pl;
+	t_sphere	*sp;
+
+	parse_line("pl 0,0,0 0,3,4 255,0,0", &scene);
+	parse_line("sp 0,0,0 4 255,0,0", &scene);
+	prepare_scene(&scene);
+	sp = scene.objects->object;
+	pl = scene.objects->next->object;
+	assert(sp->radius2 == 4.0);
+	assert(fabs(pl->normal.y - 0.6) < 1e-6);
+	assert(fabs(pl->normal.z - 0.8) < 1e-6);
+	printf("test_prepare_objects: OK\n");
+}
+
+void	test_prepare_cylinder()
+{
+	t_scene		scene = {0};
+	t_cylinder	*cy;
+
+	parse_line("cy 0,0,0 0,0,2 3 5 255,0,0", &scene);
+	prepare_scene(&scene);
+	cy = scene.objects->object;
+	assert(cy->axis.z == 1.0);
+	assert(cy->radius == 1.5);
+	assert(cy->half_height == 2.5);
+	assert(fabs(vec3_dot(cy->u, cy->axis)) < 1e-6);
+	assert(fabs(vec3_dot(cy->v, cy->axis)) < 1e-6);
+	assert(fabs(vec3_dot(cy->u, cy->v)) < 1e-6);
+	assert(fabs(vec3_length(cy->v) - 1.0) < 1e-6);
+	printf("test_prepare_cylinder: OK\n");
+}
+
+void	test_prepare_lights()
+{
+	t_scene	scene = {0};
+
+	parse_line("A 0.5 255,255,255", &scene);
+	parse_line("L 0,10,0 0.25 255,0,255", &scene);
+	parse_line("C 0,0,0 0,0,5 90", &scene);
+	prepare_scene(&scene);
+	assert(scene.ambient_light->term.x == 0.5);
+	assert(scene.lights->radiance.x == 0.25);
+	assert(scene.lights->radiance.y == 0.0);
+	assert(scene.camera.forward.z == 1.0);
+	assert(fabs(scene.camera.tan_half_fov - 1.0) < 1e-6);
+	printf("test_prepare_lights: OK\n");
+}
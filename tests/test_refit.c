@@ -0,0 +1,115 @@
+#include "minirt.h"
+#include "accel.h"
+#include "vec3.h"
+#include <stdio.h>
+#include <math.h>
+#include <assert.h>
+
+void	parse_line(char *line, t_scene *scene);
+
+static void	add_spheres(t_scene *scene, int n)
+{
+	char	line[128];
+	int		i;
+
+	i = 0;
+	while (i < n)
+	{
+		snprintf(line, sizeof(line), "sp %g,%g,%g 0.6 255,0,0",
+			fmod(i * 7.31, 20) - 10, fmod(i * 3.17, 16) - 8,
+			fmod(i * 5.53, 20) + 5);
+		parse_line(line, scene);
+		i++;
+	}
+	parse_line("cy 0,0,12 0,1,0 2 6 255,0,0", scene);
+	parse_line("pl 0,-9,0 0,1,0 255,255,255", scene);
+}
+
+static void	check_against_list(t_scene *scene)
+{
+	t_accel		*acc;
+	t_ray		ray;
+	t_hit		fast;
+	t_hit		slow;
+	int			i;
+
+	acc = scene->accel;
+	ray.origin = vec3_new(0.5, 0.25, -5);
+	i = 0;
+	while (i < 3000)
+	{
+		ray.direction = vec3_normalize(vec3_new(
+					sin(i * 0.37) * 0.9, cos(i * 0.61) * 0.7, 1));
+		scene->accel = acc;
+		fast = find_closest_intersection(scene, ray);
+		scene->accel = NULL;
+		slow = find_closest_intersection(scene, ray);
+		assert(fast.object == slow.object);
+		assert(!fast.object || fabs(fast.t - slow.t) < 1e-9);
+		i++;
+	}
+	scene->accel = acc;
+}
+
+static int	move_spheres(t_scene *scene, int step, double dist)
+{
+	t_object	*moved[256];
+	t_object	*obj;
+	int			n;
+
+	n = 0;
+	obj = scene->objects;
+	while (obj && n < 256)
+	{
+		if (obj->type == OBJ_SPHERE && n * step % 7 == 0)
+			((t_sphere *)obj->object)->center.x += dist * sin(n);
+		if (obj->type == OBJ_SPHERE || obj->type == OBJ_PLANE)
+			moved[n++] = obj;
+		obj = obj->next;
+	}
+	return (scene_update(scene, moved, n));
+}
+
+void	test_refit_matches_list()
+{
+	t_scene		scene = {0};
+
+	scene.accel_mode = ACCEL_BVH;
+	scene.refit_limit = 1e9;
+	add_spheres(&scene, 150);
+	prepare_scene(&scene);
+	assert(move_spheres(&scene, 1, 0.3) == !BVH_WIDE);
+	check_against_list(&scene);
+	assert(move_spheres(&scene, 3, 15) == !BVH_WIDE);
+	check_against_list(&scene);
+	scene.refit_limit = 0;
+	assert(move_spheres(&scene, 1, 0.1) == 0);
+	check_against_list(&scene);
+	scene.accel_mode = ACCEL_GRID;
+	prepare_scene(&scene);
+	assert(move_spheres(&scene, 1, 0.1) == 0);
+	assert(scene.accel->kind == ACCEL_GRID);
+	printf("test_refit_matches_list: OK\n");
+}
+
+void	test_refit_rebuilds_subtree()
+{
+	t_scene		scene = {0};
+	t_accel		*acc;
+
+	scene.accel_mode = ACCEL_BVH;
+	scene.refit_limit = REFIT_DEFAULT_LIMIT;
+	add_spheres(&scene, 150);
+	prepare_scene(&scene);
+	acc = scene.accel;
+	if (BVH_WIDE)
+		return ;
+	assert(accel_refit(acc, NULL, 0, scene.refit_limit));
+	assert(bvh_rebuild_subtree(acc, acc->nodes[0].child + 1));
+	check_against_list(&scene);
+	move_spheres(&scene, 2, 3);
+	check_against_list(&scene);
+	move_spheres(&scene, 5, -40);
+	check_against_list(&scene);
+	printf("test_refit_rebuilds_subtree: OK\n");
+}
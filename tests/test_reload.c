@@ -0,0 +1,166 @@
+#include "minirt.h"
+#include "render.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <assert.h>
+
+#define WATCH_PATH "/tmp/minirt_test_watch.rt"
+
+void	parse_line(char *line, t_scene *scene);
+
+static const char	*g_base = "A 0.2 255,255,255\nC 0,1,-12 0,0,1 70\n"
+	"pl 0,-3,0 0,1,0 200,200,200\nsp -4,1,9 3 0,255,0\n"
+	"cy 4,-1,6 0,1,0.3 2 5 0,0,255\n";
+
+static void	write_scene(const char *light, const char *extra, int rename_it)
+{
+	FILE	*file;
+
+	file = fopen(rename_it ? WATCH_PATH ".tmp" : WATCH_PATH, "w");
+	fprintf(file, "%s%s%s", g_base, light, extra);
+	fclose(file);
+	if (rename_it)
+		rename(WATCH_PATH ".tmp", WATCH_PATH);
+}
+
+static t_scene	*diff_scene(const char *extra)
+{
+	t_scene	*scene;
+
+	scene = calloc(1, sizeof(t_scene));
+	parse_line("A 0.2 255,255,255", scene);
+	parse_line("C 0,1,-12 0,0,1 70", scene);
+	parse_line("L -10,10,-10 0.7 255,255,255", scene);
+	parse_line("sp 0,0,5 6 255,0,0", scene);
+	parse_line("pl 0,-3,0 0,1,0 200,200,200", scene);
+	parse_line((char *)extra, scene);
+	return (scene);
+}
+
+void	test_scene_diff()
+{
+	t_scene		*scene;
+	t_object	*moved[4];
+	t_object	*old[4];
+	t_scene		*fresh;
+
+	scene = diff_scene("cy 4,-1,6 0,1,0.3 2 5 0,0,255");
+	prepare_scene(scene);
+	assert(scene_diff(scene, diff_scene("cy 4,-1,6 0,1,0.3 2 5 0,0,255")) == 0);
+	assert(scene_diff(scene, diff_scene("cy 4,-1,6 0,1,0.3 2 5 0,0,250"))
+		== DIFF_OBJECTS);
+	assert(scene_diff(scene, diff_scene("sp 4,-1,6 2 0,0,255")) == DIFF_SHAPE);
+	assert(scene_diff(scene, diff_scene("L 1,1,1 0.5 255,255,255"))
+		== (DIFF_LIGHTS | DIFF_SHAPE));
+	assert(scene_diff(scene, diff_scene("C 0,1,-11 0,0,1 70"))
+		== (DIFF_CAMERA | DIFF_SHAPE));
+	fresh = diff_scene("cy 4,-1,7 0,1,0.3 2 5 0,0,255");
+	assert(scene_diff(scene, fresh) == DIFF_OBJECTS);
+	assert(scene_adopt_objects(scene, fresh, moved, old) == 1);
+	assert(moved[0]->type == OBJ_CYLINDER && old[0]->type == OBJ_CYLINDER);
+	assert(((t_cylinder *)moved[0]->object)->center.z == 7);
+	assert(((t_cylinder *)old[0]->object)->center.z == 6);
+	scene_adopt(scene, fresh, 0);
+	fresh = diff_scene("cy 4,-1,7 0,1,0.3 2 5 0,0,255");
+	parse_line("pl 1,0,0 0,1,0.3 255,255,255", fresh);
+	assert(scene_diff(scene, fresh) == DIFF_SHAPE);
+	scene_adopt(scene, fresh, DIFF_SHAPE);
+	fresh = diff_scene("cy 4,-1,7 0,1,0.3 2 5 0,0,255");
+	parse_line("pl 1,0,0 0,1,0.3 255,255,255", fresh);
+	assert(scene_diff(scene, fresh) == 0);
+	scene_adopt(scene, fresh, 0);
+	free_scene(scene);
+	printf("test_scene_diff: OK\n");
+}
+
+static void	assert_same(int *pixels, t_scene *scene)
+{
+	t_mlx_data	full;
+	int			i;
+
+	full.img_data = malloc(sizeof(int) * WIDTH * HEIGHT);
+	render_scene(scene, &full);
+	i = 0;
+	while (i < WIDTH * HEIGHT)
+	{
+		assert(pixels[i] == full.img_data[i]);
+		i++;
+	}
+	free(full.img_data);
+}
+
+static void	settle(t_pool *p, int *pixels, t_scene *scene)
+{
+	int	done;
+
+	done = 0;
+	while (!done)
+	{
+		while (p->shown < TILE_COUNT)
+			pool_swap(p);
+		done = view_refine(p);
+	}
+	assert_same(pixels, scene);
+}
+
+static void	assert_file(int *pixels)
+{
+	t_scene	*fresh;
+
+	fresh = parse_scene(WATCH_PATH);
+	prepare_scene(fresh);
+	assert_same(pixels, fresh);
+	free_scene(fresh);
+}
+
+void	test_watch_reload()
+{
+	t_scene		*scene;
+	t_mlx_data	shown;
+	t_pool		*p;
+	t_watch		*w;
+	t_object	*kept;
+
+	write_scene("L -10,10,-10 0.7 255,255,255\n", "sp 0,0,5 6 255,0,0\n", 0);
+	scene = parse_scene(WATCH_PATH);
+	prepare_scene(scene);
+	shown.img_data = calloc(WIDTH * HEIGHT, sizeof(int));
+	p = pool_start(scene, &shown, 2);
+	assert(p && pool_gbuffer(p));
+	pool_render(p);
+	settle(p, shown.img_data, scene);
+	w = watch_start(WATCH_PATH, &scene->camera);
+	assert(w && !pool_watch(p, w));
+	write_scene("L -10,10,-10 0.7 255,255,255\n", "sp 0.5,0,5 6 255,0,0\n", 0);
+	assert(pool_watch(p, w) == DIFF_OBJECTS);
+	assert(p->shown > 0 && p->shown < TILE_COUNT);
+	settle(p, shown.img_data, scene);
+	assert_file(shown.img_data);
+	write_scene("L -10,10,-10 0.7 255,255,255\n", "sp 0.5,0,5 6 255,0,0\n", 1);
+	assert(pool_watch(p, w) == 0 && !pool_watch(p, w));
+	view_key(p, KEY_W);
+	settle(p, shown.img_data, scene);
+	write_scene("L 6,10,-10 0.7 255,255,255\n", "sp 0.5,0,5 6 255,0,0\n", 1);
+	assert(pool_watch(p, w) == DIFF_LIGHTS && p->frame.relight);
+	assert(scene->camera.position.z > -12);
+	settle(p, shown.img_data, scene);
+	write_scene("L 6,10,-10 0.7 255,255,255\n", "sp 0.5,0,5 6 255,0,0\n"
+		"sp 2,3,2 1 255,255,0\n", 0);
+	assert(pool_watch(p, w) == DIFF_SHAPE);
+	settle(p, shown.img_data, scene);
+	kept = scene->objects;
+	write_scene("L 6,10,-10 0.7 255,255,255\n", "sp 0.5,0,5 6 255,0,0\n"
+		"sp 2,3,2\n", 0);
+	assert(pool_watch(p, w) == 0 && scene->objects == kept);
+	write_scene("L 6,10,-10 0.7 255,255,255\nC 0,1,-14 0,0,1 70\n",
+		"sp 0.5,0,5 6 255,0,0\nsp 2,3,2 1 255,255,0\n", 0);
+	assert(pool_watch(p, w) == DIFF_CAMERA);
+	settle(p, shown.img_data, scene);
+	assert_file(shown.img_data);
+	watch_stop(w);
+	pool_stop(p);
+	free_scene(scene);
+	free(shown.img_data);
+	remove(WATCH_PATH);
+	printf("test_watch_reload: OK\n");
+}
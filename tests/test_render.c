@@ -0,0 +1,299 @@
+#include "minirt.h"
+#include "render.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+
+void	parse_line(char *line, t_scene *scene);
+
+static void	setup_scene(t_scene *scene)
+{
+	parse_line("A 0.2 255,255,255", scene);
+	parse_line("C 0,1,-12 0,0,1 70", scene);
+	parse_line("L -10,10,-10 0.7 255,255,255", scene);
+	parse_line("sp 0,0,5 6 255,0,0", scene);
+	parse_line("sp -4,1,9 3 0,255,0", scene);
+	parse_line("cy 4,-1,6 0,1,0.3 2 5 0,0,255", scene);
+	parse_line("pl 0,-3,0 0,1,0 200,200,200", scene);
+	prepare_scene(scene);
+}
+
+void	test_progressive_matches_full()
+{
+	t_scene		scene = {0};
+	t_mlx_data	full;
+	t_mlx_data	prog;
+	t_progress	*p;
+	int			i;
+
+	setup_scene(&scene);
+	full.img_data = malloc(sizeof(int) * WIDTH * HEIGHT);
+	prog.img_data = malloc(sizeof(int) * WIDTH * HEIGHT);
+	render_scene(&scene, &full);
+	i = 0;
+	while (i < WIDTH * HEIGHT)
+		prog.img_data[i++] = -1;
+	p = progress_start(&scene, &prog);
+	assert(progress_step(p, PROGRESSIVE_BATCH) == PROGRESSIVE_BATCH);
+	i = 0;
+	while (i < WIDTH * HEIGHT)
+		assert(prog.img_data[i++] != -1);
+	i = PROGRESSIVE_BATCH;
+	while (p->step > 0)
+		i += progress_step(p, 1000);
+	assert(i == WIDTH * HEIGHT);
+	i = 0;
+	while (i < WIDTH * HEIGHT)
+	{
+		assert(prog.img_data[i] == full.img_data[i]);
+		i++;
+	}
+	free(p);
+	free(full.img_data);
+	free(prog.img_data);
+	printf("test_progressive_matches_full: OK\n");
+}
+
+void	test_pool_matches_full()
+{
+	t_scene		scene = {0};
+	t_mlx_data	full;
+	t_mlx_data	shown;
+	t_pool		*p;
+	int			i;
+
+	setup_scene(&scene);
+	full.img_data = malloc(sizeof(int) * WIDTH * HEIGHT);
+	shown.img_data = calloc(WIDTH * HEIGHT, sizeof(int));
+	render_scene(&scene, &full);
+	p = pool_start(&scene, &shown, 3);
+	assert(p && p->n_threads == 3);
+	pool_render(p);
+	pool_render(p);
+	pool_cancel(p);
+	scene.camera.position.x += 1;
+	pool_render(p);
+	pool_cancel(p);
+	scene.camera.position.x -= 1;
+	pool_render(p);
+	while (p->shown < TILE_COUNT)
+		pool_swap(p);
+	assert(pool_swap(p) == 0);
+	i = 0;
+	while (i < WIDTH * HEIGHT)
+	{
+		assert(shown.img_data[i] == full.img_data[i]);
+		i++;
+	}
+	pool_render(p);
+	pool_stop(p);
+	free(full.img_data);
+	free(shown.img_data);
+	printf("test_pool_matches_full: OK\n");
+}
+
+void	test_view_scaling()
+{
+	t_scene		scene = {0};
+	t_frame		f;
+	t_pool		p;
+	t_vec3		start;
+
+	setup_scene(&scene);
+	start = scene.camera.position;
+	assert(camera_move(&scene, KEY_W) && !camera_move(&scene, KEY_ESC));
+	assert(scene.camera.position.z > start.z);
+	assert(camera_move(&scene, KEY_S) && camera_move(&scene, KEY_D));
+	assert(scene.camera.position.x > start.x);
+	frame_begin(&f, &scene, malloc(sizeof(int) * WIDTH * HEIGHT));
+	f.scale = 4;
+	render_tile(&f, TILE_COLS + 1);
+	assert(f.pixels[22 * WIDTH + 23] == f.pixels[20 * WIDTH + 20]);
+	assert(f.pixels[20 * WIDTH + 20] == render_sample(&f, 20, 20));
+	frame_end(&f);
+	free(f.pixels);
+	p.sample_ms = 0;
+	assert(view_scale(&p, VIEW_TARGET_MS) == VIEW_MAX_SCALE);
+	p.sample_ms = VIEW_TARGET_MS / (double)(WIDTH * HEIGHT);
+	assert(view_scale(&p, VIEW_TARGET_MS) == 1);
+	p.sample_ms *= 4.5;
+	assert(view_scale(&p, VIEW_TARGET_MS) == 4);
+	assert(view_scale(&p, 5 * VIEW_TARGET_MS) == 1);
+	p.sample_ms *= 1000;
+	assert(view_scale(&p, VIEW_TARGET_MS) == VIEW_MAX_SCALE);
+	printf("test_view_scaling: OK\n");
+}
+
+/* Returns the number of closest-hit queries the frame issued. */
+static long	render_history(t_scene *scene, int *pixels, t_history *h)
+{
+	t_frame	f;
+	int		queries[TILE_COUNT];
+	long	total;
+	int		tile;
+
+	frame_begin(&f, scene, pixels);
+	memset(queries, 0, sizeof(queries));
+	f.bins.queries = queries;
+	f.history = h;
+	history_reproject(h, &scene->camera, 1);
+	tile = 0;
+	while (tile < TILE_COUNT)
+		render_tile(&f, tile++);
+	frame_end(&f);
+	total = 0;
+	while (tile > 0)
+		total += queries[--tile];
+	return (total);
+}
+
+void	test_reprojection()
+{
+	t_scene		scene = {0};
+	t_history	h;
+	t_mlx_data	full;
+	int			*pixels;
+	long		queries;
+	int			i;
+
+	setup_scene(&scene);
+	full.img_data = malloc(sizeof(int) * WIDTH * HEIGHT);
+	pixels = malloc(sizeof(int) * WIDTH * HEIGHT);
+	assert(history_init(&h));
+	assert(render_history(&scene, pixels, &h) == WIDTH * HEIGHT);
+	assert(history_reused(&h, 1) == 0);
+	camera_move(&scene, KEY_A);
+	h.epoch++;
+	h.moving = 1;
+	queries = render_history(&scene, pixels, &h);
+	assert(history_reused(&h, 1) > WIDTH * HEIGHT / 4);
+	assert(queries == WIDTH * HEIGHT - history_reused(&h, 1));
+	h.moving = 0;
+	render_history(&scene, pixels, &h);
+	assert(history_reused(&h, 1) == 0);
+	render_scene(&scene, &full);
+	i = 0;
+	while (i < WIDTH * HEIGHT)
+	{
+		assert(pixels[i] == full.img_data[i]);
+		i++;
+	}
+	history_free(&h);
+	free(pixels);
+	free(full.img_data);
+	printf("test_reprojection: OK\n");
+}
+
+static void	assert_fresh(int *pixels, t_scene *scene)
+{
+	t_mlx_data	full;
+	int			i;
+
+	full.img_data = malloc(sizeof(int) * WIDTH * HEIGHT);
+	render_scene(scene, &full);
+	i = 0;
+	while (i < WIDTH * HEIGHT)
+	{
+		assert(pixels[i] == full.img_data[i]);
+		i++;
+	}
+	free(full.img_data);
+}
+
+static void	wait_frame(t_pool *p, int *pixels, t_scene *scene)
+{
+	while (p->shown < TILE_COUNT)
+		pool_swap(p);
+	assert_fresh(pixels, scene);
+}
+
+void	test_gbuffer_relight()
+{
+	t_scene		scene = {0};
+	t_mlx_data	shown;
+	t_pool		*p;
+	FILE		*file;
+
+	setup_scene(&scene);
+	shown.img_data = calloc(WIDTH * HEIGHT, sizeof(int));
+	p = pool_start(&scene, &shown, 2);
+	assert(p && pool_gbuffer(p));
+	pool_render(p);
+	wait_frame(p, shown.img_data, &scene);
+	assert(view_refine(p) && p->gbuf_valid);
+	file = fopen("/tmp/minirt_test_relight.rt", "w");
+	fprintf(file, "A 0.5 255,200,200\nC 0,0,0 0,0,1 90\n"
+		"L 10,8,-6 0.9 200,255,255\nL -8,4,0 0.3 255,255,255\n");
+	fclose(file);
+	pool_cancel(p);
+	assert(scene_reload_lights(&scene, "/tmp/minirt_test_relight.rt"));
+	assert(!scene_reload_lights(&scene, "/tmp/minirt_no_such_file.rt"));
+	assert(scene.camera.position.z == -12 && scene.lights->next);
+	pool_relight(p);
+	assert(p->frame.relight);
+	wait_frame(p, shown.img_data, &scene);
+	view_key(p, KEY_W);
+	assert(!p->gbuf_valid && !p->frame.relight);
+	pool_relight(p);
+	assert(!p->frame.relight);
+	wait_frame(p, shown.img_data, &scene);
+	remove("/tmp/minirt_test_relight.rt");
+	pool_stop(p);
+	free(shown.img_data);
+	printf("test_gbuffer_relight: OK\n");
+}
+
+static t_object	*move_small_sphere(t_scene *scene, char *dirty, double dx)
+{
+	t_object	*obj;
+
+	obj = scene->objects;
+	while (obj->type != OBJ_SPHERE
+		|| ((t_sphere *)obj->object)->radius > 2)
+		obj = obj->next;
+	damage_object(dirty, scene, obj);
+	((t_sphere *)obj->object)->center.x += dx;
+	scene_update(scene, &obj, 1);
+	damage_object(dirty, scene, obj);
+	return (obj);
+}
+
+void	test_damage_tiles()
+{
+	t_scene		scene = {0};
+	t_mlx_data	shown;
+	t_frame		f;
+	t_pool		*p;
+	char		dirty[TILE_COUNT] = {0};
+	int			count;
+	int			i;
+
+	setup_scene(&scene);
+	shown.img_data = malloc(sizeof(int) * WIDTH * HEIGHT);
+	render_scene(&scene, &shown);
+	move_small_sphere(&scene, dirty, 0.7);
+	frame_begin(&f, &scene, shown.img_data);
+	count = 0;
+	i = 0;
+	while (i < TILE_COUNT)
+	{
+		if (dirty[i])
+			render_tile(&f, i);
+		count += dirty[i++];
+	}
+	frame_end(&f);
+	assert(count > 0 && count < TILE_COUNT / 2);
+	assert_fresh(shown.img_data, &scene);
+	p = pool_start(&scene, &shown, 2);
+	pool_render(p);
+	wait_frame(p, shown.img_data, &scene);
+	damage_begin(p);
+	move_small_sphere(&scene, p->dirty, -0.7);
+	pool_damage(p);
+	assert(p->shown > TILE_COUNT / 2 && p->shown < TILE_COUNT);
+	wait_frame(p, shown.img_data, &scene);
+	pool_stop(p);
+	free(shown.img_data);
+	printf("test_damage_tiles: OK\n");
+}
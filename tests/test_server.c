@@ -0,0 +1,260 @@
+#include "server.h"
+#include "render.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <assert.h>
+#include <utime.h>
+#include <time.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+
+void	parse_line(char *line, t_scene *scene);
+
+#define SCENE_TEXT "A 0.2 255,255,255\nC 0,1,-12 0,0,1 70\n" \
+	"L -10,10,-10 0.7 255,255,255\nsp 0,0,5 6 255,0,0\n" \
+	"cy 4,-1,6 0,1,0.3 2 5 0,0,255\npl 0,-3,0 0,1,0 200,200,200\n"
+
+static void	write_file(char *path, char *text)
+{
+	FILE	*f;
+
+	f = fopen(path, "w");
+	assert(f);
+	fputs(text, f);
+	fclose(f);
+}
+
+static void	request(t_server *s, char *text, char *reply, size_t size)
+{
+	struct sockaddr_un	addr;
+	int					fd;
+	int					tries;
+	ssize_t				n;
+
+	memset(&addr, 0, sizeof(addr));
+	addr.sun_family = AF_UNIX;
+	strcpy(addr.sun_path, s->path);
+	fd = socket(AF_UNIX, SOCK_STREAM, 0);
+	assert(connect(fd, (struct sockaddr *)&addr, sizeof(addr)) == 0);
+	assert(write(fd, text, strlen(text)) == (ssize_t)strlen(text));
+	tries = 0;
+	while (!server_step(s, 100) && tries < 20)
+		tries++;
+	n = read(fd, reply, size - 1);
+	assert(n > 0);
+	reply[n] = '\0';
+	close(fd);
+}
+
+static unsigned char	*read_bmp(char *path, long *len)
+{
+	FILE			*f;
+	unsigned char	*buf;
+
+	f = fopen(path, "rb");
+	assert(f);
+	fseek(f, 0, SEEK_END);
+	*len = ftell(f);
+	fseek(f, 0, SEEK_SET);
+	buf = malloc(*len);
+	assert(fread(buf, 1, *len, f) == (size_t)*len);
+	fclose(f);
+	return (buf);
+}
+
+void	test_server_jobs()
+{
+	t_server	s;
+	t_job		job;
+	char		req[256];
+
+	strcpy(req, "scene a.rt\nsize 200 150\npriority 3\naa\n\n");
+	assert(!job_parse(req, &job));
+	assert(!strcmp(job.scene, "a.rt") && job.width == 200);
+	assert(job.height == 150 && job.priority == 3 && job.aa);
+	job_free(&job);
+	strcpy(req, "> sp 0,0,5 1 255,0,0\n> C 0,0,0 0,0,1 70\n\n");
+	assert(!job_parse(req, &job));
+	assert(!strcmp(job.text, "sp 0,0,5 1 255,0,0\nC 0,0,0 0,0,1 70\n"));
+	assert(job.width == WIDTH && job.height == HEIGHT && !job.scene);
+	job_free(&job);
+	strcpy(req, "scene a.rt\nsize 801 10\n");
+	assert(job_parse(req, &job));
+	job_free(&job);
+	strcpy(req, "scene a.rt\n> sp 0,0,5 1 255,0,0\n");
+	assert(job_parse(req, &job));
+	job_free(&job);
+	strcpy(req, "scene a.rt\nbogus\n");
+	assert(job_parse(req, &job));
+	job_free(&job);
+	strcpy(req, "shutdown\n");
+	assert(!job_parse(req, &job) && job.quit);
+	job_free(&job);
+	memset(&s, 0, sizeof(s));
+	job.fd = -1;
+	job.output = NULL;
+	job.priority = 0;
+	assert(job_push(&s, &job));
+	job.output = NULL;
+	job.priority = 5;
+	assert(job_push(&s, &job));
+	job.output = NULL;
+	job.priority = 0;
+	assert(job_push(&s, &job));
+	assert(job_pop(&s, &job) && job.seq == 1);
+	free(job.output);
+	assert(job_pop(&s, &job) && job.seq == 0);
+	free(job.output);
+	assert(job_pop(&s, &job) && job.seq == 2);
+	assert(!strncmp(job.output, SERVER_SHM_DIR "/miniRT-", 9));
+	free(job.output);
+	assert(!job_pop(&s, &job));
+	printf("test_server_jobs: OK\n");
+}
+
+static void	check_full_render(t_server *s, char *scene_path)
+{
+	t_scene			*scene;
+	t_mlx_data		data;
+	unsigned char	*a;
+	unsigned char	*b;
+	long			len[2];
+
+	scene = parse_scene(scene_path);
+	prepare_scene(scene);
+	data.img_data = malloc(sizeof(int) * WIDTH * HEIGHT);
+	render_scene(scene, &data);
+	assert(bmp_write(data.img_data, WIDTH, HEIGHT, "/tmp/minirt_direct.bmp"));
+	a = read_bmp("/tmp/minirt_direct.bmp", &len[0]);
+	b = read_bmp("/tmp/minirt_served.bmp", &len[1]);
+	assert(len[0] == len[1] && len[0] == 54 + WIDTH * HEIGHT * 3);
+	assert(!memcmp(a, b, len[0]));
+	assert(s->hits == 0);
+	free(a);
+	free(b);
+	free(data.img_data);
+	free_scene(scene);
+	unlink("/tmp/minirt_direct.bmp");
+}
+
+static void	check_thumbnail(char *scene_path, int aa)
+{
+	t_scene			*scene;
+	t_mlx_data		data;
+	unsigned char	*b;
+	long			len;
+	int				*thumb;
+
+	scene = parse_scene(scene_path);
+	parse_line("C 2,1,-12 0,0,1 60", scene);
+	prepare_scene(scene);
+	scene->antialias = aa;
+	data.img_data = malloc(sizeof(int) * WIDTH * HEIGHT);
+	thumb = malloc(sizeof(int) * 200 * 150);
+	render_scene(scene, &data);
+	if (aa)
+		image_downscale(data.img_data, thumb, 200, 150);
+	else
+		render_thumbnail(scene, thumb, 200, 150);
+	b = read_bmp("/tmp/minirt_served.bmp", &len);
+	assert(len == 54 + 600 * 150);
+	len = 0;
+	while (len < 200 * 150)
+	{
+		assert(b[54 + (149 - len / 200) * 600 + len % 200 * 3 + 2]
+			== ((thumb[len] >> 16) & 0xFF));
+		assert(b[54 + (149 - len / 200) * 600 + len % 200 * 3]
+			== (thumb[len] & 0xFF));
+		len++;
+	}
+	free(b);
+	free(thumb);
+	free(data.img_data);
+	free_scene(scene);
+}
+
+static void	check_thumbnail_full(char *scene_path)
+{
+	t_scene			*scene;
+	t_mlx_data		data;
+	int				*thumb;
+	int				i;
+
+	scene = parse_scene(scene_path);
+	prepare_scene(scene);
+	data.img_data = malloc(sizeof(int) * WIDTH * HEIGHT);
+	thumb = malloc(sizeof(int) * WIDTH * HEIGHT);
+	render_scene(scene, &data);
+	render_thumbnail(scene, thumb, WIDTH, HEIGHT);
+	image_downscale(data.img_data, data.img_data, WIDTH, HEIGHT);
+	i = 0;
+	while (i < WIDTH * HEIGHT)
+	{
+		assert(thumb[i] == data.img_data[i]);
+		i++;
+	}
+	free(thumb);
+	free(data.img_data);
+	free_scene(scene);
+}
+
+void	test_server_render()
+{
+	t_server	*s;
+	char		reply[256];
+	char		path[64];
+	char		req[512];
+	struct utimbuf	t;
+
+	snprintf(path, sizeof(path), "/tmp/minirt_server_%d.rt", (int)getpid());
+	write_file(path, SCENE_TEXT);
+	unlink("/tmp/minirt_test.sock");
+	s = server_open("/tmp/minirt_test.sock");
+	assert(s && !server_open("/tmp/minirt_test.sock"));
+	snprintf(req, sizeof(req), "scene %s\noutput /tmp/minirt_served.bmp\n\n",
+		path);
+	request(s, req, reply, sizeof(reply));
+	assert(!strcmp(reply, "ok /tmp/minirt_served.bmp\n"));
+	check_full_render(s, path);
+	snprintf(req, sizeof(req), "scene %s\ncamera 2,1,-12 0,0,1 60\n"
+		"size 200 150\noutput /tmp/minirt_served.bmp\n\n", path);
+	request(s, req, reply, sizeof(reply));
+	assert(s->hits == 1);
+	check_thumbnail(path, 0);
+	check_thumbnail_full(path);
+	snprintf(req, sizeof(req), "scene %s\ncamera 2,1,-12 0,0,1 60\naa\n"
+		"size 200 150\noutput /tmp/minirt_served.bmp\n\n", path);
+	request(s, req, reply, sizeof(reply));
+	assert(s->hits == 2);
+	check_thumbnail(path, 1);
+	write_file(path, "sp 0,0,5 1 255,0,0\n" SCENE_TEXT);
+	t.actime = time(NULL) + 10;
+	t.modtime = t.actime;
+	utime(path, &t);
+	request(s, req, reply, sizeof(reply));
+	assert(s->hits == 2 && !strncmp(reply, "ok ", 3));
+	strcpy(req, "> A 0.2 255,255,255\n> C 0,1,-12 0,0,1 70\n"
+		"> sp 0,0,5 6 255,0,0\nsize 8 6\n\n");
+	request(s, req, reply, sizeof(reply));
+	assert(!strncmp(reply, "ok " SERVER_SHM_DIR "/miniRT-", 11));
+	unlink(reply + 3);
+	request(s, req, reply, sizeof(reply));
+	assert(s->hits == 3);
+	unlink(reply + 3);
+	request(s, "scene /nonexistent.rt\n\n", reply, sizeof(reply));
+	assert(!strcmp(reply, "error cannot read scene\n"));
+	request(s, "> A 0.2 255,255,255\n> sp\n\n", reply, sizeof(reply));
+	assert(!strcmp(reply, "error cannot read scene\n"));
+	request(s, "size 1 1\n\n", reply, sizeof(reply));
+	assert(!strncmp(reply, "error ", 6));
+	request(s, "shutdown\n\n", reply, sizeof(reply));
+	assert(!strcmp(reply, "ok shutdown\n") && s->quit);
+	server_close(s);
+	assert(access("/tmp/minirt_test.sock", F_OK) != 0);
+	unlink(path);
+	unlink("/tmp/minirt_served.bmp");
+	printf("test_server_render: OK\n");
+}
@@ -0,0 +1,110 @@
+#include "minirt.h"
+#include "accel.h"
+#include "render.h"
+#include <stdio.h>
+#include <math.h>
+#include <stdlib.h>
+#include <assert.h>
+
+void	parse_line(char *line, t_scene *scene);
+
+static void	add_objects(t_scene *scene, int n)
+{
+	char	line[128];
+	int		i;
+
+	i = 0;
+	while (i < n)
+	{
+		snprintf(line, sizeof(line), "sp %g,%g,%g %g 255,0,0",
+			fmod(i * 7.31, 30) - 15, fmod(i * 3.17, 20) - 10,
+			fmod(i * 5.53, 40) - 10, 0.2 + fmod(i * 0.37, 1.5));
+		parse_line(line, scene);
+		i++;
+	}
+	parse_line("cy 0,0,8 1,1,0 2 30 255,0,0", scene);
+	parse_line("pl 0,-9,0 0,1,0 255,255,255", scene);
+}
+
+static int	compare_pixels(t_scene *scene)
+{
+	t_tile_bins	bins;
+	t_ray		ray;
+	t_hit		fast;
+	t_hit		slow;
+	int			ij[2];
+	int			used;
+
+	if (!tile_bins_build(&bins, scene))
+		return (-1);
+	used = 0;
+	ij[0] = 0;
+	while (ij[0] < TILE_COUNT)
+		used += bins.count[ij[0]++] >= 0;
+	ij[1] = -1;
+	while (++ij[1] < HEIGHT)
+	{
+		ij[0] = -1;
+		while (++ij[0] < WIDTH)
+		{
+			ray = get_ray(&scene->camera, ij[0], ij[1], WIDTH);
+			fast = tile_closest(scene, &bins, ij[1] / TILE_SIZE
+					* TILE_COLS + ij[0] / TILE_SIZE, ray);
+			slow = find_closest_intersection(scene, ray);
+			assert(fast.object == slow.object);
+			assert(!fast.object || fabs(fast.t - slow.t) < 1e-9);
+		}
+	}
+	tile_bins_free(&bins);
+	return (used);
+}
+
+void	test_tiles_match_accel()
+{
+	t_scene		scene = {0};
+
+	parse_line("C 0,0,-12 0,0,1 70", &scene);
+	add_objects(&scene, 120);
+	prepare_scene(&scene);
+	assert(compare_pixels(&scene) > 0);
+	parse_line("C 2,1,8 0.3,-0.2,1 100", &scene);
+	prepare_scene(&scene);
+	assert(compare_pixels(&scene) > 0);
+	add_objects(&scene, 20000);
+	prepare_scene(&scene);
+	assert(compare_pixels(&scene) == -1);
+	printf("test_tiles_match_accel: OK\n");
+}
+
+void	test_pixel_order()
+{
+	int		lut[TILE_SIZE * TILE_SIZE];
+	int		seen[TILE_SIZE * TILE_SIZE];
+	int		order;
+	int		k;
+
+	order = ORDER_TILE;
+	while (order <= ORDER_HILBERT)
+	{
+		pixel_order_table(order, lut);
+		k = -1;
+		while (++k < TILE_SIZE * TILE_SIZE)
+			seen[k] = 0;
+		k = -1;
+		while (++k < TILE_SIZE * TILE_SIZE)
+			seen[lut[k]]++;
+		k = -1;
+		while (++k < TILE_SIZE * TILE_SIZE)
+			assert(seen[k] == 1);
+		order++;
+	}
+	k = 0;
+	while (++k < TILE_SIZE * TILE_SIZE)
+		assert(abs(lut[k] % TILE_SIZE - lut[k - 1] % TILE_SIZE)
+			+ abs(lut[k] / TILE_SIZE - lut[k - 1] / TILE_SIZE) == 1);
+	pixel_order_table(ORDER_MORTON, lut);
+	assert(lut[2] == TILE_SIZE && lut[3] == TILE_SIZE + 1 && lut[4] == 2);
+	assert(pixel_order_from_name("hilbert") == ORDER_HILBERT);
+	assert(pixel_order_from_name("spiral") == -1);
+	printf("test_pixel_order: OK\n");
+}
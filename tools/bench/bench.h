@@ -0,0 +1,80 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench.h                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef BENCH_H
+# define BENCH_H
+
+# include "minirt.h"
+# include "accel.h"
+
+# define BENCH_DEFAULT_RUNS 3
+# define BENCH_UPDATE_FRAMES 10
+# define BENCH_REPROJECT_FRAMES 10
+
+typedef struct s_bench_opts
+{
+	char	*scene_path;
+	char	*dump_path;
+	char	*compare_path;
+	int		runs;
+	int		accel_mode;
+	int		pixel_order;
+	int		progressive;
+	int		reproject;
+	int		relight;
+	int		damage;
+	int		antialias;
+	int		budget_ms;
+	double	move_pct;
+	double	refit_limit;
+}	t_bench_opts;
+
+typedef struct s_bench_result
+{
+	double				seconds;
+	long				rays;
+	unsigned long long	checksum;
+	size_t				accel_bytes;
+	char				*accel_kind;
+	long long			misses[2];
+}	t_bench_result;
+
+typedef struct s_image_diff
+{
+	int		max_channel;
+	double	mean_abs;
+	long	differing;
+}	t_image_diff;
+
+int					bench_usage(char *name);
+int					parse_bench_args(int argc, char **argv, t_bench_opts *opts);
+t_scene				*bench_prepare(t_bench_opts *opts);
+void				bench_modes(t_bench_opts *opts, t_scene *scene,
+					int *pixels);
+double				bench_now(void);
+unsigned long long	image_checksum(int *pixels, int count);
+int					dump_ppm(int *pixels, char *path);
+int					compare_ppm(int *pixels, char *path, t_image_diff *diff);
+long				fresh_diff(t_scene *scene, int *pixels);
+size_t				scene_accel_bytes(t_scene *scene);
+void				bench_update(t_scene *scene, double percent);
+void				bench_jitter(t_object **moved, int count, int frame);
+void				bench_progressive(t_scene *scene, int *pixels);
+void				bench_reproject(t_scene *scene, int *pixels);
+void				bench_relight(t_scene *scene, int *pixels);
+void				bench_damage(t_scene *scene, int *pixels);
+void				bench_aa(t_scene *scene, int *pixels);
+void				bench_budget(t_scene *scene, int *pixels, int ms);
+void				bench_counters_start(int *fd);
+void				bench_counters_stop(int *fd, long long *misses);
+
+#endif
@@ -0,0 +1,142 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_aa.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench.h"
+#include "render.h"
+#include <string.h>
+
+/*
+ * aa_uniform - 모든 픽셀을 AA_SAMPLES번 샘플링 (비교 기준)
+ * @f: 한 샘플씩 렌더링한 프레임
+ *
+ * 모든 픽셀을 가장자리로 표시하고 안티앨리어싱 단계를 돌립니다.
+ * 적응형과 같은 위치의 샘플이므로 가장자리 픽셀은 같은 색입니다.
+ *
+ * Return: 표시한 픽셀 수, 메모리가 없으면 -1
+ */
+static int	aa_uniform(t_frame *f)
+{
+	int	tile;
+
+	f->edges = malloc(WIDTH * HEIGHT);
+	if (!f->edges)
+		return (-1);
+	memset(f->edges, 1, WIDTH * HEIGHT);
+	tile = 0;
+	while (tile < TILE_COUNT)
+		render_tile(f, tile++);
+	free(f->edges);
+	f->edges = NULL;
+	return (WIDTH * HEIGHT);
+}
+
+/*
+ * aa_render - 한 샘플 프레임 뒤 안티앨리어싱 단계 렌더링
+ * @scene: 렌더링할 장면
+ * @pixels: 이미지 버퍼 (WIDTH × HEIGHT)
+ * @uniform: 1이면 모든 픽셀, 0이면 가장자리 픽셀만 다시 샘플링
+ * @ms: [0] 한 샘플 프레임 시간, [1] 안티앨리어싱 단계 시간 (출력)
+ *
+ * Return: 다시 샘플링한 픽셀 수, 메모리가 없으면 -1
+ */
+static int	aa_render(t_scene *scene, int *pixels, int uniform, double *ms)
+{
+	t_frame	f;
+	double	start;
+	int		tile;
+	int		count;
+
+	start = bench_now();
+	frame_begin(&f, scene, pixels);
+	f.gbuf = malloc(sizeof(t_hit) * WIDTH * HEIGHT);
+	tile = 0;
+	while (tile < TILE_COUNT)
+		render_tile(&f, tile++);
+	ms[0] = (bench_now() - start) * 1000;
+	start = bench_now();
+	if (uniform)
+		count = aa_uniform(&f);
+	else
+		count = render_antialias(&f);
+	ms[1] = (bench_now() - start) * 1000;
+	free(f.gbuf);
+	frame_end(&f);
+	return (count);
+}
+
+/*
+ * image_delta - 두 이미지의 다른 픽셀 수와 채널 최대 차이
+ * @a: 이미지 (WIDTH × HEIGHT)
+ * @b: 이미지 (WIDTH × HEIGHT)
+ * @max_channel: 채널 최대 차이 (출력)
+ *
+ * Return: 다른 픽셀 수
+ */
+static long	image_delta(int *a, int *b, int *max_channel)
+{
+	long	differing;
+	int		ch;
+	int		i;
+
+	*max_channel = 0;
+	differing = 0;
+	i = -1;
+	while (++i < WIDTH * HEIGHT)
+	{
+		differing += (a[i] != b[i]);
+		ch = 0;
+		while (ch < 24)
+		{
+			if (abs(((a[i] >> ch) & 255) - ((b[i] >> ch) & 255))
+				> *max_channel)
+				*max_channel = abs(((a[i] >> ch) & 255)
+						- ((b[i] >> ch) & 255));
+			ch += 8;
+		}
+	}
+	return (differing);
+}
+
+/*
+ * bench_aa - 가장자리만 안티앨리어싱할 때의 추가 샘플과 시간 측정
+ * @scene: prepare_scene이 끝난 장면
+ * @pixels: 렌더링할 이미지 버퍼 (WIDTH × HEIGHT, 끝나면 적응형 결과)
+ *
+ * 가장자리 픽셀 수와 추가 샘플 비율 (한 샘플 프레임 대비), 두
+ * 방법의 안티앨리어싱 시간, 모든 픽셀을 AA_SAMPLES번 샘플링한
+ * 이미지와 다른 픽셀 비율과 채널 최대 차이를 key=value 형식으로
+ * 출력합니다.
+ */
+void	bench_aa(t_scene *scene, int *pixels)
+{
+	int		*uniform;
+	double	ms[4];
+	int		count;
+	int		max_channel;
+	long	differing;
+
+	uniform = malloc(sizeof(int) * WIDTH * HEIGHT);
+	if (!uniform || aa_render(scene, uniform, 1, ms + 2) < 0)
+	{
+		free(uniform);
+		return ;
+	}
+	count = aa_render(scene, pixels, 0, ms);
+	differing = image_delta(pixels, uniform, &max_channel);
+	printf("aa_base_ms=%.3f\naa_edge_pixels=%d\n", ms[0], count);
+	printf("aa_extra_samples_pct=%.2f\n",
+		100.0 * count * AA_SAMPLES / ((double)WIDTH * HEIGHT));
+	printf("aa_ms=%.3f\naa_uniform_ms=%.3f\n", ms[1], ms[3]);
+	printf("aa_vs_uniform_pixels_pct=%.4f\naa_vs_uniform_max_channel=%d\n",
+		100.0 * differing / ((double)WIDTH * HEIGHT), max_channel);
+	free(uniform);
+}
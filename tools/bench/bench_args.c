@@ -0,0 +1,148 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_args.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench.h"
+#include "render.h"
+#include <string.h>
+
+/*
+ * bench_usage - 사용법 출력
+ * @name: 실행 파일 이름 (argv[0])
+ *
+ * Return: 1 (main의 종료 코드)
+ */
+int	bench_usage(char *name)
+{
+	printf("Error\nUsage: %s <scene.rt> [--runs N] [--dump out.ppm]"
+		" [--compare ref.ppm] [--accel auto|none|bvh|grid]"
+		" [--order tile|scanline|morton|hilbert] [--progressive]"
+		" [--reproject] [--relight] [--damage] [--aa] [--move PERCENT]"
+		" [--refit-limit X] [--time-budget 2s|500ms]\n", name);
+	return (1);
+}
+
+/*
+ * default_opts - 옵션의 기본값
+ * @opts: 채울 옵션
+ */
+static void	default_opts(t_bench_opts *opts)
+{
+	opts->scene_path = NULL;
+	opts->dump_path = NULL;
+	opts->compare_path = NULL;
+	opts->runs = BENCH_DEFAULT_RUNS;
+	opts->accel_mode = ACCEL_AUTO;
+	opts->pixel_order = ORDER_TILE;
+	opts->progressive = 0;
+	opts->reproject = 0;
+	opts->relight = 0;
+	opts->damage = 0;
+	opts->antialias = 0;
+	opts->budget_ms = 0;
+	opts->move_pct = 0;
+	opts->refit_limit = REFIT_DEFAULT_LIMIT;
+}
+
+/*
+ * parse_value - 값을 하나 받는 옵션 해석
+ * @flag: 옵션 이름 (--runs, --dump, --accel, --order, --move,
+ *        --refit-limit, --time-budget)
+ * @value: 옵션 값 (잘못된 이름이면 해당 필드가 -1)
+ * @opts: 해석 결과 (출력)
+ *
+ * Return: 1 (해석함), 0 (이 함수가 다루는 옵션이 아님)
+ */
+static int	parse_value(char *flag, char *value, t_bench_opts *opts)
+{
+	if (!strcmp(flag, "--runs"))
+		opts->runs = atoi(value);
+	else if (!strcmp(flag, "--dump"))
+		opts->dump_path = value;
+	else if (!strcmp(flag, "--accel"))
+		opts->accel_mode = accel_mode_from_name(value);
+	else if (!strcmp(flag, "--order"))
+		opts->pixel_order = pixel_order_from_name(value);
+	else if (!strcmp(flag, "--move"))
+		opts->move_pct = atof(value);
+	else if (!strcmp(flag, "--refit-limit"))
+		opts->refit_limit = atof(value);
+	else if (!strcmp(flag, "--time-budget"))
+		opts->budget_ms = budget_from_name(value);
+	else
+		return (0);
+	return (1);
+}
+
+/*
+ * parse_flag - 값이 없는 측정 옵션 해석
+ * @flag: 옵션 이름 (--progressive, --reproject, --relight, --damage, --aa)
+ * @opts: 해석 결과 (출력)
+ *
+ * Return: 1 (해석함), 0 (이 함수가 다루는 옵션이 아님)
+ */
+static int	parse_flag(char *flag, t_bench_opts *opts)
+{
+	if (!strcmp(flag, "--progressive"))
+		opts->progressive = 1;
+	else if (!strcmp(flag, "--reproject"))
+		opts->reproject = 1;
+	else if (!strcmp(flag, "--relight"))
+		opts->relight = 1;
+	else if (!strcmp(flag, "--damage"))
+		opts->damage = 1;
+	else if (!strcmp(flag, "--aa"))
+		opts->antialias = 1;
+	else
+		return (0);
+	return (1);
+}
+
+/*
+ * parse_bench_args - 벤치마크 커맨드 라인 인자 해석
+ * @argc: 인자 개수
+ * @argv: 인자 배열
+ * @opts: 해석 결과 (출력)
+ *
+ * 사용법: ./miniRT_bench <scene.rt> [--runs N] [--dump out.ppm]
+ *                        [--compare ref.ppm] [--accel auto|none|bvh|grid]
+ *                        [--order tile|scanline|morton|hilbert]
+ *                        [--progressive] [--reproject] [--relight]
+ *                        [--damage] [--aa]
+ *                        [--move PERCENT] [--refit-limit X]
+ *                        [--time-budget 2s|500ms]
+ *
+ * Return: 1 (성공), 0 (잘못된 인자)
+ */
+int	parse_bench_args(int argc, char **argv, t_bench_opts *opts)
+{
+	int	i;
+
+	default_opts(opts);
+	i = 0;
+	while (++i < argc)
+	{
+		if (!strcmp(argv[i], "--compare") && i + 1 < argc)
+			opts->compare_path = argv[++i];
+		else if (i + 1 < argc && parse_value(argv[i], argv[i + 1], opts))
+			i++;
+		else if (!parse_flag(argv[i], opts))
+		{
+			if (argv[i][0] == '-' || opts->scene_path)
+				return (0);
+			opts->scene_path = argv[i];
+		}
+	}
+	return (opts->scene_path && opts->runs > 0 && opts->accel_mode >= 0
+		&& opts->pixel_order >= 0 && opts->move_pct <= 100
+		&& opts->budget_ms >= 0);
+}
+
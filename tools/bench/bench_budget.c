@@ -0,0 +1,76 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_budget.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench.h"
+#include "render.h"
+#include <unistd.h>
+
+/*
+ * budget_loop - 창 없이 loop_hook처럼 작업 스레드 묶음을 돌리기
+ * @p: 첫 pool_render를 부른 묶음
+ *
+ * 옮긴 타일이 없으면 1 ms 쉬어 작업 스레드에 CPU를 양보합니다.
+ */
+static void	budget_loop(t_pool *p)
+{
+	int	done;
+
+	done = 0;
+	while (!done)
+	{
+		done = budget_expired(p);
+		if (pool_swap(p) > 0)
+			done = (done || (p->shown == TILE_COUNT && view_refine(p)));
+		else if (!done)
+			usleep(1000);
+	}
+}
+
+/*
+ * bench_budget - 시간 예산 안에 완성한 이미지와 걸린 시간 측정
+ * @scene: prepare_scene이 끝난 장면 (끝나면 antialias를 되돌림)
+ * @pixels: 결과 이미지 버퍼 (WIDTH × HEIGHT)
+ * @ms: 시간 예산 (밀리초)
+ *
+ * miniRT --time-budget처럼 낮은 해상도에서 시작해 마감까지 다듬고,
+ * 걸린 시간 (작업 스레드를 만들기 전부터), 마지막 프레임의 해상도와
+ * 안티앨리어싱 여부, 예산 없이 끝까지 렌더링한 이미지와 다른 픽셀
+ * 비율을 key=value 형식으로 출력합니다.
+ */
+void	bench_budget(t_scene *scene, int *pixels, int ms)
+{
+	t_mlx_data	data;
+	t_pool		*p;
+	double		start;
+	long		differing;
+
+	scene->antialias = 1;
+	data.img_data = pixels;
+	start = view_now();
+	p = pool_start(scene, &data, 0);
+	if (p && pool_gbuffer(p))
+	{
+		pool_budget(p, start, ms);
+		pool_render(p);
+		budget_loop(p);
+		printf("budget_ms=%d\nbudget_elapsed_ms=%.3f\n", ms,
+			view_now() - start);
+		printf("budget_scale=%d\nbudget_aa=%d\n", p->frame.scale,
+			p->frame.edges != NULL);
+		differing = fresh_diff(scene, pixels);
+		printf("budget_diff_pixels_pct=%.4f\n",
+			100.0 * differing / ((double)WIDTH * HEIGHT));
+	}
+	if (p)
+		pool_stop(p);
+	scene->antialias = 0;
+}
@@ -0,0 +1,140 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_compare.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench.h"
+#include <fcntl.h>
+#include <string.h>
+#include <unistd.h>
+
+/*
+ * load_ppm - dump_ppm으로 저장한 PPM(P6) 파일 읽기
+ * @path: 읽을 파일 경로
+ * @header_len: 헤더 길이 (출력, 픽셀 데이터의 시작 위치)
+ *
+ * 현재 빌드와 같은 해상도의 파일만 받아들입니다.
+ *
+ * Return: 헤더를 포함한 파일 전체 (malloc), 형식이 다르면 NULL
+ */
+static char	*load_ppm(char *path, int *header_len)
+{
+	char	header[32];
+	char	*buf;
+	ssize_t	len;
+	int		fd;
+
+	fd = open(path, O_RDONLY);
+	if (fd < 0)
+		return (NULL);
+	buf = read_file(fd, &len);
+	close(fd);
+	*header_len = snprintf(header, sizeof(header), "P6\n%d %d\n255\n",
+			WIDTH, HEIGHT);
+	if (buf && (len != *header_len + WIDTH * HEIGHT * 3
+			|| memcmp(buf, header, *header_len)))
+	{
+		free(buf);
+		buf = NULL;
+	}
+	return (buf);
+}
+
+/*
+ * diff_pixel - 한 픽셀의 채널별 차이를 누적
+ * @pixel: 현재 렌더링 결과 (0xRRGGBB)
+ * @ref: 기준 이미지의 RGB 바이트
+ * @diff: 누적할 비교 결과
+ */
+static void	diff_pixel(int pixel, unsigned char *ref, t_image_diff *diff)
+{
+	int	channel;
+	int	delta;
+	int	differs;
+
+	channel = 0;
+	differs = 0;
+	while (channel < 3)
+	{
+		delta = abs(((pixel >> (16 - channel * 8)) & 0xFF) - ref[channel]);
+		if (delta > diff->max_channel)
+			diff->max_channel = delta;
+		diff->mean_abs += delta;
+		if (delta)
+			differs = 1;
+		channel++;
+	}
+	diff->differing += differs;
+}
+
+/*
+ * compare_ppm - 렌더링 결과를 기준 PPM 이미지와 비교
+ * @pixels: WIDTH * HEIGHT 크기의 픽셀 버퍼
+ * @path: 기준 이미지 경로 (다른 빌드에서 --dump로 저장한 파일)
+ * @diff: 비교 결과 (출력)
+ *
+ * 체크섬은 같고 다름만 알려주므로, float 빌드처럼 결과가 조금씩
+ * 달라지는 경우에는 채널 최대 차이, 채널 평균 절대 차이,
+ * 달라진 픽셀 수로 얼마나 달라졌는지를 측정합니다.
+ *
+ * Return: 1 (성공), 0 (파일을 읽을 수 없거나 해상도가 다름)
+ */
+int	compare_ppm(int *pixels, char *path, t_image_diff *diff)
+{
+	char	*buf;
+	int		header_len;
+	int		i;
+
+	buf = load_ppm(path, &header_len);
+	if (!buf)
+		return (0);
+	diff->max_channel = 0;
+	diff->mean_abs = 0;
+	diff->differing = 0;
+	i = 0;
+	while (i < WIDTH * HEIGHT)
+	{
+		diff_pixel(pixels[i], (unsigned char *)buf + header_len + i * 3,
+			diff);
+		i++;
+	}
+	diff->mean_abs /= (double)WIDTH * HEIGHT * 3;
+	free(buf);
+	return (1);
+}
+
+/*
+ * fresh_diff - 이미지가 처음부터 렌더링한 이미지와 다른 픽셀 수
+ * @scene: 렌더링할 장면
+ * @pixels: 앞 프레임을 고쳐 만든 이미지 (G-버퍼, 바뀐 타일만 렌더링)
+ *
+ * Return: 다른 픽셀 수 (메모리가 없으면 -1)
+ */
+long	fresh_diff(t_scene *scene, int *pixels)
+{
+	t_mlx_data	full;
+	long		differing;
+	int			i;
+
+	full.img_data = malloc(sizeof(int) * WIDTH * HEIGHT);
+	if (!full.img_data)
+		return (-1);
+	render_scene(scene, &full);
+	differing = 0;
+	i = 0;
+	while (i < WIDTH * HEIGHT)
+	{
+		if (full.img_data[i] != pixels[i])
+			differing++;
+		i++;
+	}
+	free(full.img_data);
+	return (differing);
+}
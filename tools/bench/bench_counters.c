@@ -0,0 +1,95 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_counters.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench.h"
+#include <string.h>
+#include <unistd.h>
+#ifdef __linux__
+# include <linux/perf_event.h>
+# include <sys/syscall.h>
+#endif
+
+/*
+ * open_counter - 이 프로세스의 하드웨어 캐시 이벤트 카운터 열기
+ * @which: 0이면 L1 데이터 캐시 읽기 miss, 1이면 마지막 단계 캐시 miss
+ *
+ * 리눅스의 perf_event_open으로 사용자 공간 이벤트만 셉니다. 열자마자
+ * 세기 시작합니다. 리눅스가 아니거나, 가상 머신처럼 하드웨어
+ * 카운터가 없거나, perf_event_paranoid가 막으면 열 수 없습니다.
+ *
+ * Return: 카운터 fd, 열 수 없으면 -1
+ */
+#ifdef __linux__
+
+static int	open_counter(int which)
+{
+	struct perf_event_attr	attr;
+
+	memset(&attr, 0, sizeof(attr));
+	attr.size = sizeof(attr);
+	attr.type = PERF_TYPE_HARDWARE;
+	attr.config = PERF_COUNT_HW_CACHE_MISSES;
+	if (which == 0)
+	{
+		attr.type = PERF_TYPE_HW_CACHE;
+		attr.config = PERF_COUNT_HW_CACHE_L1D
+			| (PERF_COUNT_HW_CACHE_OP_READ << 8)
+			| (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+	}
+	attr.exclude_kernel = 1;
+	attr.exclude_hv = 1;
+	return (syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+}
+
+#else
+
+static int	open_counter(int which)
+{
+	(void)which;
+	return (-1);
+}
+
+#endif
+
+/*
+ * bench_counters_start - 캐시 miss 카운터 열기
+ * @fd: 카운터 fd 2개 (출력, open_counter 순서)
+ */
+void	bench_counters_start(int *fd)
+{
+	fd[0] = open_counter(0);
+	fd[1] = open_counter(1);
+}
+
+/*
+ * bench_counters_stop - 캐시 miss 카운터를 읽고 닫기
+ * @fd: bench_counters_start로 연 fd 2개
+ * @misses: 연 뒤로 센 miss 수 2개 (출력, 셀 수 없으면 -1)
+ */
+void	bench_counters_stop(int *fd, long long *misses)
+{
+	int	i;
+
+	i = 0;
+	while (i < 2)
+	{
+		misses[i] = -1;
+		if (fd[i] >= 0)
+		{
+			if (read(fd[i], &misses[i], sizeof(misses[i]))
+				!= sizeof(misses[i]))
+				misses[i] = -1;
+			close(fd[i]);
+		}
+		i++;
+	}
+}
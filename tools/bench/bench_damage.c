@@ -0,0 +1,110 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_damage.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench.h"
+#include "render.h"
+
+/*
+ * pick_middle - 옮길 물체 하나 고르기
+ * @scene: 장면
+ *
+ * 생성한 장면에서 가장자리 물체만 고르지 않도록 경계 상자가 있는
+ * 물체 중 목록의 가운데 것을 고릅니다.
+ *
+ * Return: 고른 물체, 경계 상자가 있는 물체가 없으면 NULL
+ */
+static t_object	*pick_middle(t_scene *scene)
+{
+	t_object	*obj;
+	t_aabb		box;
+	int			count;
+	int			k;
+
+	count = 0;
+	obj = scene->objects;
+	while (obj)
+	{
+		count += (prim_bounds(obj, &box) >= 0);
+		obj = obj->next;
+	}
+	k = 0;
+	obj = scene->objects;
+	while (obj && (prim_bounds(obj, &box) < 0 || k++ < count / 2))
+		obj = obj->next;
+	return (obj);
+}
+
+/*
+ * render_dirty - 표시한 타일만 렌더링
+ * @scene: 렌더링할 장면
+ * @pixels: 앞 프레임의 이미지 (표시한 타일만 덮어씀)
+ * @dirty: 타일별 표시 (damage_object)
+ * @count: 표시한 타일 수 (출력)
+ *
+ * Return: 렌더링 시간 (밀리초)
+ */
+static double	render_dirty(t_scene *scene, int *pixels, char *dirty,
+	int *count)
+{
+	t_frame	f;
+	double	start;
+	int		tile;
+
+	start = bench_now();
+	frame_begin(&f, scene, pixels);
+	*count = 0;
+	tile = 0;
+	while (tile < TILE_COUNT)
+	{
+		if (dirty[tile])
+			render_tile(&f, tile);
+		*count += dirty[tile++];
+	}
+	frame_end(&f);
+	return ((bench_now() - start) * 1000);
+}
+
+/*
+ * bench_damage - 물체 하나를 옮긴 뒤 바뀐 타일만 다시 렌더링
+ * @scene: prepare_scene이 끝난 장면 (물체는 옮긴 채로 남음)
+ * @pixels: 렌더링할 이미지 버퍼 (WIDTH × HEIGHT)
+ *
+ * 물체 하나를 자기 크기의 1/4만큼 옮기고 (bench_jitter, scene_update)
+ * 옛 자리와 새 자리로 표시한 타일만 렌더링합니다. 다시 렌더링한
+ * 타일의 비율과 시간, 처음부터 렌더링한 이미지와 다른 픽셀 수
+ * (0이어야 함)를 key=value 형식으로 출력합니다.
+ */
+void	bench_damage(t_scene *scene, int *pixels)
+{
+	t_mlx_data	data;
+	char		dirty[TILE_COUNT];
+	t_object	*obj;
+	double		ms;
+	int			count;
+
+	obj = pick_middle(scene);
+	if (!obj)
+		return ;
+	data.img_data = pixels;
+	render_scene(scene, &data);
+	count = 0;
+	while (count < TILE_COUNT)
+		dirty[count++] = 0;
+	damage_object(dirty, scene, obj);
+	bench_jitter(&obj, 1, 0);
+	scene_update(scene, &obj, 1);
+	damage_object(dirty, scene, obj);
+	ms = render_dirty(scene, pixels, dirty, &count);
+	printf("damage_tiles_pct=%.2f\n", 100.0 * count / TILE_COUNT);
+	printf("damage_ms=%.3f\n", ms);
+	printf("damage_diff_pixels=%ld\n", fresh_diff(scene, pixels));
+}
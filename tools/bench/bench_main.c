@@ -0,0 +1,155 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_main.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench.h"
+
+/*
+ * run_bench - 같은 장면을 여러 번 렌더링하여 가장 빠른 시간 측정
+ * @scene: 렌더링할 장면
+ * @data: 창 없이 픽셀 버퍼만 가진 MLX 데이터
+ * @runs: 반복 횟수
+ *
+ * 스케줄링 잡음을 줄이기 위해 평균이 아닌 최솟값을 사용합니다.
+ * 처리량은 카메라 광선(픽셀당 하나) 기준으로 계산합니다.
+ * 실제로 만든 가속 구조의 종류와 메모리, 모든 실행 동안의 캐시 miss
+ * 수(bench_counters.c)도 함께 기록합니다.
+ *
+ * Return: 가장 빠른 실행의 측정 결과
+ */
+static t_bench_result	run_bench(t_scene *scene, t_mlx_data *data, int runs)
+{
+	t_bench_result	best;
+	double			start;
+	double			elapsed;
+	int				fd[2];
+
+	best.seconds = -1;
+	best.rays = (long)WIDTH * HEIGHT;
+	bench_counters_start(fd);
+	while (runs-- > 0)
+	{
+		start = bench_now();
+		render_scene(scene, data);
+		elapsed = bench_now() - start;
+		if (best.seconds < 0 || elapsed < best.seconds)
+			best.seconds = elapsed;
+	}
+	bench_counters_stop(fd, best.misses);
+	best.checksum = image_checksum(data->img_data, WIDTH * HEIGHT);
+	best.accel_bytes = scene_accel_bytes(scene);
+	best.accel_kind = "none";
+	if (scene->accel)
+		best.accel_kind = accel_kind_name(scene->accel->kind);
+	return (best);
+}
+
+/*
+ * print_misses - 광선당 캐시 miss 수 출력
+ * @key: 출력할 이름
+ * @misses: 모든 실행 동안 센 miss 수 (-1이면 셀 수 없음)
+ * @rays: 모든 실행의 카메라 광선 수
+ */
+static void	print_misses(char *key, long long misses, double rays)
+{
+	if (misses < 0)
+		printf("%s=n/a\n", key);
+	else
+		printf("%s=%.4f\n", key, misses / rays);
+}
+
+/*
+ * print_report - 측정 결과를 key=value 형식으로 출력
+ * @opts: 벤치마크 옵션
+ * @res: 측정 결과
+ *
+ * 스크립트(tests/perf/perf_test.sh)가 쉽게 읽을 수 있는 형식입니다.
+ */
+static void	print_report(t_bench_opts *opts, t_bench_result res)
+{
+	printf("scene=%s\n", opts->scene_path);
+	printf("resolution=%dx%d\n", WIDTH, HEIGHT);
+	printf("runs=%d\n", opts->runs);
+	printf("seconds=%.6f\n", res.seconds);
+	printf("rays=%ld\n", res.rays);
+	printf("rays_per_sec=%.0f\n", res.rays / res.seconds);
+	printf("checksum=%016llx\n", res.checksum);
+	printf("accel=%s\n", res.accel_kind);
+	printf("accel_bytes=%zu\n", res.accel_bytes);
+	print_misses("l1d_misses_per_ray", res.misses[0],
+		(double)res.rays * opts->runs);
+	print_misses("llc_misses_per_ray", res.misses[1],
+		(double)res.rays * opts->runs);
+}
+
+/*
+ * write_outputs - 렌더링 결과 저장 및 기준 이미지와 비교
+ * @opts: 벤치마크 옵션 (dump_path, compare_path)
+ * @pixels: 렌더링 결과
+ *
+ * double 빌드에서 --dump로 저장한 이미지를 float 빌드에서
+ * --compare로 넘기면 정밀도에 따른 화질 차이를 확인할 수 있습니다.
+ * 차이는 key=value 형식으로 출력합니다.
+ *
+ * Return: 1 (성공), 0 (파일을 쓰거나 읽을 수 없음)
+ */
+static int	write_outputs(t_bench_opts *opts, int *pixels)
+{
+	t_image_diff	diff;
+
+	if (opts->dump_path && !dump_ppm(pixels, opts->dump_path))
+	{
+		printf("Error\nCannot write %s\n", opts->dump_path);
+		return (0);
+	}
+	if (!opts->compare_path)
+		return (1);
+	if (!compare_ppm(pixels, opts->compare_path, &diff))
+	{
+		printf("Error\nCannot compare with %s\n", opts->compare_path);
+		return (0);
+	}
+	printf("diff_max_channel=%d\n", diff.max_channel);
+	printf("diff_mean_abs=%.6f\n", diff.mean_abs);
+	printf("diff_pixels_pct=%.4f\n",
+		100.0 * diff.differing / ((double)WIDTH * HEIGHT));
+	return (1);
+}
+
+/*
+ * main - 창 없이 장면을 렌더링하는 벤치마크 진입점
+ * @argc: 인자 개수
+ * @argv: 인자 배열
+ *
+ * MLX 없이 픽셀 버퍼만 할당하여 render_scene을 실행하므로
+ * X 서버가 없는 환경(CI 등)에서도 동작합니다.
+ *
+ * Return: 0 (성공), 1 (실패)
+ */
+int	main(int argc, char **argv)
+{
+	t_bench_opts	opts;
+	t_scene			*scene;
+	t_mlx_data		data;
+	int				ok;
+
+	if (!parse_bench_args(argc, argv, &opts))
+		return (bench_usage(argv[0]));
+	scene = bench_prepare(&opts);
+	data.img_data = malloc(sizeof(int) * WIDTH * HEIGHT);
+	if (!scene || !data.img_data)
+		return (1);
+	print_report(&opts, run_bench(scene, &data, opts.runs));
+	ok = write_outputs(&opts, data.img_data);
+	bench_modes(&opts, scene, data.img_data);
+	free(data.img_data);
+	return (!ok);
+}
@@ -0,0 +1,60 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_modes.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench.h"
+
+/*
+ * bench_prepare - 장면을 파싱하고 설정 옵션을 적용해 준비
+ * @opts: 해석한 옵션 (장면 경로, --accel, --order, --refit-limit)
+ *
+ * Return: prepare_scene이 끝난 장면, 파싱할 수 없으면 NULL
+ */
+t_scene	*bench_prepare(t_bench_opts *opts)
+{
+	t_scene	*scene;
+
+	scene = parse_scene(opts->scene_path);
+	if (!scene)
+		return (NULL);
+	scene->accel_mode = opts->accel_mode;
+	scene->refit_limit = opts->refit_limit;
+	scene->pixel_order = opts->pixel_order;
+	prepare_scene(scene);
+	return (scene);
+}
+
+/*
+ * bench_modes - 기본 측정 뒤에 고른 측정 방식들을 차례로 실행
+ * @opts: 해석한 옵션 (--progressive, --reproject, --relight, --damage,
+ *        --aa, --time-budget, --move)
+ * @scene: prepare_scene이 끝난 장면
+ * @pixels: 이미지 버퍼 (WIDTH × HEIGHT)
+ *
+ * 각 방식은 결과를 key=value 형식으로 출력합니다. --move는 장면을
+ * 바꾸므로 마지막에 실행합니다.
+ */
+void	bench_modes(t_bench_opts *opts, t_scene *scene, int *pixels)
+{
+	if (opts->progressive)
+		bench_progressive(scene, pixels);
+	if (opts->reproject)
+		bench_reproject(scene, pixels);
+	if (opts->relight)
+		bench_relight(scene, pixels);
+	if (opts->damage)
+		bench_damage(scene, pixels);
+	if (opts->antialias)
+		bench_aa(scene, pixels);
+	if (opts->budget_ms > 0)
+		bench_budget(scene, pixels, opts->budget_ms);
+	bench_update(scene, opts->move_pct);
+}
@@ -0,0 +1,46 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_progressive.c                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench.h"
+#include "render.h"
+
+/*
+ * bench_progressive - 점진적 렌더링의 첫 표시까지 걸리는 시간 측정
+ * @scene: prepare_scene이 끝난 장면
+ * @pixels: 렌더링할 이미지 버퍼 (WIDTH × HEIGHT)
+ *
+ * miniRT --progressive의 loop_hook처럼 PROGRESSIVE_BATCH 샘플씩
+ * 렌더링합니다. 첫 호출(타일 후보 목록 + 1/8 해상도 전체)이 끝나면
+ * 창에 첫 화면이 보이므로 그 시간을 첫 표시 시간으로 봅니다. 모든
+ * 단계가 끝난 시간과 이미지의 체크섬(render_scene과 같아야 함)도
+ * key=value 형식으로 출력합니다.
+ */
+void	bench_progressive(t_scene *scene, int *pixels)
+{
+	t_mlx_data	data;
+	t_progress	*p;
+	double		start;
+
+	data.img_data = pixels;
+	start = bench_now();
+	p = progress_start(scene, &data);
+	if (!p)
+		return ;
+	progress_step(p, PROGRESSIVE_BATCH);
+	printf("progressive_first_ms=%.3f\n", (bench_now() - start) * 1000);
+	while (p->step > 0)
+		progress_step(p, PROGRESSIVE_BATCH);
+	printf("progressive_total_ms=%.3f\n", (bench_now() - start) * 1000);
+	printf("progressive_checksum=%016llx\n",
+		image_checksum(pixels, WIDTH * HEIGHT));
+	free(p);
+}
@@ -0,0 +1,92 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_relight.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench.h"
+#include "render.h"
+
+/*
+ * render_gbuffer - G-버퍼를 쓰며 한 프레임 렌더링
+ * @scene: 렌더링할 장면
+ * @pixels: 이미지 버퍼 (WIDTH × HEIGHT)
+ * @gbuf: 교점을 기록하거나 읽을 G-버퍼
+ * @relight: 1이면 gbuf의 교점으로 조명만 계산, 0이면 추적하며 기록
+ *
+ * Return: 렌더링 시간 (밀리초)
+ */
+static double	render_gbuffer(t_scene *scene, int *pixels, t_hit *gbuf,
+	int relight)
+{
+	t_frame	f;
+	double	start;
+	int		tile;
+
+	start = bench_now();
+	frame_begin(&f, scene, pixels);
+	f.gbuf = gbuf;
+	f.relight = relight;
+	tile = 0;
+	while (tile < TILE_COUNT)
+		render_tile(&f, tile++);
+	frame_end(&f);
+	return ((bench_now() - start) * 1000);
+}
+
+/*
+ * scale_lights - 모든 광원과 환경광의 밝기 비율 바꾸기
+ * @scene: 장면
+ * @factor: 밝기 비율에 곱할 값
+ *
+ * 조명 작업에서 A, L 줄을 고친 것과 같습니다. 카메라와 물체는
+ * 그대로입니다.
+ */
+static void	scale_lights(t_scene *scene, double factor)
+{
+	t_light	*light;
+
+	if (scene->ambient_light)
+		scene->ambient_light->ratio *= factor;
+	light = scene->lights;
+	while (light)
+	{
+		light->ratio *= factor;
+		light = light->next;
+	}
+	prepare_lights(scene);
+}
+
+/*
+ * bench_relight - 광원만 바꿀 때 G-버퍼로 다시 계산하는 시간 측정
+ * @scene: prepare_scene이 끝난 장면 (광원은 끝나면 되돌림)
+ * @pixels: 렌더링할 이미지 버퍼 (WIDTH × HEIGHT)
+ *
+ * G-버퍼에 교점을 기록하며 한 프레임을 렌더링한 뒤, 광원 세기를
+ * 바꾸고 G-버퍼로 조명만 다시 계산합니다. 두 시간과 처음부터
+ * 렌더링한 이미지와 다른 픽셀 수 (0이어야 함)를 key=value 형식으로
+ * 출력합니다.
+ */
+void	bench_relight(t_scene *scene, int *pixels)
+{
+	t_hit	*gbuf;
+	double	ms;
+
+	gbuf = malloc(sizeof(t_hit) * WIDTH * HEIGHT);
+	if (!gbuf)
+		return ;
+	ms = render_gbuffer(scene, pixels, gbuf, 0);
+	printf("relight_capture_ms=%.3f\n", ms);
+	scale_lights(scene, 0.5);
+	ms = render_gbuffer(scene, pixels, gbuf, 1);
+	printf("relight_ms=%.3f\n", ms);
+	printf("relight_diff_pixels=%ld\n", fresh_diff(scene, pixels));
+	scale_lights(scene, 2);
+	free(gbuf);
+}
@@ -0,0 +1,129 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_reproject.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench.h"
+#include "render.h"
+
+/*
+ * render_history - 재투영 기록을 쓰며 한 프레임 렌더링
+ * @scene: 렌더링할 장면
+ * @pixels: 이미지 버퍼 (WIDTH × HEIGHT)
+ * @h: 재투영 기록
+ *
+ * miniRT의 작업 스레드가 하는 일을 한 스레드에서 합니다.
+ */
+static void	render_history(t_scene *scene, int *pixels, t_history *h)
+{
+	t_frame	f;
+	int		tile;
+
+	frame_begin(&f, scene, pixels);
+	f.history = h;
+	history_reproject(h, &scene->camera, 1);
+	tile = 0;
+	while (tile < TILE_COUNT)
+		render_tile(&f, tile++);
+	frame_end(&f);
+}
+
+/*
+ * print_error - 재투영한 이미지와 처음부터 렌더링한 이미지의 차이
+ * @scene: 마지막 카메라의 장면
+ * @pixels: 재투영으로 렌더링한 이미지
+ */
+static void	print_error(t_scene *scene, int *pixels)
+{
+	t_mlx_data	full;
+	long		differing;
+	int			i;
+
+	full.img_data = malloc(sizeof(int) * WIDTH * HEIGHT);
+	if (!full.img_data)
+		return ;
+	render_scene(scene, &full);
+	differing = 0;
+	i = 0;
+	while (i < WIDTH * HEIGHT)
+	{
+		if (full.img_data[i] != pixels[i])
+			differing++;
+		i++;
+	}
+	printf("reproject_diff_pixels_pct=%.4f\n",
+		100.0 * differing / ((double)WIDTH * HEIGHT));
+	free(full.img_data);
+}
+
+/*
+ * move_frames - 카메라를 앞으로 옮기며 재투영으로 렌더링
+ * @scene: 렌더링할 장면
+ * @pixels: 이미지 버퍼
+ * @h: 첫 프레임을 기록한 재투영 기록
+ * @ms: 모든 프레임의 렌더링 시간 합 (출력, 밀리초)
+ *
+ * W 키를 누른 것처럼 카메라를 BENCH_REPROJECT_FRAMES번 옮기며 전체
+ * 해상도로 렌더링합니다.
+ *
+ * Return: 모든 프레임에서 기록을 다시 쓴 샘플 수
+ */
+static long	move_frames(t_scene *scene, int *pixels, t_history *h, double *ms)
+{
+	long	reused;
+	double	start;
+	int		i;
+
+	*ms = 0;
+	reused = 0;
+	i = 0;
+	while (i++ < BENCH_REPROJECT_FRAMES)
+	{
+		camera_move(scene, KEY_W);
+		h->epoch++;
+		h->moving = 1;
+		start = bench_now();
+		render_history(scene, pixels, h);
+		*ms += (bench_now() - start) * 1000;
+		reused += history_reused(h, 1);
+	}
+	return (reused);
+}
+
+/*
+ * bench_reproject - 카메라를 옮기며 재투영이 줄이는 추적 수 측정
+ * @scene: prepare_scene이 끝난 장면 (카메라는 끝나면 되돌림)
+ * @pixels: 렌더링할 이미지 버퍼 (WIDTH × HEIGHT)
+ *
+ * 첫 프레임을 렌더링한 뒤 move_frames를 실행하고, 프레임당 시간
+ * (처음부터 렌더링하는 시간은 seconds), 기록을 다시 쓴 샘플의 비율,
+ * 마지막 프레임이 처음부터 렌더링한 이미지와 다른 픽셀의 비율을
+ * key=value 형식으로 출력합니다.
+ */
+void	bench_reproject(t_scene *scene, int *pixels)
+{
+	t_history	h;
+	t_camera	start;
+	double		ms;
+	long		reused;
+
+	start = scene->camera;
+	if (history_init(&h))
+	{
+		render_history(scene, pixels, &h);
+		reused = move_frames(scene, pixels, &h, &ms);
+		printf("reproject_ms_per_frame=%.3f\n", ms / BENCH_REPROJECT_FRAMES);
+		printf("reproject_reused_pct=%.2f\n", 100.0 * reused
+			/ ((double)WIDTH * HEIGHT * BENCH_REPROJECT_FRAMES));
+		print_error(scene, pixels);
+	}
+	history_free(&h);
+	scene->camera = start;
+}
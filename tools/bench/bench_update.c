@@ -0,0 +1,150 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_update.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench.h"
+#include "vec3.h"
+#include <math.h>
+
+/*
+ * pick_moved - 애니메이션으로 옮길 물체 고르기
+ * @scene: 장면
+ * @percent: 평면이 아닌 물체 중 옮길 비율 (0 ~ 100)
+ * @count: 고른 물체 수 (출력)
+ *
+ * 목록 전체에 고르게 퍼지도록 k번째 물체는 floor(k * percent / 100)이
+ * 바뀔 때 고릅니다.
+ *
+ * Return: 고른 물체 배열 (호출자가 해제), 메모리가 부족하면 NULL
+ */
+static t_object	**pick_moved(t_scene *scene, double percent, int *count)
+{
+	t_object	**moved;
+	t_object	*obj;
+	long		k;
+
+	k = 1;
+	obj = scene->objects;
+	while (obj && ++k)
+		obj = obj->next;
+	moved = malloc(sizeof(t_object *) * k);
+	if (!moved)
+		return (NULL);
+	*count = 0;
+	k = 0;
+	obj = scene->objects;
+	while (obj)
+	{
+		if (obj->type != OBJ_PLANE)
+		{
+			k++;
+			if ((long)(k * percent / 100) > (long)((k - 1) * percent / 100))
+				moved[(*count)++] = obj;
+		}
+		obj = obj->next;
+	}
+	return (moved);
+}
+
+/*
+ * bench_jitter - 물체들을 자기 크기의 1/4 정도씩 옮기기
+ * @moved: 구, 원기둥 또는 배치
+ * @count: moved의 개수
+ * @frame: 프레임 번호 (옮길 방향을 정함)
+ */
+void	bench_jitter(t_object **moved, int count, int frame)
+{
+	t_vec3	d;
+	t_vec3	*pos;
+	t_real	size;
+
+	d = vec3_new(sin(frame * 1.7), cos(frame * 1.3), sin(frame * 0.7));
+	while (count-- > 0)
+	{
+		if (moved[count]->type == OBJ_SPHERE)
+		{
+			pos = &((t_sphere *)moved[count]->object)->center;
+			size = ((t_sphere *)moved[count]->object)->radius;
+		}
+		else if (moved[count]->type == OBJ_CYLINDER)
+		{
+			pos = &((t_cylinder *)moved[count]->object)->center;
+			size = ((t_cylinder *)moved[count]->object)->radius;
+		}
+		else
+		{
+			pos = &((t_instance *)moved[count]->object)->position;
+			size = ((t_instance *)moved[count]->object)->scale;
+		}
+		*pos = vec3_add(*pos, vec3_mul(d, 0.25 * size));
+	}
+}
+
+/*
+ * report_update - 갱신 결과와 전체 재구성 시간 출력
+ * @scene: 갱신이 끝난 장면
+ * @count: 프레임마다 옮긴 물체 수
+ * @seconds: 모든 프레임의 scene_update 시간 합
+ * @refits: 다시 만들지 않고 고친 프레임 수
+ *
+ * 비교를 위해 같은 장면의 가속 구조를 한 번 새로 만들어 잽니다.
+ */
+static void	report_update(t_scene *scene, int count, double seconds,
+	int refits)
+{
+	double	start;
+
+	start = bench_now();
+	free_accel(scene->accel);
+	scene->accel = build_accel(scene->objects, scene->accel_mode);
+	printf("update_objects=%d\n", count);
+	printf("update_frames=%d\n", BENCH_UPDATE_FRAMES);
+	printf("update_refits=%d\n", refits);
+	printf("update_ms=%.3f\n", 1000 * seconds / BENCH_UPDATE_FRAMES);
+	printf("rebuild_ms=%.3f\n", 1000 * (bench_now() - start));
+}
+
+/*
+ * bench_update - 일부 물체를 옮기는 애니메이션의 가속 구조 갱신 시간
+ * @scene: prepare_scene이 끝난 장면
+ * @percent: 프레임마다 옮길 물체의 비율 (--move, 0이면 측정하지 않음)
+ *
+ * BENCH_UPDATE_FRAMES 프레임 동안 같은 물체들을 조금씩 옮기고
+ * scene_update (refit, 필요하면 재구성)의 평균 시간을 전체
+ * 재구성(build_accel) 시간과 함께 출력합니다.
+ */
+void	bench_update(t_scene *scene, double percent)
+{
+	t_object	**moved;
+	double		start;
+	double		seconds;
+	int			count;
+	int			frame;
+	int			refits;
+
+	if (percent <= 0)
+		return ;
+	moved = pick_moved(scene, percent, &count);
+	if (!moved)
+		return ;
+	seconds = 0;
+	refits = 0;
+	frame = 0;
+	while (frame < BENCH_UPDATE_FRAMES)
+	{
+		bench_jitter(moved, count, frame++);
+		start = bench_now();
+		refits += scene_update(scene, moved, count);
+		seconds += bench_now() - start;
+	}
+	report_update(scene, count, seconds, refits);
+	free(moved);
+}
@@ -0,0 +1,140 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_utils.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench.h"
+#include <time.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+/*
+ * bench_now - 단조 증가 시계의 현재 시각
+ *
+ * 시스템 시간 변경의 영향을 받지 않도록 CLOCK_MONOTONIC을 사용합니다.
+ *
+ * Return: 초 단위 현재 시각
+ */
+double	bench_now(void)
+{
+	struct timespec	ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (ts.tv_sec + ts.tv_nsec * 1e-9);
+}
+
+/*
+ * image_checksum - 렌더링 결과 이미지의 FNV-1a 64비트 해시
+ * @pixels: 0xRRGGBB 형식의 픽셀 버퍼
+ * @count: 픽셀 개수
+ *
+ * 각 픽셀의 R, G, B 바이트만 해시에 반영합니다.
+ * 같은 장면과 같은 빌드 설정이라면 항상 같은 값이 나오므로
+ * 렌더링 결과가 바뀌었는지 검사하는 데 사용합니다.
+ *
+ * Return: 64비트 체크섬
+ */
+unsigned long long	image_checksum(int *pixels, int count)
+{
+	unsigned long long	hash;
+	int					i;
+	int					shift;
+
+	hash = 14695981039346656037ULL;
+	i = 0;
+	while (i < count)
+	{
+		shift = 16;
+		while (shift >= 0)
+		{
+			hash ^= (pixels[i] >> shift) & 0xFF;
+			hash *= 1099511628211ULL;
+			shift -= 8;
+		}
+		i++;
+	}
+	return (hash);
+}
+
+/*
+ * write_ppm_row - PPM 파일에 한 줄의 픽셀 기록
+ * @fd: 출력 파일 디스크립터
+ * @row: 한 줄의 픽셀 (0xRRGGBB)
+ */
+static void	write_ppm_row(int fd, int *row)
+{
+	unsigned char	rgb[WIDTH * 3];
+	int				x;
+
+	x = 0;
+	while (x < WIDTH)
+	{
+		rgb[x * 3] = (row[x] >> 16) & 0xFF;
+		rgb[x * 3 + 1] = (row[x] >> 8) & 0xFF;
+		rgb[x * 3 + 2] = row[x] & 0xFF;
+		x++;
+	}
+	write(fd, rgb, sizeof(rgb));
+}
+
+/*
+ * dump_ppm - 렌더링 결과를 바이너리 PPM(P6)으로 저장
+ * @pixels: WIDTH * HEIGHT 크기의 픽셀 버퍼
+ * @path: 출력 파일 경로
+ *
+ * 체크섬이 달라졌을 때 원인을 눈으로 확인하거나
+ * 두 빌드의 결과를 비교하기 위한 원본 이미지를 남깁니다.
+ *
+ * Return: 1 (성공), 0 (실패)
+ */
+int	dump_ppm(int *pixels, char *path)
+{
+	int		fd;
+	int		y;
+	char	header[32];
+	int		len;
+
+	fd = open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+	if (fd < 0)
+		return (0);
+	len = snprintf(header, sizeof(header), "P6\n%d %d\n255\n", WIDTH, HEIGHT);
+	write(fd, header, len);
+	y = 0;
+	while (y < HEIGHT)
+	{
+		write_ppm_row(fd, pixels + y * WIDTH);
+		y++;
+	}
+	close(fd);
+	return (1);
+}
+
+/*
+ * scene_accel_bytes - 장면과 모든 그룹의 가속 구조 메모리
+ * @scene: prepare_scene이 끝난 장면
+ *
+ * 그룹의 가속 구조는 배치 수와 관계없이 한 번만 셉니다.
+ *
+ * Return: 바이트 수
+ */
+size_t	scene_accel_bytes(t_scene *scene)
+{
+	t_group	*group;
+	size_t	bytes;
+
+	bytes = accel_bytes(scene->accel);
+	group = scene->groups;
+	while (group)
+	{
+		bytes += accel_bytes(group->accel);
+		group = group->next;
+	}
+	return (bytes);
+}
@@ -0,0 +1,61 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   scenegen.h                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef SCENEGEN_H
+# define SCENEGEN_H
+
+# include "minirt.h"
+# include "rng.h"
+# include <stdio.h>
+
+# define DIST_UNIFORM 0
+# define DIST_CLUSTERED 1
+# define DIST_STADIUM 2
+
+/* 균등 분포에서 물체 사이의 평균 간격 (물체 크기는 약 1) */
+# define GEN_SPACING 4.0
+/* 군집 하나에 들어가는 평균 물체 수 */
+# define GEN_CLUSTER_SIZE 500
+
+typedef struct s_gen_opts
+{
+	long				count;
+	int					dist;
+	unsigned long long	seed;
+	int					cylinder_pct;
+	int					planes;
+	int					lights;
+	char				*out_path;
+}	t_gen_opts;
+
+typedef struct s_gen
+{
+	t_gen_opts			opts;
+	unsigned long long	state;
+	double				extent;
+	long				n_clusters;
+	FILE				*out;
+}	t_gen;
+
+typedef struct s_placement
+{
+	t_vec3	pos;
+	double	size;
+}	t_placement;
+
+int			parse_gen_args(int argc, char **argv, t_gen_opts *opts);
+double		scene_extent(t_gen_opts *opts);
+t_placement	place_object(t_gen *gen, long index);
+void		emit_header(t_gen *gen);
+void		emit_object(t_gen *gen, t_placement pl);
+
+#endif
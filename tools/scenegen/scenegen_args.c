@@ -0,0 +1,91 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   scenegen_args.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "scenegen.h"
+#include <string.h>
+
+/*
+ * parse_dist - 분포 이름을 DIST_* 상수로 변환
+ *
+ * Return: 분포 상수, 알 수 없는 이름이면 -1
+ */
+static int	parse_dist(char *name)
+{
+	if (!strcmp(name, "uniform"))
+		return (DIST_UNIFORM);
+	if (!strcmp(name, "clustered"))
+		return (DIST_CLUSTERED);
+	if (!strcmp(name, "stadium"))
+		return (DIST_STADIUM);
+	return (-1);
+}
+
+/*
+ * set_option - 값을 받는 옵션 하나를 적용
+ * @opts: 옵션 구조체
+ * @flag: 옵션 이름 (예: "-n")
+ * @value: 옵션 값
+ *
+ * Return: 1 (알려진 옵션), 0 (알 수 없는 옵션)
+ */
+static int	set_option(t_gen_opts *opts, char *flag, char *value)
+{
+	if (!strcmp(flag, "-n"))
+		opts->count = atol(value);
+	else if (!strcmp(flag, "--dist"))
+		opts->dist = parse_dist(value);
+	else if (!strcmp(flag, "--seed"))
+		opts->seed = strtoull(value, NULL, 10);
+	else if (!strcmp(flag, "--cylinders"))
+		opts->cylinder_pct = atoi(value);
+	else if (!strcmp(flag, "--planes"))
+		opts->planes = atoi(value);
+	else if (!strcmp(flag, "--lights"))
+		opts->lights = atoi(value);
+	else if (!strcmp(flag, "-o"))
+		opts->out_path = value;
+	else
+		return (0);
+	return (1);
+}
+
+/*
+ * parse_gen_args - 장면 생성기 커맨드 라인 인자 해석
+ * @argc: 인자 개수
+ * @argv: 인자 배열
+ * @opts: 해석 결과 (출력)
+ *
+ * 기본값: 물체 1000개, 균등 분포, 시드 1, 원기둥 20%,
+ *         평면 1개(바닥), 광원 2개, 표준 출력
+ *
+ * Return: 1 (성공), 0 (잘못된 인자)
+ */
+int	parse_gen_args(int argc, char **argv, t_gen_opts *opts)
+{
+	int	i;
+
+	opts->count = 1000;
+	opts->dist = DIST_UNIFORM;
+	opts->seed = 1;
+	opts->cylinder_pct = 20;
+	opts->planes = 1;
+	opts->lights = 2;
+	opts->out_path = NULL;
+	i = 1;
+	while (i + 1 < argc && set_option(opts, argv[i], argv[i + 1]))
+		i += 2;
+	if (i != argc || opts->count < 0 || opts->dist < 0)
+		return (0);
+	if (opts->cylinder_pct < 0 || opts->cylinder_pct > 100)
+		return (0);
+	return (opts->planes >= 0 && opts->lights >= 0);
+}
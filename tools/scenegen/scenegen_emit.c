@@ -0,0 +1,119 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   scenegen_emit.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "scenegen.h"
+#include "vec3.h"
+#include <math.h>
+
+/*
+ * emit_camera - 장면 전체가 보이도록 카메라 배치
+ * @gen: 생성기 상태
+ *
+ * 장면 중심(원점)을 비스듬히 위에서 내려다보는 위치에 둡니다.
+ */
+static void	emit_camera(t_gen *gen)
+{
+	t_vec3	pos;
+	t_vec3	dir;
+
+	pos = vec3_new(0, gen->extent * 0.35, -gen->extent * 1.1);
+	dir = vec3_normalize(vec3_mul(pos, -1.0));
+	fprintf(gen->out, "C %.3f,%.3f,%.3f %.4f,%.4f,%.4f 70\n",
+		pos.x, pos.y, pos.z, dir.x, dir.y, dir.z);
+}
+
+/*
+ * emit_planes - 바닥과 벽 평면 출력
+ * @gen: 생성기 상태
+ *
+ * 첫 번째는 바닥, 그 다음은 뒤쪽/왼쪽/오른쪽 벽입니다.
+ * 네 개를 넘는 평면은 장면 바깥쪽 먼 곳에 임의의 방향으로 둡니다.
+ */
+static void	emit_planes(t_gen *gen)
+{
+	static const char	*fixed[4] = {"0,-%.3f,0 0,1,0", "0,0,%.3f 0,0,-1",
+		"-%.3f,0,0 1,0,0", "%.3f,0,0 -1,0,0"};
+	int					i;
+	t_vec3				n;
+
+	i = 0;
+	while (i < gen->opts.planes)
+	{
+		fprintf(gen->out, "pl ");
+		if (i < 4)
+			fprintf(gen->out, fixed[i], gen->extent * (0.5 + (i > 0)));
+		else
+		{
+			n = rng_unit(&gen->state);
+			fprintf(gen->out, "%.3f,%.3f,%.3f %.4f,%.4f,%.4f",
+				-n.x * gen->extent * 2, -n.y * gen->extent * 2,
+				-n.z * gen->extent * 2, n.x, n.y, n.z);
+		}
+		fprintf(gen->out, " %d,%d,%d\n", 90 + i * 30 % 120, 90 + i * 50 % 120,
+			90 + i * 70 % 120);
+		i++;
+	}
+}
+
+/*
+ * emit_header - 주석, 환경광, 카메라, 광원, 평면 출력
+ * @gen: 생성기 상태
+ *
+ * 주석에 생성 옵션을 남겨서 같은 장면을 다시 만들 수 있게 합니다.
+ */
+void	emit_header(t_gen *gen)
+{
+	static const char	*names[3] = {"uniform", "clustered", "stadium"};
+	int					i;
+
+	fprintf(gen->out, "# miniRT_scenegen -n %ld --dist %s --seed %llu "
+		"--cylinders %d --planes %d --lights %d\n", gen->opts.count,
+		names[gen->opts.dist], gen->opts.seed, gen->opts.cylinder_pct,
+		gen->opts.planes, gen->opts.lights);
+	fprintf(gen->out, "A 0.15 255,255,255\n");
+	emit_camera(gen);
+	i = 0;
+	while (i++ < gen->opts.lights)
+		fprintf(gen->out, "L %.3f,%.3f,%.3f 0.6 255,255,255\n",
+			rng_range(&gen->state, -gen->extent, gen->extent),
+			gen->extent, rng_range(&gen->state, -gen->extent, 0));
+	emit_planes(gen);
+}
+
+/*
+ * emit_object - 구 또는 원기둥 하나 출력
+ * @gen: 생성기 상태
+ * @pl: 물체의 위치와 크기
+ *
+ * --cylinders 비율에 따라 원기둥을 섞습니다.
+ * 원기둥의 축은 임의 방향, 높이는 지름의 1~3배입니다.
+ */
+void	emit_object(t_gen *gen, t_placement pl)
+{
+	t_vec3	axis;
+	int		rgb[3];
+
+	rgb[0] = 40 + rng_next(&gen->state) % 216;
+	rgb[1] = 40 + rng_next(&gen->state) % 216;
+	rgb[2] = 40 + rng_next(&gen->state) % 216;
+	if ((int)(rng_next(&gen->state) % 100) < gen->opts.cylinder_pct)
+	{
+		axis = rng_unit(&gen->state);
+		fprintf(gen->out, "cy %.3f,%.3f,%.3f %.4f,%.4f,%.4f %.3f %.3f "
+			"%d,%d,%d\n", pl.pos.x, pl.pos.y, pl.pos.z, axis.x, axis.y,
+			axis.z, pl.size * 2, pl.size * rng_range(&gen->state, 2, 6),
+			rgb[0], rgb[1], rgb[2]);
+	}
+	else
+		fprintf(gen->out, "sp %.3f,%.3f,%.3f %.3f %d,%d,%d\n", pl.pos.x,
+			pl.pos.y, pl.pos.z, pl.size * 2, rgb[0], rgb[1], rgb[2]);
+}
@@ -0,0 +1,78 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   scenegen_main.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "scenegen.h"
+
+/*
+ * print_usage - 사용법 출력
+ */
+static void	print_usage(char *name)
+{
+	printf("Error\nUsage: %s [-n COUNT] [--dist uniform|clustered|stadium]\n"
+		"       [--seed S] [--cylinders PERCENT] [--planes P] [--lights L]"
+		"\n       [-o out.rt]\n", name);
+}
+
+/*
+ * open_output - 출력 파일 열기 (-o가 없으면 표준 출력)
+ *
+ * Return: 출력 스트림, 실패 시 NULL
+ */
+static FILE	*open_output(t_gen_opts *opts)
+{
+	FILE	*out;
+
+	if (!opts->out_path)
+		return (stdout);
+	out = fopen(opts->out_path, "w");
+	if (!out)
+		printf("Error\nCannot write %s\n", opts->out_path);
+	return (out);
+}
+
+/*
+ * main - 벤치마크용 대형 .rt 장면 생성기
+ * @argc: 인자 개수
+ * @argv: 인자 배열
+ *
+ * 구와 원기둥 COUNT개, 평면 P개, 광원 L개로 된 장면을 만듭니다.
+ * 같은 옵션과 시드로 실행하면 항상 바이트 단위로 같은 파일이 나오므로
+ * 성능 테스트의 체크섬 기준값으로 쓸 수 있습니다.
+ *
+ * 예: ./miniRT_scenegen -n 100000 --dist clustered --seed 7 -o big.rt
+ *
+ * Return: 0 (성공), 1 (실패)
+ */
+int	main(int argc, char **argv)
+{
+	t_gen	gen;
+	long	i;
+
+	if (!parse_gen_args(argc, argv, &gen.opts))
+	{
+		print_usage(argv[0]);
+		return (1);
+	}
+	gen.out = open_output(&gen.opts);
+	if (!gen.out)
+		return (1);
+	gen.state = gen.opts.seed;
+	gen.extent = scene_extent(&gen.opts);
+	gen.n_clusters = 1 + gen.opts.count / GEN_CLUSTER_SIZE;
+	emit_header(&gen);
+	i = 0;
+	while (i < gen.opts.count)
+		emit_object(&gen, place_object(&gen, i++));
+	if (gen.out != stdout)
+		fclose(gen.out);
+	return (0);
+}
@@ -0,0 +1,126 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   scenegen_place.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "scenegen.h"
+#include "vec3.h"
+#include <math.h>
+
+/*
+ * scene_extent - 물체 수와 분포에 맞는 장면의 한 변 길이
+ * @opts: 생성 옵션
+ *
+ * 균등/군집 분포는 물체 수가 늘어도 밀도가 일정하도록
+ * 세제곱근에 비례해 키웁니다. stadium은 같은 물체 수에서
+ * 네 배 넓은 공간을 써서 대부분이 빈 공간이 되게 합니다.
+ *
+ * Return: 장면의 한 변 길이
+ */
+double	scene_extent(t_gen_opts *opts)
+{
+	double	extent;
+
+	extent = GEN_SPACING * cbrt(fmax(1.0, (double)opts->count));
+	if (opts->dist == DIST_STADIUM)
+		extent *= 4.0;
+	return (extent);
+}
+
+/*
+ * gaussian3 - 표준 정규분포를 따르는 3차원 벡터 (Box-Muller 변환)
+ */
+static t_vec3	gaussian3(unsigned long long *state)
+{
+	double	r[2];
+	double	theta[2];
+
+	r[0] = sqrt(-2.0 * log(rng_range(state, 1e-12, 1.0)));
+	r[1] = sqrt(-2.0 * log(rng_range(state, 1e-12, 1.0)));
+	theta[0] = rng_range(state, 0.0, 2.0 * M_PI);
+	theta[1] = rng_range(state, 0.0, 2.0 * M_PI);
+	return (vec3_new(r[0] * cos(theta[0]), r[0] * sin(theta[0]),
+			r[1] * cos(theta[1])));
+}
+
+/*
+ * place_clustered - 군집 분포의 물체 위치
+ * @gen: 생성기 상태
+ *
+ * 군집 중심은 저장하지 않고 (시드, 군집 번호)로부터 매번 같은 값을
+ * 다시 만들어 내므로 물체 수가 많아도 추가 메모리가 필요 없습니다.
+ * 물체는 중심 주변에 정규분포로 흩어집니다.
+ */
+static t_placement	place_clustered(t_gen *gen)
+{
+	t_placement			pl;
+	unsigned long long	cluster;
+	double				sigma;
+
+	cluster = gen->opts.seed ^ ((rng_next(&gen->state) % gen->n_clusters + 1)
+			* 0x9E3779B97F4A7C15ULL);
+	sigma = gen->extent / (4.0 * cbrt((double)gen->n_clusters));
+	pl.pos = vec3_add(rng_point(&cluster, gen->extent / 2.0),
+			vec3_mul(gaussian3(&gen->state), sigma));
+	pl.size = rng_range(&gen->state, 0.3, 1.0);
+	return (pl);
+}
+
+/*
+ * place_stadium - "teapot in a stadium" 분포의 물체 위치
+ * @gen: 생성기 상태
+ * @index: 물체 번호
+ *
+ * 물체의 10%는 장면 가장자리를 둘러싼 거대한 관중석(큰 물체),
+ * 나머지 90%는 원점의 아주 작은 영역에 빽빽하게 모인 찻주전자(작은
+ * 물체)가 됩니다. 크기와 밀도의 차이가 극단적이어서 균일 격자 같은
+ * 가속 구조의 약점을 드러내는 고전적인 시험 장면입니다.
+ */
+static t_placement	place_stadium(t_gen *gen, long index)
+{
+	t_placement	pl;
+	double		angle;
+	double		ring;
+	double		teapot;
+
+	if (index % 10 == 0)
+	{
+		angle = rng_range(&gen->state, 0.0, 2.0 * M_PI);
+		ring = gen->extent / 2.0 * rng_range(&gen->state, 0.8, 1.0);
+		pl.pos = vec3_new(ring * cos(angle), gen->extent / 2.0
+				* rng_range(&gen->state, -1.0, -0.75), ring * sin(angle));
+		pl.size = rng_range(&gen->state, 2.0, 6.0);
+		return (pl);
+	}
+	teapot = gen->extent / 80.0;
+	pl.pos = rng_point(&gen->state, teapot);
+	pl.size = rng_range(&gen->state, 0.05, 0.15);
+	return (pl);
+}
+
+/*
+ * place_object - 선택한 분포에 따라 index번째 물체의 위치와 크기 결정
+ * @gen: 생성기 상태
+ * @index: 물체 번호
+ *
+ * Return: 물체의 위치와 크기(반지름 정도의 값)
+ */
+t_placement	place_object(t_gen *gen, long index)
+{
+	t_placement	pl;
+
+	if (gen->opts.dist == DIST_CLUSTERED)
+		return (place_clustered(gen));
+	if (gen->opts.dist == DIST_STADIUM)
+		return (place_stadium(gen, index));
+	pl.pos = rng_point(&gen->state, gen->extent / 2.0);
+	pl.size = rng_range(&gen->state, 0.5, 1.5);
+	return (pl);
+}